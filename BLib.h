@@ -16,7 +16,19 @@
 #include "GCore.h"   // Basic graphics
 #include "GTexLib.h" // Texture editing
 #include "GFont.h"   // Basic fonts
+#include "GBitmapFont.h" // Bitmap font files
+#include "GGlyphCache.h" // Dynamic glyph atlases
 #include "ICore.h"   // Basic user interface
+#include "ITextCache.h" // Static string caching
+#include "IBatch.h"  // Quad batching
+#include "ITextView.h" // Scrolling log views
+#include "ITextEdit.h" // Editable text
+#include "IHitGrid.h"  // Mouse hit testing
+#include "IBlocks.h"   // Blocks, buttons and text fields
+#include "ILayer.h"    // Cached offscreen panels
+#include "IDamage.h"   // Partial redraws
+#include "ILayout.h"   // Row and column layout
+#include "ITween.h"    // Block animation
 
 #include "WCore.h"   // Basic window handling
 
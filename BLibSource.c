@@ -48,6 +48,8 @@ BLWindowHandle BLibInit(BLUInt width, BLUInt height)
 	//init fonts
 	BLInitGFont( );
 	BLInitICore( );
+	BLInitIBatch( );
+	BLInitITextCache(0);
 
 	//return window
 	return mainWin;
@@ -0,0 +1,127 @@
+#ifndef __GBITMAPFONT_INCLUDE__
+#define __GBITMAPFONT_INCLUDE__
+
+
+/*************************************************************
+* FILE: GBitmapFont.h
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Bitmap font file (BDF) loading into packed glyph atlases
+* CONTENTS:
+*	- Includes
+*	- Defs
+*	- Structs
+*	- Functions
+*
+*************************************************************/
+
+#include "GTexLib.h" // For texture related functions
+
+#define BL_BITMAPFONT_ATLAS_MAX  0x1000 // max atlas width/height
+#define BL_BITMAPFONT_ASCII_SIZE 0x100  // codepoints with a direct lookup
+#define BL_BITMAPFONT_NO_GLYPH   -1
+
+/*************************************************************
+* NAME: BLBitmapGlyph
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLUInt codepoint -> encoding of the glyph
+*	BLInt  advance   -> pen advance (in font pixels)
+*	BLInt  width     -> bitmap width (in font pixels)
+*	BLInt  height    -> bitmap height (in font pixels)
+*	BLInt  offX      -> bitmap left, from the pen position
+*	BLInt  offY      -> bitmap bottom, from the baseline
+*	BLRect uv        -> texture coords in the atlas (X and Y are
+*	the bottom left)
+*	BLUInt bitsOffset -> offset of the glyph in the font's bits
+* NOTE: N/A
+*************************************************************/
+typedef struct BLBitmapGlyph
+{
+	BLUInt codepoint;
+	BLInt  advance;
+	BLInt  width;
+	BLInt  height;
+	BLInt  offX;
+	BLInt  offY;
+	BLRect uv;
+	BLUInt bitsOffset;
+}BLBitmapGlyph;
+
+/*************************************************************
+* NAME: BLBitmapFont
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLTextureHandle atlas -> texture holding every glyph in WHITE
+*	(0 if the font is too large for one, see GGlyphCache.h)
+*	BLUInt atlasW     -> atlas width
+*	BLUInt atlasH     -> atlas height
+*	BLInt  boxW       -> font bounding box width
+*	BLInt  boxH       -> font bounding box height
+*	BLInt  boxOffY    -> font bounding box bottom, from the baseline
+*	BLUInt glyphCount -> amount of glyphs
+*	BLBitmapGlyph* glyphs -> every glyph, sorted by codepoint
+*	BLInt  defaultGlyph   -> glyph drawn for missing codepoints
+*	BLInt  asciiLookup[]  -> glyph index of low codepoints
+*	BLByte* bits          -> 1 bit per pixel glyph rows, bottom
+*	row first, each row padded to a byte (MSB is the left pixel)
+* NOTE:
+*	Create with BLLoadBitmapFontBDF, free with
+*	BLDestroyBitmapFont
+*************************************************************/
+typedef struct BLBitmapFont
+{
+	BLTextureHandle atlas;
+	BLUInt          atlasW;
+	BLUInt          atlasH;
+	BLInt           boxW;
+	BLInt           boxH;
+	BLInt           boxOffY;
+	BLUInt          glyphCount;
+	BLBitmapGlyph*  glyphs;
+	BLInt           defaultGlyph;
+	BLInt           asciiLookup[BL_BITMAPFONT_ASCII_SIZE];
+	BLByte*         bits;
+}BLBitmapFont;
+
+/*************************************************************
+* NAME: BLLoadBitmapFontBDF
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const char* path -> path of the .bdf file
+* RETURNS:
+*	BLBitmapFont* loaded from the file, NULL for failure
+* NOTE:
+*	The file is memory mapped and read in a single pass, every
+*	glyph is shelf packed into the atlas as it is read.
+*	Requires an ACTIVE window to run (the atlas is uploaded)
+*************************************************************/
+BLBitmapFont* BLLoadBitmapFontBDF(const char* path);
+
+/*************************************************************
+* NAME: BLDestroyBitmapFont
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBitmapFont* font -> font to free
+* RETURNS:
+*	void
+* NOTE:
+*	Frees the font from both CPU and GPU
+*************************************************************/
+void BLDestroyBitmapFont(BLBitmapFont* font);
+
+/*************************************************************
+* NAME: BLGetBitmapGlyph
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLBitmapFont* font -> font to search
+*	BLUInt codepoint -> codepoint to find
+* RETURNS:
+*	const BLBitmapGlyph* of the codepoint, the default glyph if
+*	the font doesn't have it
+* NOTE: N/A
+*************************************************************/
+const BLBitmapGlyph* BLGetBitmapGlyph(const BLBitmapFont* font, BLUInt codepoint);
+
+#endif
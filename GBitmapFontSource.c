@@ -0,0 +1,828 @@
+
+
+/*************************************************************
+* FILE: GBitmapFontSource.c
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Source file for bitmap font file loading
+* CONTENTS:
+*	- Includes
+*	- Backend struct defs
+*	- File-Specifc functions
+*	- Functions
+*
+*************************************************************/
+
+#include <stdio.h>   // I/O
+#include <stdlib.h>  // For memory management
+#include <string.h>  // For line parsing
+#include <Windows.h> // For memory mapped files
+
+#include "GBitmapFont.h" // Header
+
+/*************************************************************
+* NAME: BLMappedFile
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	HANDLE file     -> file handle
+*	HANDLE mapping  -> file mapping handle
+*	const char* data -> start of the mapped file
+*	size_t size     -> size of the mapped file
+* NOTE: File specific struct
+*************************************************************/
+typedef struct BLMappedFile
+{
+	HANDLE      file;
+	HANDLE      mapping;
+	const char* data;
+	size_t      size;
+}BLMappedFile;
+
+/*************************************************************
+* NAME: BLBDFReader
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLBitmapFont* font -> font being filled
+*	BLByte* atlasData  -> RGBA atlas being packed (NULL if the
+*	font is too large for one)
+*	BLUInt bitsUsed    -> bytes of font->bits filled so far
+*	BLUInt glyphMax    -> glyphs announced by CHARS
+*	BLUInt packX       -> X of the next glyph on the shelf
+*	BLUInt packY       -> bottom of the current shelf
+*	BLUInt shelfH      -> height of the current shelf
+*	BLInt  defaultChar -> DEFAULT_CHAR property (-1 for none)
+*	BLBitmapGlyph glyph -> glyph currently being read
+*	int    glyphValid  -> 1 if the current glyph will be kept
+*	BLInt  rowsLeft    -> bitmap rows left to read
+*	BLUInt glyphX      -> atlas X of the current glyph
+*	BLUInt glyphY      -> atlas Y of the current glyph
+* NOTE: File specific struct, holds the single pass state
+*************************************************************/
+typedef struct BLBDFReader
+{
+	BLBitmapFont* font;
+	BLByte*       atlasData;
+	BLUInt        bitsUsed;
+	BLUInt        glyphMax;
+	BLUInt        packX;
+	BLUInt        packY;
+	BLUInt        shelfH;
+	BLInt         defaultChar;
+	BLBitmapGlyph glyph;
+	int           glyphValid;
+	BLInt         rowsLeft;
+	BLUInt        glyphX;
+	BLUInt        glyphY;
+}BLBDFReader;
+
+/*************************************************************
+* NAME: BLHelperMapFile
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const char* path   -> file to map
+*	BLMappedFile* mFile -> mapped file to fill
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Maps the whole file as read only
+*************************************************************/
+static int BLHelperMapFile(const char* path, BLMappedFile* mFile)
+{
+	//open file
+	mFile->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if(mFile->file == INVALID_HANDLE_VALUE)
+	{
+		fprintf(stderr, "Cannot open font file: %s\n", path);
+		return 0;
+	}
+
+	//get size
+	LARGE_INTEGER fileSize;
+	if(GetFileSizeEx(mFile->file, &fileSize) == 0 || fileSize.QuadPart == 0)
+	{
+		fprintf(stderr, "Font file is empty: %s\n", path);
+		CloseHandle(mFile->file);
+		return 0;
+	}
+	mFile->size = (size_t)fileSize.QuadPart;
+
+	//map file
+	mFile->mapping = CreateFileMappingA(mFile->file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if(mFile->mapping == NULL)
+	{
+		fprintf(stderr, "Cannot map font file: %s\n", path);
+		CloseHandle(mFile->file);
+		return 0;
+	}
+
+	mFile->data = MapViewOfFile(mFile->mapping, FILE_MAP_READ, 0, 0, 0);
+	if(mFile->data == NULL)
+	{
+		fprintf(stderr, "Cannot map font file: %s\n", path);
+		CloseHandle(mFile->mapping);
+		CloseHandle(mFile->file);
+		return 0;
+	}
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLHelperUnmapFile
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLMappedFile* mFile -> mapped file to close
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static void BLHelperUnmapFile(BLMappedFile* mFile)
+{
+	UnmapViewOfFile(mFile->data);
+	CloseHandle(mFile->mapping);
+	CloseHandle(mFile->file);
+	return;
+}
+
+/*************************************************************
+* NAME: BLHelperNextLine
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const char** cursor -> read position (moved to the next line)
+*	const char* end     -> end of the data
+*	const char** line   -> set to the start of the line
+*	int* lineLen        -> set to the length of the line
+* RETURNS:
+*	int, 1 if a line was read, 0 at the end of the data
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Lines are NOT null terminated, the newline is left out
+*************************************************************/
+static inline int BLHelperNextLine(const char** cursor, const char* end, const char** line, int* lineLen)
+{
+	//check for end
+	if(*cursor >= end)
+	{
+		return 0;
+	}
+
+	//find newline
+	const char* newline = memchr(*cursor, '\n', (size_t)(end - *cursor));
+	if(newline == NULL)
+	{
+		newline = end;
+	}
+
+	//set line
+	*line    = *cursor;
+	*lineLen = (int)(newline - *cursor);
+	if(*lineLen > 0 && (*line)[*lineLen - 1] == '\r')
+	{
+		(*lineLen)--;
+	}
+
+	//move cursor
+	*cursor = (newline < end) ? newline + 1 : end;
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLHelperLineIs
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const char* line -> line to check
+*	int lineLen      -> length of line
+*	const char* keyword -> keyword to match
+* RETURNS:
+*	int, 1 if the line starts with keyword, 0 if not
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline int BLHelperLineIs(const char* line, int lineLen, const char* keyword)
+{
+	const int kLen = (int)strlen(keyword);
+
+	//check keyword and that it is a whole word
+	if(lineLen < kLen || memcmp(line, keyword, kLen) != 0)
+	{
+		return 0;
+	}
+
+	//end
+	return lineLen == kLen || line[kLen] == ' ' || line[kLen] == '\t';
+}
+
+/*************************************************************
+* NAME: BLHelperParseInts
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const char* line -> line to parse (keyword first)
+*	int lineLen      -> length of line
+*	BLInt* out       -> buffer for the parsed values
+*	int outSize      -> size of out
+* RETURNS:
+*	int, amount of values parsed
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Skips the keyword, then reads whitespace seperated ints
+*************************************************************/
+static int BLHelperParseInts(const char* line, int lineLen, BLInt* out, int outSize)
+{
+	int index = 0;
+
+	//skip keyword
+	while(index < lineLen && line[index] != ' ' && line[index] != '\t')
+	{
+		index++;
+	}
+
+	//parse values
+	int count = 0;
+	while(count < outSize)
+	{
+		//skip whitespace
+		while(index < lineLen && (line[index] == ' ' || line[index] == '\t'))
+		{
+			index++;
+		}
+
+		//check for end
+		if(index >= lineLen)
+		{
+			break;
+		}
+
+		//read sign
+		BLInt sign = 1;
+		if(line[index] == '-')
+		{
+			sign = -1;
+			index++;
+		}
+
+		//read digits
+		BLInt value = 0;
+		int   digits = 0;
+		while(index < lineLen && line[index] >= '0' && line[index] <= '9')
+		{
+			value = (value * 10) + (line[index] - '0');
+			index++;
+			digits++;
+		}
+
+		//not a number
+		if(digits == 0)
+		{
+			break;
+		}
+
+		out[count] = value * sign;
+		count++;
+	}
+
+	//end
+	return count;
+}
+
+/*************************************************************
+* NAME: BLHelperHexNibble
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	char hex -> hex character
+* RETURNS:
+*	int value of the character (0 for non hex)
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline int BLHelperHexNibble(char hex)
+{
+	if(hex >= '0' && hex <= '9') return hex - '0';
+	if(hex >= 'A' && hex <= 'F') return hex - 'A' + 10;
+	if(hex >= 'a' && hex <= 'f') return hex - 'a' + 10;
+	return 0;
+}
+
+/*************************************************************
+* NAME: BLHelperNextPowerOf2
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt value -> value to round up
+* RETURNS:
+*	BLUInt, smallest power of 2 >= value
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	openGL 1.1 textures must be a power of 2 in size
+*************************************************************/
+static inline BLUInt BLHelperNextPowerOf2(BLUInt value)
+{
+	BLUInt pow2 = 1;
+	while(pow2 < value)
+	{
+		pow2 <<= 1;
+	}
+	return pow2;
+}
+
+/*************************************************************
+* NAME: BLHelperBeginGlyphs
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBDFReader* reader -> reader to set up
+*	BLUInt glyphMax     -> glyphs announced by CHARS
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Sizes the atlas so that every glyph fits, even if each one
+*	is as big as the font bounding box. Shelf packing never
+*	puts fewer glyphs on a shelf than full sized ones would.
+*	Fonts too large for one atlas only keep their bits
+*************************************************************/
+static int BLHelperBeginGlyphs(BLBDFReader* reader, BLUInt glyphMax)
+{
+	BLBitmapFont* font = reader->font;
+
+	//check for bounding box
+	if(font->boxW <= 0 || font->boxH <= 0)
+	{
+		fprintf(stderr, "BDF: CHARS before FONTBOUNDINGBOX\n");
+		return 0;
+	}
+
+	//1 pixel of padding between glyphs
+	const BLUInt cellW = (BLUInt)font->boxW + 1;
+	const BLUInt cellH = (BLUInt)font->boxH + 1;
+
+	//get atlas size
+	BLUInt area = 0;
+	for(area = 1; area * area < glyphMax * cellW * cellH; area++);
+
+	font->atlasW = BLHelperNextPowerOf2(area > cellW ? area : cellW);
+	const BLUInt perRow = font->atlasW / cellW;
+	font->atlasH = BLHelperNextPowerOf2(((glyphMax + perRow - 1) / perRow) * cellH);
+
+	//allocate glyphs and bits (each row is padded to a byte)
+	font->glyphs = calloc(glyphMax + 1, sizeof(BLBitmapGlyph));
+	font->bits   = calloc(glyphMax * (BLUInt)font->boxH * (((BLUInt)font->boxW + 7) / 8), 1);
+	if(font->glyphs == NULL || font->bits == NULL)
+	{
+		fprintf(stderr, "BDF: memory err\n");
+		return 0;
+	}
+
+	reader->glyphMax = glyphMax;
+
+	//too large, glyphs have to go through a glyph cache
+	if(font->atlasW > BL_BITMAPFONT_ATLAS_MAX || font->atlasH > BL_BITMAPFONT_ATLAS_MAX)
+	{
+		font->atlasW = 0;
+		font->atlasH = 0;
+		return 1;
+	}
+
+	//allocate atlas (transparent white)
+	reader->atlasData = malloc(font->atlasW * font->atlasH * BL_FIXEDTEX_COLOR_CHANNELS);
+	if(reader->atlasData == NULL)
+	{
+		fprintf(stderr, "BDF: memory err\n");
+		return 0;
+	}
+
+	for(BLUInt i = 0; i < font->atlasW * font->atlasH; i++)
+	{
+		reader->atlasData[(i * 4) + 0] = 255;
+		reader->atlasData[(i * 4) + 1] = 255;
+		reader->atlasData[(i * 4) + 2] = 255;
+		reader->atlasData[(i * 4) + 3] = 0;
+	}
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLHelperPackGlyph
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBDFReader* reader -> reader with the current glyph
+* RETURNS:
+*	int, 1 if the glyph got space, 0 if not
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Reserves the current glyph's bits, then places it on the
+*	current shelf or starts a new shelf above it
+*************************************************************/
+static int BLHelperPackGlyph(BLBDFReader* reader)
+{
+	BLBitmapFont*  font  = reader->font;
+	BLBitmapGlyph* glyph = &reader->glyph;
+
+	//check glyph size (malformed font)
+	if(glyph->width > font->boxW || glyph->height > font->boxH)
+	{
+		fprintf(stderr, "BDF: glyph %u is larger than the font\n", glyph->codepoint);
+		return 0;
+	}
+
+	//empty glyphs take no space
+	glyph->uv = BLCreateRect(0, 0, 0, 0);
+	if(glyph->width <= 0 || glyph->height <= 0)
+	{
+		return 1;
+	}
+
+	//reserve bits
+	glyph->bitsOffset = reader->bitsUsed;
+	reader->bitsUsed += (BLUInt)glyph->height * (((BLUInt)glyph->width + 7) / 8);
+
+	//no atlas to pack into
+	if(reader->atlasData == NULL)
+	{
+		return 1;
+	}
+
+	//move to new shelf if full
+	if(reader->packX + (BLUInt)glyph->width + 1 > font->atlasW)
+	{
+		reader->packX  = 0;
+		reader->packY += reader->shelfH;
+		reader->shelfH = 0;
+	}
+
+	//check if out of space (malformed font)
+	if(reader->packY + (BLUInt)glyph->height > font->atlasH || (BLUInt)glyph->width + 1 > font->atlasW)
+	{
+		fprintf(stderr, "BDF: glyph %u doesn't fit the atlas\n", glyph->codepoint);
+		return 0;
+	}
+
+	//place glyph
+	reader->glyphX = reader->packX;
+	reader->glyphY = reader->packY;
+	reader->packX += (BLUInt)glyph->width + 1;
+	if((BLUInt)glyph->height + 1 > reader->shelfH)
+	{
+		reader->shelfH = (BLUInt)glyph->height + 1;
+	}
+
+	//get texture coords
+	glyph->uv = BLCreateRect((float)reader->glyphX / (float)font->atlasW, (float)reader->glyphY / (float)font->atlasH,
+		(float)glyph->width / (float)font->atlasW, (float)glyph->height / (float)font->atlasH);
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLHelperReadBitmapRow
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBDFReader* reader -> reader with the current glyph
+*	const char* line    -> hex row
+*	int lineLen         -> length of line
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	BDF rows go top to bottom, the bits and atlas go bottom
+*	to top
+*************************************************************/
+static void BLHelperReadBitmapRow(BLBDFReader* reader, const char* line, int lineLen)
+{
+	BLBitmapGlyph* glyph = &reader->glyph;
+	BLBitmapFont*  font  = reader->font;
+
+	//get bits row
+	const BLUInt rowSize = ((BLUInt)glyph->width + 7) / 8;
+	BLByte* bits = font->bits + glyph->bitsOffset + ((BLUInt)(reader->rowsLeft - 1) * rowSize);
+
+	//read each byte
+	for(BLUInt i = 0; i < rowSize && (int)(i * 2) + 1 < lineLen; i++)
+	{
+		bits[i] = (BLByte)((BLHelperHexNibble(line[i * 2]) << 4) | BLHelperHexNibble(line[(i * 2) + 1]));
+	}
+
+	//check for atlas
+	if(reader->atlasData == NULL)
+	{
+		return;
+	}
+
+	//get atlas row
+	const BLUInt rowY = reader->glyphY + (BLUInt)(reader->rowsLeft - 1);
+	BLByte* row = reader->atlasData + (((rowY * font->atlasW) + reader->glyphX) * BL_FIXEDTEX_COLOR_CHANNELS);
+
+	//write each pixel (MSB first)
+	for(BLInt pX = 0; pX < glyph->width; pX++)
+	{
+		if(bits[pX / 8] & (0x80 >> (pX % 8)))
+		{
+			row[(pX * BL_FIXEDTEX_COLOR_CHANNELS) + 3] = 255;
+		}
+	}
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLHelperCompareGlyphs
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const void* a -> first glyph
+*	const void* b -> second glyph
+* RETURNS:
+*	int, qsort ordering by codepoint
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static int BLHelperCompareGlyphs(const void* a, const void* b)
+{
+	const BLUInt cA = ((const BLBitmapGlyph*)a)->codepoint;
+	const BLUInt cB = ((const BLBitmapGlyph*)b)->codepoint;
+	return (cA > cB) - (cA < cB);
+}
+
+/*************************************************************
+* NAME: BLHelperFindGlyph
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLBitmapFont* font -> font to search
+*	BLUInt codepoint -> codepoint to find
+* RETURNS:
+*	BLInt, glyph index or BL_BITMAPFONT_NO_GLYPH
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Binary search, glyphs are sorted by codepoint
+*************************************************************/
+static BLInt BLHelperFindGlyph(const BLBitmapFont* font, BLUInt codepoint)
+{
+	BLInt low  = 0;
+	BLInt high = (BLInt)font->glyphCount - 1;
+
+	while(low <= high)
+	{
+		BLInt mid = low + ((high - low) / 2);
+		BLUInt midCode = font->glyphs[mid].codepoint;
+
+		if(midCode == codepoint)
+		{
+			return mid;
+		}
+
+		if(midCode < codepoint)
+		{
+			low = mid + 1;
+		}
+		else
+		{
+			high = mid - 1;
+		}
+	}
+
+	//end
+	return BL_BITMAPFONT_NO_GLYPH;
+}
+
+/*************************************************************
+* NAME: BLLoadBitmapFontBDF
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const char* path -> path of the .bdf file
+* RETURNS:
+*	BLBitmapFont* loaded from the file, NULL for failure
+* NOTE:
+*	The file is memory mapped and read in a single pass, every
+*	glyph is shelf packed into the atlas as it is read.
+*	Requires an ACTIVE window to run (the atlas is uploaded)
+*************************************************************/
+BLBitmapFont* BLLoadBitmapFontBDF(const char* path)
+{
+	//map file
+	BLMappedFile mFile;
+	if(BLHelperMapFile(path, &mFile) == 0)
+	{
+		return NULL;
+	}
+
+	//set up reader
+	BLBDFReader reader;
+	memset(&reader, 0, sizeof(BLBDFReader));
+	reader.defaultChar = -1;
+	reader.font = calloc(1, sizeof(BLBitmapFont));
+	if(reader.font == NULL)
+	{
+		fprintf(stderr, "BDF: memory err\n");
+		BLHelperUnmapFile(&mFile);
+		return NULL;
+	}
+
+	BLBitmapFont* font = reader.font;
+	int failed = 0;
+
+	//read every line
+	const char* cursor = mFile.data;
+	const char* end    = mFile.data + mFile.size;
+	const char* line;
+	int         lineLen;
+	BLInt       values[4];
+
+	while(failed == 0 && BLHelperNextLine(&cursor, end, &line, &lineLen))
+	{
+		//bitmap rows
+		if(reader.rowsLeft > 0)
+		{
+			if(reader.glyphValid)
+			{
+				BLHelperReadBitmapRow(&reader, line, lineLen);
+			}
+			reader.rowsLeft--;
+			continue;
+		}
+
+		//header
+		if(BLHelperLineIs(line, lineLen, "FONTBOUNDINGBOX"))
+		{
+			if(BLHelperParseInts(line, lineLen, values, 4) == 4)
+			{
+				font->boxW    = values[0];
+				font->boxH    = values[1];
+				font->boxOffY = values[3];
+			}
+		}
+		else if(BLHelperLineIs(line, lineLen, "DEFAULT_CHAR"))
+		{
+			if(BLHelperParseInts(line, lineLen, values, 1) == 1)
+			{
+				reader.defaultChar = values[0];
+			}
+		}
+		else if(BLHelperLineIs(line, lineLen, "CHARS"))
+		{
+			if(BLHelperParseInts(line, lineLen, values, 1) != 1 || values[0] <= 0 ||
+				BLHelperBeginGlyphs(&reader, (BLUInt)values[0]) == 0)
+			{
+				failed = 1;
+			}
+		}
+
+		//glyphs
+		else if(BLHelperLineIs(line, lineLen, "STARTCHAR"))
+		{
+			memset(&reader.glyph, 0, sizeof(BLBitmapGlyph));
+			reader.glyph.advance = font->boxW;
+			reader.glyphValid    = 0;
+		}
+		else if(BLHelperLineIs(line, lineLen, "ENCODING"))
+		{
+			//negative encodings are unencoded glyphs, skip them
+			if(BLHelperParseInts(line, lineLen, values, 1) == 1 && values[0] >= 0 &&
+				font->glyphs != NULL && font->glyphCount < reader.glyphMax)
+			{
+				reader.glyph.codepoint = (BLUInt)values[0];
+				reader.glyphValid      = 1;
+			}
+		}
+		else if(BLHelperLineIs(line, lineLen, "DWIDTH"))
+		{
+			if(BLHelperParseInts(line, lineLen, values, 1) == 1)
+			{
+				reader.glyph.advance = values[0];
+			}
+		}
+		else if(BLHelperLineIs(line, lineLen, "BBX"))
+		{
+			if(BLHelperParseInts(line, lineLen, values, 4) == 4)
+			{
+				reader.glyph.width  = values[0];
+				reader.glyph.height = values[1];
+				reader.glyph.offX   = values[2];
+				reader.glyph.offY   = values[3];
+			}
+		}
+		else if(BLHelperLineIs(line, lineLen, "BITMAP"))
+		{
+			if(reader.glyphValid)
+			{
+				reader.glyphValid = BLHelperPackGlyph(&reader);
+			}
+			reader.rowsLeft = reader.glyph.height;
+		}
+		else if(BLHelperLineIs(line, lineLen, "ENDCHAR"))
+		{
+			//keep glyph
+			if(reader.glyphValid)
+			{
+				font->glyphs[font->glyphCount] = reader.glyph;
+				font->glyphCount++;
+			}
+			reader.glyphValid = 0;
+		}
+	}
+
+	//done with file
+	BLHelperUnmapFile(&mFile);
+
+	//check for glyphs
+	if(failed || font->glyphCount == 0)
+	{
+		fprintf(stderr, "Cannot load BDF font: %s\n", path);
+		free(reader.atlasData);
+		free(font->glyphs);
+		free(font->bits);
+		free(font);
+		return NULL;
+	}
+
+	//sort for lookups
+	qsort(font->glyphs, font->glyphCount, sizeof(BLBitmapGlyph), BLHelperCompareGlyphs);
+
+	for(BLUInt i = 0; i < BL_BITMAPFONT_ASCII_SIZE; i++)
+	{
+		font->asciiLookup[i] = BLHelperFindGlyph(font, i);
+	}
+
+	//pick default glyph
+	font->defaultGlyph = (reader.defaultChar >= 0) ? BLHelperFindGlyph(font, (BLUInt)reader.defaultChar) : BL_BITMAPFONT_NO_GLYPH;
+	if(font->defaultGlyph == BL_BITMAPFONT_NO_GLYPH)
+	{
+		font->defaultGlyph = font->asciiLookup['?'];
+	}
+	if(font->defaultGlyph == BL_BITMAPFONT_NO_GLYPH)
+	{
+		font->defaultGlyph = 0;
+	}
+
+	//send atlas down to openGL
+	if(reader.atlasData != NULL)
+	{
+		font->atlas = BLCreateTexHandleFree(reader.atlasData, font->atlasH, font->atlasW);
+		free(reader.atlasData);
+	}
+
+	//end
+	return font;
+}
+
+/*************************************************************
+* NAME: BLDestroyBitmapFont
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBitmapFont* font -> font to free
+* RETURNS:
+*	void
+* NOTE:
+*	Frees the font from both CPU and GPU
+*************************************************************/
+void BLDestroyBitmapFont(BLBitmapFont* font)
+{
+	//check if null
+	if(font == NULL)
+	{
+		return;
+	}
+
+	//free atlas and glyphs
+	if(font->atlas != 0)
+	{
+		BLDestroyTexHandle(font->atlas);
+	}
+	free(font->glyphs);
+	free(font->bits);
+	free(font);
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLGetBitmapGlyph
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLBitmapFont* font -> font to search
+*	BLUInt codepoint -> codepoint to find
+* RETURNS:
+*	const BLBitmapGlyph* of the codepoint, the default glyph if
+*	the font doesn't have it
+* NOTE: N/A
+*************************************************************/
+const BLBitmapGlyph* BLGetBitmapGlyph(const BLBitmapFont* font, BLUInt codepoint)
+{
+	//get glyph index
+	BLInt index = (codepoint < BL_BITMAPFONT_ASCII_SIZE) ? font->asciiLookup[codepoint] : BLHelperFindGlyph(font, codepoint);
+
+	//missing glyph
+	if(index == BL_BITMAPFONT_NO_GLYPH)
+	{
+		index = font->defaultGlyph;
+	}
+
+	//end
+	return &font->glyphs[index];
+}
\ No newline at end of file
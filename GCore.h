@@ -45,6 +45,26 @@ enum BL_TARGET_FIXEDTEX_TYPE
 	BL_TARGET_FIXEDTEX_TYPE_LARGE = 2
 };
 
+/*************************************************************
+* NAME: BL_TEX_FILTER
+* DATE: 2026 - 10 - 19
+* NOTE: This enum is used for the BLSetTexHandleFilter function
+*************************************************************/
+enum BL_TEX_FILTER
+{
+	BL_TEX_FILTER_NEAREST = 0,
+	BL_TEX_FILTER_LINEAR  = 1
+};
+
+/*************************************************************
+* NAME: BLBlendHook
+* DATE: 2026 - 10 - 19
+* NOTE:
+*	Sets the blend function in place of the default
+*	(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA), see BLSetBlendHook
+*************************************************************/
+typedef void (*BLBlendHook)(void);
+
 /*************************************************************
 * NAME: BLVert2f
 * DATE: 2021 - 08 - 27
@@ -136,6 +156,23 @@ typedef struct BLFixedTexLarge
 	BLByte data[BL_FIXEDTEX_SIZE_LARGE][BL_FIXEDTEX_SIZE_LARGE][BL_FIXEDTEX_COLOR_CHANNELS];
 } BLFixedTexLarge;
 
+/*************************************************************
+* NAME: BLCullStats
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLUInt drawn  -> quads sent to openGL
+*	BLUInt culled -> quads rejected before being sent
+*	BLUInt culledLines -> string lines rejected without being
+*	laid out
+* NOTE: N/A
+*************************************************************/
+typedef struct BLCullStats
+{
+	BLUInt drawn;
+	BLUInt culled;
+	BLUInt culledLines;
+} BLCullStats;
+
 /*************************************************************
 * NAME: BLCreateVert2f
 * DATE: 2021 - 08 - 27
@@ -258,6 +295,37 @@ void BLDestroyTexHandle(BLTextureHandle texToFree);
 *************************************************************/
 BLTextureHandle BLCreateTexHandleFree(void* textureData, BLUInt texSizeHeight, BLUInt texSizeWidth);
 
+/*************************************************************
+* NAME: BLSetTexHandleFilter
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLTextureHandle texHndl   -> texture to change
+*	enum BL_TEX_FILTER filter -> filtering to use
+* RETURNS:
+*	void
+* NOTE:
+*	Textures are created with BL_TEX_FILTER_NEAREST
+*************************************************************/
+void BLSetTexHandleFilter(BLTextureHandle texHndl, enum BL_TEX_FILTER filter);
+
+/*************************************************************
+* NAME: BLUpdateTexHandleRegion
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLTextureHandle texHndl -> texture to change
+*	void* textureData -> RGBA data of the region
+*	BLUInt X -> left of the region
+*	BLUInt Y -> bottom of the region
+*	BLUInt width  -> width of the region
+*	BLUInt height -> height of the region
+* RETURNS:
+*	void
+* NOTE:
+*	Only the region is sent to openGL, the region has to be
+*	inside of the texture
+*************************************************************/
+void BLUpdateTexHandleRegion(BLTextureHandle texHndl, void* textureData, BLUInt X, BLUInt Y, BLUInt width, BLUInt height);
+
 /*************************************************************
 * NAME: BLRenderTextureSquare
 * DATE: 2021 - 08 - 28
@@ -313,4 +381,121 @@ void BLRenderTextureQuad(BLTextureHandle texHndl, BLQuad texQuad, float scale, f
 *************************************************************/
 void BLClearBuffers(BLByte R, BLByte G, BLByte B, BLByte A);
 
+/*************************************************************
+* NAME: BLSetupBlend
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Enables blending and sets the blend function, every alpha
+*	blended draw calls this instead of glBlendFunc
+*************************************************************/
+void BLSetupBlend( );
+
+/*************************************************************
+* NAME: BLSetBlendHook
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlendHook hook -> function BLSetupBlend calls (NULL for
+*	the default blend function)
+* RETURNS:
+*	void
+* NOTE:
+*	Lets render targets that keep their own alpha (like
+*	ILayer) change how everything is blended into them. Flush
+*	any batched quads first
+*************************************************************/
+void BLSetBlendHook(BLBlendHook hook);
+
+/*************************************************************
+* NAME: BLSetClipRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLRect clipRect -> clip rect in pixels (X and Y are the
+*	bottom left)
+* RETURNS:
+*	void
+* NOTE:
+*	Everything drawn after is cut to clipRect, everything fully
+*	outside of it is culled. Flush any batched quads first.
+*	clipRect is relative to the viewport, so it is offset with
+*	it (inside an ILayer it stays in screenspace)
+*************************************************************/
+void BLSetClipRect(BLRect clipRect);
+
+/*************************************************************
+* NAME: BLClearClipRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Only the viewport culls after this
+*************************************************************/
+void BLClearClipRect( );
+
+/*************************************************************
+* NAME: BLGetClipRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLRect* clipRect -> set to the clip rect (if there is one)
+* RETURNS:
+*	int, 1 if a clip rect is set, 0 if not
+* NOTE: N/A
+*************************************************************/
+int BLGetClipRect(BLRect* clipRect);
+
+/*************************************************************
+* NAME: BLGetVisibleRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLRect, part of the viewport inside of the clip rect in
+*	pixels (X and Y are the bottom left)
+* NOTE:
+*	Anything fully outside of this rect can be culled
+*************************************************************/
+BLRect BLGetVisibleRect( );
+
+/*************************************************************
+* NAME: BLAddCullStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt drawn  -> quads drawn
+*	BLUInt culled -> quads culled
+*	BLUInt culledLines -> string lines culled
+* RETURNS:
+*	void
+* NOTE:
+*	For renderers that cull against BLGetVisibleRect themselves
+*************************************************************/
+void BLAddCullStats(BLUInt drawn, BLUInt culled, BLUInt culledLines);
+
+/*************************************************************
+* NAME: BLGetCullStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLCullStats of every BLRenderTexture* and BLIRender* call
+* NOTE: N/A
+*************************************************************/
+BLCullStats BLGetCullStats( );
+
+/*************************************************************
+* NAME: BLResetCullStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Call once per frame to get per frame counts
+*************************************************************/
+void BLResetCullStats( );
+
 #endif
\ No newline at end of file
@@ -9,6 +9,8 @@
 *	Source file for basic rendering functions
 * CONTENTS:
 *	- Includes
+*	- Backend struct defs
+*	- Backend objects
 *	- File-Specifc functions
 *	- Functions
 *
@@ -17,6 +19,7 @@
 
 #include <stdio.h>  // For I/O
 #include <stdlib.h> // For memory management
+#include <math.h>   // For rotated bounds
 
 #include <Windows.h> // OpenGL dependency
 #include <gl/GL.h>   // Graphics library
@@ -24,6 +27,41 @@
 
 #include "GCore.h" // Header
 
+/*************************************************************
+* NAME: BLClipState
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	int hasClip     -> 1 if clipRect is used
+*	BLRect clipRect -> clip rect in pixels
+*	BLCullStats stats -> counters
+* NOTE: File specific struct
+*************************************************************/
+typedef struct BLClipState
+{
+	int         hasClip;
+	BLRect      clipRect;
+	BLCullStats stats;
+}BLClipState;
+
+/*************************************************************
+* NAME: clipState (object)
+* DATE: 2026 - 10 - 19
+* USE:
+*	Holds the clip rect and cull counters for every renderer
+* NOTE: N/A
+*************************************************************/
+static BLClipState clipState = { 0 };
+
+/*************************************************************
+* NAME: blendHook (object)
+* DATE: 2026 - 10 - 19
+* USE:
+*	Sets the blend function for BLSetupBlend, NULL for the
+*	default
+* NOTE: N/A
+*************************************************************/
+static BLBlendHook blendHook = NULL;
+
 /*************************************************************
 * NAME: BLHelperSetupTexEnv
 * DATE: 2021 - 08 - 28
@@ -79,6 +117,82 @@ static inline void BLHelperSetupProjectionMatrix( )
 }
 
 
+/*************************************************************
+* NAME: BLHelperVisibleRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const int* viewPortDimensions -> viewport from openGL
+* RETURNS:
+*	BLRect, viewport inside of the clip rect (pixels)
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static BLRect BLHelperVisibleRect(const int* viewPortDimensions)
+{
+	//start with whole viewport
+	float minX = 0.0f;
+	float minY = 0.0f;
+	float maxX = (float)viewPortDimensions[2];
+	float maxY = (float)viewPortDimensions[3];
+
+	//cut to clip rect
+	if(clipState.hasClip)
+	{
+		const BLRect clip = clipState.clipRect;
+		minX = (clip.X > minX) ? clip.X : minX;
+		minY = (clip.Y > minY) ? clip.Y : minY;
+		maxX = (clip.X + clip.width  < maxX) ? clip.X + clip.width  : maxX;
+		maxY = (clip.Y + clip.height < maxY) ? clip.Y + clip.height : maxY;
+	}
+
+	//end
+	return BLCreateRect(minX, minY, (maxX > minX) ? maxX - minX : 0.0f, (maxY > minY) ? maxY - minY : 0.0f);
+}
+
+/*************************************************************
+* NAME: BLHelperCullWorld
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	float minX -> left of the drawn bounds (worldspace)
+*	float minY -> bottom of the drawn bounds
+*	float maxX -> right of the drawn bounds
+*	float maxY -> top of the drawn bounds
+* RETURNS:
+*	int, 1 if the bounds can't be seen, 0 if they can
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Worldspace matches BLHelperSetupProjectionMatrix. Counts
+*	the result in the cull stats
+*************************************************************/
+static int BLHelperCullWorld(float minX, float minY, float maxX, float maxY)
+{
+	//var to get viewport dimensions
+	//0 -> X, 1 -> Y, 2 -> width, 3 -> height
+	int viewPortDimensions[4];
+	glGetIntegerv(GL_VIEWPORT, viewPortDimensions);
+	if(viewPortDimensions[2] <= 0 || viewPortDimensions[3] <= 0)
+	{
+		return 0;
+	}
+
+	//get visible rect in worldspace
+	const float  aspectRatio = (float)viewPortDimensions[2] / (float)viewPortDimensions[3];
+	const BLRect visible     = BLHelperVisibleRect(viewPortDimensions);
+	const float  toWorldX    = (2.0f * aspectRatio) / (float)viewPortDimensions[2];
+	const float  toWorldY    = 2.0f / (float)viewPortDimensions[3];
+	const float  visMinX     = (visible.X * toWorldX) - aspectRatio;
+	const float  visMinY     = (visible.Y * toWorldY) - 1.0f;
+	const float  visMaxX     = visMinX + (visible.width  * toWorldX);
+	const float  visMaxY     = visMinY + (visible.height * toWorldY);
+
+	//check overlap
+	const int culled = (maxX <= visMinX || minX >= visMaxX || maxY <= visMinY || minY >= visMaxY);
+	BLAddCullStats(culled == 0, culled != 0, 0);
+
+	//end
+	return culled;
+}
+
 /*************************************************************
 * NAME: BLCreateVert2f
 * DATE: 2021 - 08 - 27
@@ -262,6 +376,58 @@ BLTextureHandle BLCreateTexHandleFree(void* textureData, BLUInt texSizeHeight, B
 	return texHndl;
 }
 
+/*************************************************************
+* NAME: BLSetTexHandleFilter
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLTextureHandle texHndl   -> texture to change
+*	enum BL_TEX_FILTER filter -> filtering to use
+* RETURNS:
+*	void
+* NOTE:
+*	Textures are created with BL_TEX_FILTER_NEAREST
+*************************************************************/
+void BLSetTexHandleFilter(BLTextureHandle texHndl, enum BL_TEX_FILTER filter)
+{
+	//get GL filter
+	GLint glFilter = (filter == BL_TEX_FILTER_LINEAR) ? GL_LINEAR : GL_NEAREST;
+
+	//bind texture and set filtering parameters
+	glBindTexture(GL_TEXTURE_2D, (GLuint)texHndl);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, glFilter);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, glFilter);
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLUpdateTexHandleRegion
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLTextureHandle texHndl -> texture to change
+*	void* textureData -> RGBA data of the region
+*	BLUInt X -> left of the region
+*	BLUInt Y -> bottom of the region
+*	BLUInt width  -> width of the region
+*	BLUInt height -> height of the region
+* RETURNS:
+*	void
+* NOTE:
+*	Only the region is sent to openGL, the region has to be
+*	inside of the texture
+*************************************************************/
+void BLUpdateTexHandleRegion(BLTextureHandle texHndl, void* textureData, BLUInt X, BLUInt Y, BLUInt width, BLUInt height)
+{
+	//bind texture and pack region
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glBindTexture(GL_TEXTURE_2D, (GLuint)texHndl);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, X, Y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, textureData);
+
+	//end
+	return;
+}
+
 /*************************************************************
 * NAME: BLCreateTexHandleFixed
 * DATE: 2021 - 08 - 28
@@ -328,6 +494,13 @@ void BLDestroyTexHandle(BLTextureHandle texToFree)
 *************************************************************/
 void BLRenderTextureSquare(BLTextureHandle texHndl, float posX, float posY, float scale, float angle)
 {
+	//cull (rotated squares reach out to the corner)
+	const float reach = fabsf(scale) * ((angle != 0.0f) ? 1.41422f : 1.0f);
+	if(BLHelperCullWorld(posX - reach, posY - reach, posX + reach, posY + reach))
+	{
+		return;
+	}
+
 	//set up texture environment
 	BLHelperSetupTexEnv(texHndl);
 
@@ -349,8 +522,7 @@ void BLRenderTextureSquare(BLTextureHandle texHndl, float posX, float posY, floa
 	//draw square
 	glEnable(GL_TEXTURE_2D);
 
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	BLSetupBlend( );
 
 	glBegin(GL_QUADS);
 
@@ -385,6 +557,19 @@ void BLRenderTextureRect(BLTextureHandle texHndl, BLRect texRect, float scale, f
 	const float scaleX = texRect.width;
 	const float scaleY = texRect.height;
 
+	//cull (rotated rects reach out to the corner)
+	float reachX = fabsf(scaleX * scale);
+	float reachY = fabsf(scaleY * scale);
+	if(angle != 0.0f)
+	{
+		reachX = sqrtf((reachX * reachX) + (reachY * reachY));
+		reachY = reachX;
+	}
+	if(BLHelperCullWorld(texRect.X - reachX, texRect.Y - reachY, texRect.X + reachX, texRect.Y + reachY))
+	{
+		return;
+	}
+
 	//set up texture environment
 	BLHelperSetupTexEnv(texHndl);
 
@@ -406,8 +591,7 @@ void BLRenderTextureRect(BLTextureHandle texHndl, BLRect texRect, float scale, f
 	//draw rectangle
 	glEnable(GL_TEXTURE_2D);
 
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	BLSetupBlend( );
 	
 	glBegin(GL_QUADS);
 	glTexCoord2f(0, 0); glVertex2f(-1 * scaleX, -1 * scaleY);
@@ -437,6 +621,42 @@ void BLRenderTextureRect(BLTextureHandle texHndl, BLRect texRect, float scale, f
 *************************************************************/
 void BLRenderTextureQuad(BLTextureHandle texHndl, BLQuad texQuad, float scale, float angle)
 {
+	//get quad bounds
+	const BLVert2f points[4] = { texQuad.p0, texQuad.p1, texQuad.p2, texQuad.p3 };
+	float minX = points[0].X, maxX = points[0].X;
+	float minY = points[0].Y, maxY = points[0].Y;
+	float reach = 0.0f;
+	for(int i = 0; i < 4; i++)
+	{
+		minX = (points[i].X < minX) ? points[i].X : minX;
+		maxX = (points[i].X > maxX) ? points[i].X : maxX;
+		minY = (points[i].Y < minY) ? points[i].Y : minY;
+		maxY = (points[i].Y > maxY) ? points[i].Y : maxY;
+
+		const float pointReach = sqrtf((points[i].X * points[i].X) + (points[i].Y * points[i].Y));
+		reach = (pointReach > reach) ? pointReach : reach;
+	}
+
+	//cull (rotated quads reach out to their furthest point)
+	int culled;
+	if(angle != 0.0f)
+	{
+		reach *= fabsf(scale);
+		culled = BLHelperCullWorld(texQuad.X - reach, texQuad.Y - reach, texQuad.X + reach, texQuad.Y + reach);
+	}
+	else if(scale >= 0.0f)
+	{
+		culled = BLHelperCullWorld(texQuad.X + (minX * scale), texQuad.Y + (minY * scale), texQuad.X + (maxX * scale), texQuad.Y + (maxY * scale));
+	}
+	else
+	{
+		culled = BLHelperCullWorld(texQuad.X + (maxX * scale), texQuad.Y + (maxY * scale), texQuad.X + (minX * scale), texQuad.Y + (minY * scale));
+	}
+	if(culled)
+	{
+		return;
+	}
+
 	//set up texture environment
 	BLHelperSetupTexEnv(texHndl);
 
@@ -458,8 +678,7 @@ void BLRenderTextureQuad(BLTextureHandle texHndl, BLQuad texQuad, float scale, f
 	//draw quad
 	glEnable(GL_TEXTURE_2D);
 
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	BLSetupBlend( );
 
 	glBegin(GL_QUADS);
 	glTexCoord2f(0, 0); glVertex2f(texQuad.p0.X, texQuad.p0.Y);
@@ -503,4 +722,188 @@ void BLClearBuffers(BLByte R, BLByte G, BLByte B, BLByte A)
 
 	//end
 	return;
-}
\ No newline at end of file
+}
+
+/*************************************************************
+* NAME: BLSetupBlend
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Enables blending and sets the blend function, every alpha
+*	blended draw calls this instead of glBlendFunc
+*************************************************************/
+void BLSetupBlend( )
+{
+	glEnable(GL_BLEND);
+	if(blendHook != NULL)
+	{
+		blendHook( );
+	}
+	else
+	{
+		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	}
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLSetBlendHook
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlendHook hook -> function BLSetupBlend calls (NULL for
+*	the default blend function)
+* RETURNS:
+*	void
+* NOTE:
+*	Lets render targets that keep their own alpha (like
+*	ILayer) change how everything is blended into them. Flush
+*	any batched quads first
+*************************************************************/
+void BLSetBlendHook(BLBlendHook hook)
+{
+	blendHook = hook;
+	return;
+}
+
+/*************************************************************
+* NAME: BLSetClipRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLRect clipRect -> clip rect in pixels (X and Y are the
+*	bottom left)
+* RETURNS:
+*	void
+* NOTE:
+*	Everything drawn after is cut to clipRect, everything fully
+*	outside of it is culled. Flush any batched quads first.
+*	clipRect is relative to the viewport, so it is offset with
+*	it (inside an ILayer it stays in screenspace)
+*************************************************************/
+void BLSetClipRect(BLRect clipRect)
+{
+	clipState.hasClip  = 1;
+	clipState.clipRect = clipRect;
+
+	//cut partly visible quads on the GPU
+	//remember: the scissor box is in framebuffer pixels, not viewport pixels
+	GLint view[4];
+	glGetIntegerv(GL_VIEWPORT, view);
+	glScissor((GLint)clipRect.X + view[0], (GLint)clipRect.Y + view[1], (GLsizei)clipRect.width, (GLsizei)clipRect.height);
+	glEnable(GL_SCISSOR_TEST);
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLClearClipRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Only the viewport culls after this
+*************************************************************/
+void BLClearClipRect( )
+{
+	clipState.hasClip = 0;
+	glDisable(GL_SCISSOR_TEST);
+	return;
+}
+
+/*************************************************************
+* NAME: BLGetClipRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLRect* clipRect -> set to the clip rect (if there is one)
+* RETURNS:
+*	int, 1 if a clip rect is set, 0 if not
+* NOTE: N/A
+*************************************************************/
+int BLGetClipRect(BLRect* clipRect)
+{
+	if(clipState.hasClip)
+	{
+		*clipRect = clipState.clipRect;
+	}
+
+	return clipState.hasClip;
+}
+
+/*************************************************************
+* NAME: BLGetVisibleRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLRect, part of the viewport inside of the clip rect in
+*	pixels (X and Y are the bottom left)
+* NOTE:
+*	Anything fully outside of this rect can be culled
+*************************************************************/
+BLRect BLGetVisibleRect( )
+{
+	//var to get viewport dimensions
+	//0 -> X, 1 -> Y, 2 -> width, 3 -> height
+	int viewPortDimensions[4];
+	glGetIntegerv(GL_VIEWPORT, viewPortDimensions);
+
+	return BLHelperVisibleRect(viewPortDimensions);
+}
+
+/*************************************************************
+* NAME: BLAddCullStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt drawn  -> quads drawn
+*	BLUInt culled -> quads culled
+*	BLUInt culledLines -> string lines culled
+* RETURNS:
+*	void
+* NOTE:
+*	For renderers that cull against BLGetVisibleRect themselves
+*************************************************************/
+void BLAddCullStats(BLUInt drawn, BLUInt culled, BLUInt culledLines)
+{
+	clipState.stats.drawn       += drawn;
+	clipState.stats.culled      += culled;
+	clipState.stats.culledLines += culledLines;
+	return;
+}
+
+/*************************************************************
+* NAME: BLGetCullStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLCullStats of every BLRenderTexture* and BLIRender* call
+* NOTE: N/A
+*************************************************************/
+BLCullStats BLGetCullStats( )
+{
+	return clipState.stats;
+}
+
+/*************************************************************
+* NAME: BLResetCullStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Call once per frame to get per frame counts
+*************************************************************/
+void BLResetCullStats( )
+{
+	BLCullStats empty = { 0 };
+	clipState.stats = empty;
+	return;
+}
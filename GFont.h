@@ -24,6 +24,21 @@
 #define BL_GFONT_MAX_VBUF_SIZE   0x80
 #define BL_GFONT_FONT_COUNT      0x80
 #define BL_GFONT_FONTSET_COUNT   0x10
+#define BL_GFONT_GLYPH_COUNT     62
+
+#define BL_GFONT_ATLAS_CELL       8  // pixels per atlas cell (glyph + padding)
+#define BL_GFONT_ATLAS_CELLS      8  // cells per atlas row
+#define BL_GFONT_ATLAS_SIZE       (BL_GFONT_ATLAS_CELL * BL_GFONT_ATLAS_CELLS)
+#define BL_GFONT_ATLAS_WHITE_CELL 63 // fully white cell for untextured quads
+
+#define BL_GFONT_SDF_UNIT   4    // SDF texels per glyph pixel
+#define BL_GFONT_SDF_PAD    6    // SDF texels around each glyph
+#define BL_GFONT_SDF_CELL   ((BL_FIXEDTEX_SIZE_FONT * BL_GFONT_SDF_UNIT) + (BL_GFONT_SDF_PAD * 2))
+#define BL_GFONT_SDF_SIZE   (BL_GFONT_SDF_CELL * BL_GFONT_ATLAS_CELLS)
+#define BL_GFONT_SDF_SPREAD 1.5f // distance (in glyph pixels) that maps to the full alpha range
+
+#define BL_GFONT_TEX_SPACING      1 // glyph pixels between letters
+#define BL_GFONT_TEX_LINE_SPACING 2 // glyph pixels between lines
 
 #define BL_GFONT_WHITE    255, 255, 255, 255
 #define BL_GFONT_BLACK    000, 000, 000, 255
@@ -99,6 +114,13 @@
 
 typedef uint8_t BLCIndex;
 
+/*************************************************************
+* BLGlyphMask holds the 5x5 bitmap of a glyph, one bit per
+* pixel. Pixel (X, Y) is bit (Y * 5 + X), Y = 0 is the bottom
+* row (same as the font textures)
+*************************************************************/
+typedef uint32_t BLGlyphMask;
+
 /*************************************************************
 * IMPORTANT:
 *	BLFChar is NOT meant to represent ASCII
@@ -371,4 +393,116 @@ BLTextureHandle BLGetFontTextureHandle(BLByte character, enum BL_GFONT_TYPE fTyp
 *************************************************************/
 void BLPrintAllFontsTextureHandles( );
 
+/*************************************************************
+* NAME: BLGetGlyphMask
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLByte character -> ASCII equiv of BTIS character
+* RETURNS:
+*	BLGlyphMask of the character
+* NOTE:
+*	Does NOT need BLInitGFont or a rendering context, the masks
+*	are built from the VSTRs on first use
+*************************************************************/
+BLGlyphMask BLGetGlyphMask(BLByte character);
+
+/*************************************************************
+* NAME: BLEditTexDrawString
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	void* tex      -> RGBA texture data to draw on
+*	BLUInt texW    -> width of texture
+*	BLUInt texH    -> height of texture
+*	const BLByte* str -> string to draw
+*	BLUInt x       -> top left X position of string (in Pixels)
+*	BLUInt y       -> top left Y position of string (in Pixels)
+*	BLUInt scale   -> size of each glyph pixel (in Pixels)
+*	BLColor sColor -> color of string (alpha is blended)
+* RETURNS:
+*	int, 1 for success, 0 for string out of texture bounds
+* NOTE:
+*	Rasterizes on the CPU, so no rendering context is needed.
+*	Y goes up like openGL, so newlines move the string down.
+*	Works on fixed textures too (pass their size)
+*************************************************************/
+int BLEditTexDrawString(void* tex, BLUInt texW, BLUInt texH, const BLByte* str, BLUInt x, BLUInt y, BLUInt scale, BLColor sColor);
+
+/*************************************************************
+* NAME: BLGetFontAtlasHandle
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLTextureHandle of the font atlas
+* NOTE:
+*	The atlas holds every BTIS glyph in WHITE, so it is meant to
+*	be tinted (GL_MODULATE) with BLGetFontColor. Call BLInitGFont
+*	to use this function
+*************************************************************/
+BLTextureHandle BLGetFontAtlasHandle( );
+
+/*************************************************************
+* NAME: BLGetFontAtlasRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLByte character -> ASCII equiv of BTIS character
+* RETURNS:
+*	BLRect of the glyph's texture coords in the font atlas
+*	(X and Y are the bottom left)
+* NOTE: N/A
+*************************************************************/
+BLRect BLGetFontAtlasRect(BLByte character);
+
+/*************************************************************
+* NAME: BLGetFontAtlasWhiteRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLRect of the texture coords of a fully white atlas cell
+* NOTE:
+*	Used for drawing untextured quads with the atlas bound
+*************************************************************/
+BLRect BLGetFontAtlasWhiteRect( );
+
+/*************************************************************
+* NAME: BLGetFontColor
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	enum BL_GFONT_TYPE fType -> type of font
+* RETURNS:
+*	BLColor that the font type is drawn with
+* NOTE: N/A
+*************************************************************/
+BLColor BLGetFontColor(enum BL_GFONT_TYPE fType);
+
+/*************************************************************
+* NAME: BLGetFontSDFHandle
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLTextureHandle of the signed distance field font atlas
+* NOTE:
+*	Every glyph is stored as a WHITE distance field in the alpha
+*	channel (0.5 is the glyph's edge). Draw it with linear
+*	filtering and an alpha test of 0.5 for crisp text at any
+*	scale. Call BLInitGFont to use this function
+*************************************************************/
+BLTextureHandle BLGetFontSDFHandle( );
+
+/*************************************************************
+* NAME: BLGetFontSDFRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLByte character -> ASCII equiv of BTIS character
+* RETURNS:
+*	BLRect of the glyph's texture coords in the SDF atlas
+*	(X and Y are the bottom left)
+* NOTE:
+*	The rect covers the same 5x5 area as BLGetFontAtlasRect, so
+*	both atlases can be drawn with the same quads
+*************************************************************/
+BLRect BLGetFontSDFRect(BLByte character);
+
 #endif
\ No newline at end of file
@@ -20,6 +20,7 @@
 #include <stdio.h>  // I/O
 #include <stdlib.h> // Memory management
 #include <string.h> // For string parsing
+#include <math.h>   // For distance fields
 #include <glfw3.h>  // For making sure a window context exists
 
 #include "GFont.h"  // Header
@@ -335,7 +336,9 @@ typedef struct BLFontSet
 *************************************************************/
 typedef struct BLFonts
 {
-	BLFontSet fonts[BL_GFONT_FONTSET_COUNT];
+	BLFontSet       fonts[BL_GFONT_FONTSET_COUNT];
+	BLTextureHandle atlas;
+	BLTextureHandle sdfAtlas;
 }BLFonts;
 
 /*************************************************************
@@ -348,6 +351,90 @@ typedef struct BLFonts
 *************************************************************/
 static BLFonts* allFonts = NULL;
 
+/*************************************************************
+* NAME: glyphVStrs (object)
+* DATE: 2026 - 10 - 19
+* USE:
+*	Every VSTR in BTIS order, index N is the VSTR of BTIS
+*	character N
+* NOTE: N/A
+*************************************************************/
+static const char* const glyphVStrs[BL_GFONT_GLYPH_COUNT] =
+{
+	//numbers
+	BL_VSTR_ZERO, BL_VSTR_ONE, BL_VSTR_TWO, BL_VSTR_THREE, BL_VSTR_FOUR, // 4
+	BL_VSTR_FIVE, BL_VSTR_SIX, BL_VSTR_SEVEN, BL_VSTR_EIGHT, BL_VSTR_NINE, // 9
+
+	//letters
+	BL_VSTR_A, BL_VSTR_B, BL_VSTR_C, BL_VSTR_D, BL_VSTR_E, BL_VSTR_F, // 15
+	BL_VSTR_G, BL_VSTR_H, BL_VSTR_I, BL_VSTR_J, BL_VSTR_K, BL_VSTR_L, // 21
+	BL_VSTR_M, BL_VSTR_N, BL_VSTR_O, BL_VSTR_P, BL_VSTR_Q, BL_VSTR_R, // 27
+	BL_VSTR_S, BL_VSTR_T, BL_VSTR_U, BL_VSTR_V, BL_VSTR_W, BL_VSTR_X, // 33
+	BL_VSTR_Y, BL_VSTR_Z,                                             // 35
+
+	//symbols
+	BL_VSTR_SPACE, BL_VSTR_EXCLAIM, BL_VSTR_HASHTAG, BL_VSTR_DOLLAR,          // 39
+	BL_VSTR_PERCENT, BL_VSTR_AND, BL_VSTR_APOSTROPHE, BL_VSTR_BRACEOPEN,      // 43
+	BL_VSTR_BRACECLOSE, BL_VSTR_ASTERISK, BL_VSTR_PLUS, BL_VSTR_COMMA,        // 47
+	BL_VSTR_MINUS, BL_VSTR_PERIOD, BL_VSTR_SLASH,                             // 50
+
+	//extra symbols
+	BL_VSTR_QUESTION, BL_VSTR_OPEN_JAG, BL_VSTR_CLOSE_JAG, BL_VSTR_COLON,     // 54
+	BL_VSTR_EQUAL, BL_VSTR_SEMICOLON, BL_VSTR_QUOTE, BL_VSTR_OPEN_BOX,        // 58
+	BL_VSTR_CLOSE_BOX, BL_VSTR_OPEN_CURL, BL_VSTR_CLOSE_CURL                  // 61
+};
+
+/*************************************************************
+* NAME: glyphMasks (object)
+* DATE: 2026 - 10 - 19
+* USE:
+*	Bitmasks of every BTIS character, built from glyphVStrs
+*	by BLHelperBuildGlyphMasks
+* NOTE: N/A
+*************************************************************/
+static BLGlyphMask glyphMasks[BL_GFONT_GLYPH_COUNT];
+static int         glyphMasksBuilt = 0;
+
+/*************************************************************
+* NAME: BLHelperBuildGlyphMasks
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Parses every VSTR into glyphMasks, only runs once
+*************************************************************/
+static void BLHelperBuildGlyphMasks( )
+{
+	//check if already built
+	if(glyphMasksBuilt)
+	{
+		return;
+	}
+
+	//parse each VSTR 2 bytes at a time
+	for(int i = 0; i < BL_GFONT_GLYPH_COUNT; i++)
+	{
+		const char* vStr = glyphVStrs[i];
+		BLGlyphMask mask = 0;
+
+		for(int j = 0; vStr[j] != 0 && vStr[j + 1] != 0; j += 2)
+		{
+			int pX = vStr[j + 0] - '0';
+			int pY = vStr[j + 1] - '0';
+			mask |= (BLGlyphMask)1 << ((pY * BL_FIXEDTEX_SIZE_FONT) + pX);
+		}
+
+		glyphMasks[i] = mask;
+	}
+
+	//end
+	glyphMasksBuilt = 1;
+	return;
+}
+
 /*************************************************************
 * NAME: BLHelperCreateFontSet
 * DATE: 2021 - 08 - 30
@@ -360,80 +447,219 @@ static BLFonts* allFonts = NULL;
 *************************************************************/
 static inline BLFontSet BLHelperCreateFontSet(BLColor fColor)
 {
-	//fontset object for filling
-	BLFontSet fontSet;
+	//fontset object for filling (unused slots stay 0)
+	BLFontSet fontSet = { 0 };
 
-	//get pointer to fontSet's fTexList member
-	BLTextureHandle* tBuf = fontSet.fTexList;
+	//fill every BTIS character in order
+	for(int i = 0; i < BL_GFONT_GLYPH_COUNT; i++)
+	{
+		fontSet.fTexList[i] = BLCreateTexHandleVStr((const BLByte*)glyphVStrs[i], BLCreateColor(0, 0, 0, 0), fColor);
+	}
 
-	//counter var
-	int counter = 0;
-
-	//define local macro
-	#define BLFillTBuf(vStr) tBuf[counter] = BLCreateTexHandleVStr(vStr, BLCreateColor(0, 0, 0, 0), fColor); counter++;
-	
-	//fill numbers
-	BLFillTBuf(BL_VSTR_ZERO ); // 0
-	BLFillTBuf(BL_VSTR_ONE  ); // 1
-	BLFillTBuf(BL_VSTR_TWO  ); // 2
-	BLFillTBuf(BL_VSTR_THREE); // 3
-	BLFillTBuf(BL_VSTR_FOUR ); // 4
-	BLFillTBuf(BL_VSTR_FIVE ); // 5
-	BLFillTBuf(BL_VSTR_SIX  ); // 6
-	BLFillTBuf(BL_VSTR_SEVEN); // 7
-	BLFillTBuf(BL_VSTR_EIGHT); // 8
-	BLFillTBuf(BL_VSTR_NINE ); // 9
+	//end
+	return fontSet;
+}
 
-	//letters
-	BLFillTBuf(BL_VSTR_A);	BLFillTBuf(BL_VSTR_B); // 11
-	BLFillTBuf(BL_VSTR_C);	BLFillTBuf(BL_VSTR_D); // 13
-	BLFillTBuf(BL_VSTR_E);	BLFillTBuf(BL_VSTR_F); // 15
-	BLFillTBuf(BL_VSTR_G);	BLFillTBuf(BL_VSTR_H); // 17
-	BLFillTBuf(BL_VSTR_I);	BLFillTBuf(BL_VSTR_J); // 19
-	BLFillTBuf(BL_VSTR_K);	BLFillTBuf(BL_VSTR_L); // 21
-	BLFillTBuf(BL_VSTR_M);	BLFillTBuf(BL_VSTR_N); // 23
-	BLFillTBuf(BL_VSTR_O);	BLFillTBuf(BL_VSTR_P); // 25
-	BLFillTBuf(BL_VSTR_Q);	BLFillTBuf(BL_VSTR_R); // 27
-	BLFillTBuf(BL_VSTR_S);	BLFillTBuf(BL_VSTR_T); // 29
-	BLFillTBuf(BL_VSTR_U);	BLFillTBuf(BL_VSTR_V); // 31
-	BLFillTBuf(BL_VSTR_W);	BLFillTBuf(BL_VSTR_X); // 33
-	BLFillTBuf(BL_VSTR_Y);	BLFillTBuf(BL_VSTR_Z); // 35
+/*************************************************************
+* NAME: BLHelperCreateFontAtlas
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLTextureHandle of the generated atlas
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Packs every glyph mask (in WHITE) into a single texture,
+*	glyph N goes into cell N (left to right, bottom to top).
+*	Cells are padded so that neighbours never bleed
+*************************************************************/
+static BLTextureHandle BLHelperCreateFontAtlas( )
+{
+	//atlas data (transparent white, so tinting works at the edges)
+	static BLByte atlasData[BL_GFONT_ATLAS_SIZE][BL_GFONT_ATLAS_SIZE][BL_FIXEDTEX_COLOR_CHANNELS];
+	for(int i = 0; i < BL_GFONT_ATLAS_SIZE; i++)
+	{
+		for(int j = 0; j < BL_GFONT_ATLAS_SIZE; j++)
+		{
+			atlasData[i][j][0] = 255;
+			atlasData[i][j][1] = 255;
+			atlasData[i][j][2] = 255;
+			atlasData[i][j][3] = 0;
+		}
+	}
 
-	//symbols
-	BLFillTBuf(BL_VSTR_SPACE     ); // 36
-	BLFillTBuf(BL_VSTR_EXCLAIM   ); // 37
-	BLFillTBuf(BL_VSTR_HASHTAG   ); // 38
-	BLFillTBuf(BL_VSTR_DOLLAR    ); // 39
-	BLFillTBuf(BL_VSTR_PERCENT   ); // 40
-	BLFillTBuf(BL_VSTR_AND       ); // 41
-	BLFillTBuf(BL_VSTR_APOSTROPHE); // 42
-	BLFillTBuf(BL_VSTR_BRACEOPEN ); // 43
-	BLFillTBuf(BL_VSTR_BRACECLOSE); // 44
-	BLFillTBuf(BL_VSTR_ASTERISK  ); // 45
-	BLFillTBuf(BL_VSTR_PLUS      ); // 46
-	BLFillTBuf(BL_VSTR_COMMA     ); // 47
-	BLFillTBuf(BL_VSTR_MINUS     ); // 48
-	BLFillTBuf(BL_VSTR_PERIOD    ); // 49
-	BLFillTBuf(BL_VSTR_SLASH     ); // 50
+	//make sure masks exist
+	BLHelperBuildGlyphMasks( );
 
-	//extra symbols
-	BLFillTBuf(BL_VSTR_QUESTION  ); //51
-	BLFillTBuf(BL_VSTR_OPEN_JAG  ); //52
-	BLFillTBuf(BL_VSTR_CLOSE_JAG ); //53
-	BLFillTBuf(BL_VSTR_COLON     ); //54
-	BLFillTBuf(BL_VSTR_EQUAL     ); //55
-	BLFillTBuf(BL_VSTR_SEMICOLON ); //56
-	BLFillTBuf(BL_VSTR_QUOTE     ); //57
-	BLFillTBuf(BL_VSTR_OPEN_BOX  ); //58
-	BLFillTBuf(BL_VSTR_CLOSE_BOX ); //59
-	BLFillTBuf(BL_VSTR_OPEN_CURL ); //60
-	BLFillTBuf(BL_VSTR_CLOSE_CURL); //61
-
-	//undefine macro
-	#undef BLFillTBuf
+	//draw each glyph into its cell
+	for(int i = 0; i < BL_GFONT_GLYPH_COUNT; i++)
+	{
+		int cellX = (i % BL_GFONT_ATLAS_CELLS) * BL_GFONT_ATLAS_CELL;
+		int cellY = (i / BL_GFONT_ATLAS_CELLS) * BL_GFONT_ATLAS_CELL;
+
+		for(int pY = 0; pY < BL_FIXEDTEX_SIZE_FONT; pY++)
+		{
+			for(int pX = 0; pX < BL_FIXEDTEX_SIZE_FONT; pX++)
+			{
+				if(glyphMasks[i] & ((BLGlyphMask)1 << ((pY * BL_FIXEDTEX_SIZE_FONT) + pX)))
+				{
+					atlasData[cellY + pY][cellX + pX][3] = 255;
+				}
+			}
+		}
+	}
+
+	//fill white cell
+	int whiteX = (BL_GFONT_ATLAS_WHITE_CELL % BL_GFONT_ATLAS_CELLS) * BL_GFONT_ATLAS_CELL;
+	int whiteY = (BL_GFONT_ATLAS_WHITE_CELL / BL_GFONT_ATLAS_CELLS) * BL_GFONT_ATLAS_CELL;
+	for(int pY = 0; pY < BL_GFONT_ATLAS_CELL; pY++)
+	{
+		for(int pX = 0; pX < BL_GFONT_ATLAS_CELL; pX++)
+		{
+			atlasData[whiteY + pY][whiteX + pX][3] = 255;
+		}
+	}
 
 	//end
-	return fontSet;
+	return BLCreateTexHandleFree(atlasData, BL_GFONT_ATLAS_SIZE, BL_GFONT_ATLAS_SIZE);
+}
+
+/*************************************************************
+* NAME: BLHelperGlyphMaskAt
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLGlyphMask mask -> glyph to check
+*	int pX -> glyph pixel X
+*	int pY -> glyph pixel Y
+* RETURNS:
+*	int, 1 if the pixel is set, 0 if not (or out of the glyph)
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline int BLHelperGlyphMaskAt(BLGlyphMask mask, int pX, int pY)
+{
+	//check bounds
+	if(pX < 0 || pY < 0 || pX >= BL_FIXEDTEX_SIZE_FONT || pY >= BL_FIXEDTEX_SIZE_FONT)
+	{
+		return 0;
+	}
+
+	//end
+	return (mask >> ((pY * BL_FIXEDTEX_SIZE_FONT) + pX)) & 1;
+}
+
+/*************************************************************
+* NAME: BLHelperCreateGlyphSDF
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLGlyphMask mask -> glyph to convert
+*	BLByte* cellData -> top left of the glyph's cell in the atlas
+*	int rowSize      -> bytes per atlas row
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Writes the signed distance (in alpha) from every texel in
+*	the cell to the glyph's edge. The glyph is a union of pixel
+*	squares, so the exact distance is the distance to the
+*	closest square of the opposite kind
+*************************************************************/
+static void BLHelperCreateGlyphSDF(BLGlyphMask mask, BLByte* cellData, int rowSize)
+{
+	for(int tY = 0; tY < BL_GFONT_SDF_CELL; tY++)
+	{
+		for(int tX = 0; tX < BL_GFONT_SDF_CELL; tX++)
+		{
+			//texel center in glyph pixels
+			const float gX = ((float)tX + 0.5f - (float)BL_GFONT_SDF_PAD) / (float)BL_GFONT_SDF_UNIT;
+			const float gY = ((float)tY + 0.5f - (float)BL_GFONT_SDF_PAD) / (float)BL_GFONT_SDF_UNIT;
+
+			//check which side the texel is on
+			const int inside = BLHelperGlyphMaskAt(mask, (int)floorf(gX), (int)floorf(gY));
+
+			//find closest square of the opposite kind
+			//the ring around the glyph counts as outside, anything
+			//past it is always further away
+			float closest = 1e9f;
+			for(int pY = -1; pY <= BL_FIXEDTEX_SIZE_FONT; pY++)
+			{
+				for(int pX = -1; pX <= BL_FIXEDTEX_SIZE_FONT; pX++)
+				{
+					if(BLHelperGlyphMaskAt(mask, pX, pY) == inside)
+					{
+						continue;
+					}
+
+					const float dX = fmaxf(fmaxf((float)pX - gX, 0.0f), gX - (float)(pX + 1));
+					const float dY = fmaxf(fmaxf((float)pY - gY, 0.0f), gY - (float)(pY + 1));
+					closest = fminf(closest, (dX * dX) + (dY * dY));
+				}
+			}
+
+			//map distance to alpha (inside is above 0.5)
+			float dist  = sqrtf(closest) * (inside ? 1.0f : -1.0f);
+			float alpha = 0.5f + (dist / (BL_GFONT_SDF_SPREAD * 2.0f));
+			alpha = fminf(fmaxf(alpha, 0.0f), 1.0f);
+
+			//write texel
+			BLByte* texel = cellData + (tY * rowSize) + (tX * BL_FIXEDTEX_COLOR_CHANNELS);
+			texel[0] = 255;
+			texel[1] = 255;
+			texel[2] = 255;
+			texel[3] = (BLByte)((alpha * 255.0f) + 0.5f);
+		}
+	}
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLHelperCreateFontSDFAtlas
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLTextureHandle of the generated SDF atlas (linear filtered)
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Same cell order as BLHelperCreateFontAtlas. Glyphs don't
+*	share any texels, so they are generated in parallel when
+*	compiled with openMP
+*************************************************************/
+static BLTextureHandle BLHelperCreateFontSDFAtlas( )
+{
+	//atlas data
+	const int rowSize = BL_GFONT_SDF_SIZE * BL_FIXEDTEX_COLOR_CHANNELS;
+	BLByte* atlasData = calloc(BL_GFONT_SDF_SIZE, rowSize);
+
+	//check if null
+	if(atlasData == NULL)
+	{
+		fprintf(stderr, "Cannot create SDF atlas: memory err\n");
+		return 0;
+	}
+
+	//make sure masks exist
+	BLHelperBuildGlyphMasks( );
+
+	//generate each glyph into its cell
+	#pragma omp parallel for
+	for(int i = 0; i < BL_GFONT_GLYPH_COUNT; i++)
+	{
+		int cellX = (i % BL_GFONT_ATLAS_CELLS) * BL_GFONT_SDF_CELL;
+		int cellY = (i / BL_GFONT_ATLAS_CELLS) * BL_GFONT_SDF_CELL;
+
+		BLHelperCreateGlyphSDF(glyphMasks[i], atlasData + (cellY * rowSize) + (cellX * BL_FIXEDTEX_COLOR_CHANNELS), rowSize);
+	}
+
+	//send down to openGL
+	BLTextureHandle texHndl = BLCreateTexHandleFree(atlasData, BL_GFONT_SDF_SIZE, BL_GFONT_SDF_SIZE);
+	BLSetTexHandleFilter(texHndl, BL_TEX_FILTER_LINEAR);
+
+	//end
+	free(atlasData);
+	return texHndl;
 }
 
 /*************************************************************
@@ -578,6 +804,10 @@ int BLInitGFont( )
 	allFonts->fonts[3] = BLHelperCreateFontSet(BLCreateColor(BL_GFONT_NAVY    ));
 	allFonts->fonts[4] = BLHelperCreateFontSet(BLCreateColor(BL_GFONT_TAN     ));
 
+	//generate atlases
+	allFonts->atlas    = BLHelperCreateFontAtlas( );
+	allFonts->sdfAtlas = BLHelperCreateFontSDFAtlas( );
+
 	//end
 	return 1;
 }
@@ -603,8 +833,13 @@ void BLTerminateGFont()
 		}
 	}
 
+	//free atlases
+	BLDestroyTexHandle(allFonts->atlas);
+	BLDestroyTexHandle(allFonts->sdfAtlas);
+
 	//free allfonts
 	free(allFonts);
+	allFonts = NULL;
 
 	//end
 	return;
@@ -682,4 +917,272 @@ void BLPrintAllFontsTextureHandles( )
 			printf("FONTSET: %d\tFONTNUM: %d\tHANDLE: %d\n", i, j, allFonts->fonts[i].fTexList[j]);
 		}
 	}
+}
+
+/*************************************************************
+* NAME: BLGetGlyphMask
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLByte character -> ASCII equiv of BTIS character
+* RETURNS:
+*	BLGlyphMask of the character
+* NOTE:
+*	Does NOT need BLInitGFont or a rendering context, the masks
+*	are built from the VSTRs on first use
+*************************************************************/
+BLGlyphMask BLGetGlyphMask(BLByte character)
+{
+	//make sure masks exist
+	BLHelperBuildGlyphMasks( );
+
+	//end
+	return glyphMasks[(int)BLHelperConvertASCIItoBTIS(character)];
+}
+
+/*************************************************************
+* NAME: BLEditTexDrawString
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	void* tex      -> RGBA texture data to draw on
+*	BLUInt texW    -> width of texture
+*	BLUInt texH    -> height of texture
+*	const BLByte* str -> string to draw
+*	BLUInt x       -> top left X position of string (in Pixels)
+*	BLUInt y       -> top left Y position of string (in Pixels)
+*	BLUInt scale   -> size of each glyph pixel (in Pixels)
+*	BLColor sColor -> color of string (alpha is blended)
+* RETURNS:
+*	int, 1 for success, 0 for string out of texture bounds
+* NOTE:
+*	Rasterizes on the CPU, so no rendering context is needed.
+*	Y goes up like openGL, so newlines move the string down.
+*	Works on fixed textures too (pass their size)
+*************************************************************/
+int BLEditTexDrawString(void* tex, BLUInt texW, BLUInt texH, const BLByte* str, BLUInt x, BLUInt y, BLUInt scale, BLColor sColor)
+{
+	//make sure masks exist
+	BLHelperBuildGlyphMasks( );
+
+	//precalculate advances (in Pixels)
+	const BLInt glyphSize = (BLInt)scale * BL_FIXEDTEX_SIZE_FONT;
+	const BLInt advanceX  = (BLInt)scale * (BL_FIXEDTEX_SIZE_FONT + BL_GFONT_TEX_SPACING);
+	const BLInt advanceY  = (BLInt)scale * (BL_FIXEDTEX_SIZE_FONT + BL_GFONT_TEX_LINE_SPACING);
+
+	//bottom left of current glyph
+	BLInt drawX = (BLInt)x;
+	BLInt drawY = (BLInt)y - glyphSize + 1;
+
+	//return value
+	int inBounds = 1;
+
+	//draw loop
+	for(int i = 0; str[i] != 0; i++)
+	{
+		//check for newline
+		if(str[i] == '\n')
+		{
+			drawX  = (BLInt)x;
+			drawY -= advanceY;
+			continue;
+		}
+
+		//check if glyph is out of bounds
+		if(drawX < 0 || drawY < 0 || drawX + glyphSize > (BLInt)texW || drawY + glyphSize > (BLInt)texH)
+		{
+			inBounds = 0;
+		}
+
+		//draw each set bit of the glyph as a scale x scale block
+		BLGlyphMask mask = glyphMasks[(int)BLHelperConvertASCIItoBTIS(str[i])];
+		for(int pY = 0; pY < BL_FIXEDTEX_SIZE_FONT && mask != 0; pY++)
+		{
+			for(int pX = 0; pX < BL_FIXEDTEX_SIZE_FONT; pX++)
+			{
+				//skip empty pixels
+				if((mask & ((BLGlyphMask)1 << ((pY * BL_FIXEDTEX_SIZE_FONT) + pX))) == 0)
+				{
+					continue;
+				}
+
+				//fill block (BLEditTexBlendPixFree clamps, negatives wrap and get discarded)
+				for(BLInt bY = 0; bY < (BLInt)scale; bY++)
+				{
+					for(BLInt bX = 0; bX < (BLInt)scale; bX++)
+					{
+						BLInt tX = drawX + (pX * (BLInt)scale) + bX;
+						BLInt tY = drawY + (pY * (BLInt)scale) + bY;
+
+						if(tX >= 0 && tY >= 0)
+						{
+							BLEditTexBlendPixFree(tex, texW, texH, sColor, (BLUInt)tX, (BLUInt)tY);
+						}
+					}
+				}
+			}
+		}
+
+		//increment x
+		drawX += advanceX;
+	}
+
+	//end
+	return inBounds;
+}
+
+/*************************************************************
+* NAME: BLGetFontAtlasHandle
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLTextureHandle of the font atlas
+* NOTE:
+*	The atlas holds every BTIS glyph in WHITE, so it is meant to
+*	be tinted (GL_MODULATE) with BLGetFontColor. Call BLInitGFont
+*	to use this function
+*************************************************************/
+BLTextureHandle BLGetFontAtlasHandle( )
+{
+	//check if null
+	if(allFonts == NULL)
+	{
+		fprintf(stderr, "allfont was null!\n");
+		return 0;
+	}
+
+	//end
+	return allFonts->atlas;
+}
+
+/*************************************************************
+* NAME: BLGetFontAtlasRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLByte character -> ASCII equiv of BTIS character
+* RETURNS:
+*	BLRect of the glyph's texture coords in the font atlas
+*	(X and Y are the bottom left)
+* NOTE: N/A
+*************************************************************/
+BLRect BLGetFontAtlasRect(BLByte character)
+{
+	//get cell
+	int cell = (int)BLHelperConvertASCIItoBTIS(character);
+
+	//size of one texel
+	const float texel = 1.0f / (float)BL_GFONT_ATLAS_SIZE;
+
+	//end
+	return BLCreateRect((float)((cell % BL_GFONT_ATLAS_CELLS) * BL_GFONT_ATLAS_CELL) * texel,
+		(float)((cell / BL_GFONT_ATLAS_CELLS) * BL_GFONT_ATLAS_CELL) * texel,
+		(float)BL_FIXEDTEX_SIZE_FONT * texel, (float)BL_FIXEDTEX_SIZE_FONT * texel);
+}
+
+/*************************************************************
+* NAME: BLGetFontAtlasWhiteRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLRect of the texture coords of a fully white atlas cell
+* NOTE:
+*	Used for drawing untextured quads with the atlas bound
+*************************************************************/
+BLRect BLGetFontAtlasWhiteRect( )
+{
+	//size of one texel
+	const float texel = 1.0f / (float)BL_GFONT_ATLAS_SIZE;
+
+	//use the middle of the cell so that filtering never leaves it
+	return BLCreateRect((float)(((BL_GFONT_ATLAS_WHITE_CELL % BL_GFONT_ATLAS_CELLS) * BL_GFONT_ATLAS_CELL) + 2) * texel,
+		(float)(((BL_GFONT_ATLAS_WHITE_CELL / BL_GFONT_ATLAS_CELLS) * BL_GFONT_ATLAS_CELL) + 2) * texel,
+		(float)(BL_GFONT_ATLAS_CELL - 4) * texel, (float)(BL_GFONT_ATLAS_CELL - 4) * texel);
+}
+
+/*************************************************************
+* NAME: BLGetFontSDFHandle
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLTextureHandle of the signed distance field font atlas
+* NOTE:
+*	Every glyph is stored as a WHITE distance field in the alpha
+*	channel (0.5 is the glyph's edge). Draw it with linear
+*	filtering and an alpha test of 0.5 for crisp text at any
+*	scale. Call BLInitGFont to use this function
+*************************************************************/
+BLTextureHandle BLGetFontSDFHandle( )
+{
+	//check if null
+	if(allFonts == NULL)
+	{
+		fprintf(stderr, "allfont was null!\n");
+		return 0;
+	}
+
+	//end
+	return allFonts->sdfAtlas;
+}
+
+/*************************************************************
+* NAME: BLGetFontSDFRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLByte character -> ASCII equiv of BTIS character
+* RETURNS:
+*	BLRect of the glyph's texture coords in the SDF atlas
+*	(X and Y are the bottom left)
+* NOTE:
+*	The rect covers the same 5x5 area as BLGetFontAtlasRect, so
+*	both atlases can be drawn with the same quads
+*************************************************************/
+BLRect BLGetFontSDFRect(BLByte character)
+{
+	//get cell
+	int cell = (int)BLHelperConvertASCIItoBTIS(character);
+
+	//size of one texel
+	const float texel = 1.0f / (float)BL_GFONT_SDF_SIZE;
+
+	//end
+	return BLCreateRect((float)(((cell % BL_GFONT_ATLAS_CELLS) * BL_GFONT_SDF_CELL) + BL_GFONT_SDF_PAD) * texel,
+		(float)(((cell / BL_GFONT_ATLAS_CELLS) * BL_GFONT_SDF_CELL) + BL_GFONT_SDF_PAD) * texel,
+		(float)(BL_FIXEDTEX_SIZE_FONT * BL_GFONT_SDF_UNIT) * texel, (float)(BL_FIXEDTEX_SIZE_FONT * BL_GFONT_SDF_UNIT) * texel);
+}
+
+/*************************************************************
+* NAME: BLGetFontColor
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	enum BL_GFONT_TYPE fType -> type of font
+* RETURNS:
+*	BLColor that the font type is drawn with
+* NOTE: N/A
+*************************************************************/
+BLColor BLGetFontColor(enum BL_GFONT_TYPE fType)
+{
+	switch (fType)
+	{
+	case BL_GFONT_TYPE_WHITE:
+		return BLCreateColor(BL_GFONT_WHITE);
+
+	case BL_GFONT_TYPE_BLACK:
+		return BLCreateColor(BL_GFONT_BLACK);
+
+	case BL_GFONT_TYPE_BURGUNDY:
+		return BLCreateColor(BL_GFONT_BURGUNDY);
+
+	case BL_GFONT_TYPE_NAVY:
+		return BLCreateColor(BL_GFONT_NAVY);
+
+	case BL_GFONT_TYPE_TAN:
+		return BLCreateColor(BL_GFONT_TAN);
+
+	default:
+		break;
+	}
+
+	//err color
+	return BLCreateColor(255, 0, 255, 255);
 }
\ No newline at end of file
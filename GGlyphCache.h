@@ -0,0 +1,157 @@
+#ifndef __GGLYPHCACHE_INCLUDE__
+#define __GGLYPHCACHE_INCLUDE__
+
+
+/*************************************************************
+* FILE: GGlyphCache.h
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Fixed size glyph atlas that bitmap font glyphs are drawn
+*	into on first use, for fonts with large character sets
+* CONTENTS:
+*	- Includes
+*	- Defs
+*	- Structs
+*	- Functions
+*
+*************************************************************/
+
+#include "GBitmapFont.h" // For bitmap fonts
+
+#define BL_GGLYPHCACHE_DEFAULT_SIZE 0x200 // default atlas width/height
+
+/*************************************************************
+* NAME: BLGlyphCacheStats
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLUInt hits      -> glyphs that were already in the atlas
+*	BLUInt misses    -> glyphs that had to be drawn into it
+*	BLUInt evictions -> glyphs thrown out to make space
+*	BLUInt slotCount -> glyphs the atlas can hold
+*	BLUInt slotsUsed -> glyphs currently in the atlas
+* NOTE: N/A
+*************************************************************/
+typedef struct BLGlyphCacheStats
+{
+	BLUInt hits;
+	BLUInt misses;
+	BLUInt evictions;
+	BLUInt slotCount;
+	BLUInt slotsUsed;
+}BLGlyphCacheStats;
+
+/*************************************************************
+* NAME: BLGlyphEvictHook
+* DATE: 2026 - 10 - 19
+* NOTE:
+*	Called right before a glyph is thrown out and its slot is
+*	drawn over, while the old glyph is still in the atlas
+*************************************************************/
+typedef void (*BLGlyphEvictHook)(void);
+
+/*************************************************************
+* NAME: BLGlyphCache
+* DATE: 2026 - 10 - 19
+* NOTE:
+*	Members are private to GGlyphCacheSource.c. Create with
+*	BLCreateGlyphCache, free with BLDestroyGlyphCache
+*************************************************************/
+typedef struct BLGlyphCache BLGlyphCache;
+
+/*************************************************************
+* NAME: BLCreateGlyphCache
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLBitmapFont* font -> font to draw glyphs from
+*	BLUInt atlasSize -> atlas width and height, power of 2 (0
+*	for BL_GGLYPHCACHE_DEFAULT_SIZE)
+* RETURNS:
+*	BLGlyphCache* created, NULL for failure
+* NOTE:
+*	Every slot is the size of the font's bounding box, so the
+*	atlas holds (atlasSize / (boxW + 1)) * (atlasSize / (boxH + 1))
+*	glyphs. Requires an ACTIVE window to run
+*************************************************************/
+BLGlyphCache* BLCreateGlyphCache(const BLBitmapFont* font, BLUInt atlasSize);
+
+/*************************************************************
+* NAME: BLDestroyGlyphCache
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLGlyphCache* gCache -> glyph cache to free
+* RETURNS:
+*	void
+* NOTE:
+*	Frees the glyph cache from both CPU and GPU
+*************************************************************/
+void BLDestroyGlyphCache(BLGlyphCache* gCache);
+
+/*************************************************************
+* NAME: BLGetCachedGlyph
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLGlyphCache* gCache -> glyph cache to use
+*	BLUInt codepoint -> codepoint of glyph
+*	BLRect* uv       -> set to the glyph's texture coords
+* RETURNS:
+*	BLTextureHandle of the atlas
+* NOTE:
+*	Draws the glyph into the atlas if it isn't there, throwing
+*	out the least recently used glyph when full. uv has a width
+*	of 0 for glyphs with nothing to draw. uv is only valid
+*	until the next eviction
+*************************************************************/
+BLTextureHandle BLGetCachedGlyph(BLGlyphCache* gCache, BLUInt codepoint, BLRect* uv);
+
+/*************************************************************
+* NAME: BLSetGlyphCacheEvictHook
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLGlyphCache* gCache -> glyph cache to change
+*	BLGlyphEvictHook hook -> function to call before each
+*	eviction (NULL for none)
+* RETURNS:
+*	void
+* NOTE:
+*	Lets users that queue draws with cached uvs draw them
+*	before the atlas changes under them
+*************************************************************/
+void BLSetGlyphCacheEvictHook(BLGlyphCache* gCache, BLGlyphEvictHook hook);
+
+/*************************************************************
+* NAME: BLGetGlyphCacheFont
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLGlyphCache* gCache -> glyph cache to check
+* RETURNS:
+*	const BLBitmapFont* that the glyph cache draws from
+* NOTE: N/A
+*************************************************************/
+const BLBitmapFont* BLGetGlyphCacheFont(const BLGlyphCache* gCache);
+
+/*************************************************************
+* NAME: BLGetGlyphCacheStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLGlyphCache* gCache -> glyph cache to check
+* RETURNS:
+*	BLGlyphCacheStats of the glyph cache
+* NOTE: N/A
+*************************************************************/
+BLGlyphCacheStats BLGetGlyphCacheStats(const BLGlyphCache* gCache);
+
+/*************************************************************
+* NAME: BLResetGlyphCacheStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLGlyphCache* gCache -> glyph cache to reset
+* RETURNS:
+*	void
+* NOTE:
+*	Zeros hits and misses. evictions is kept, it tells users
+*	of old uvs that the atlas changed
+*************************************************************/
+void BLResetGlyphCacheStats(BLGlyphCache* gCache);
+
+#endif
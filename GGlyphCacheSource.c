@@ -0,0 +1,500 @@
+
+
+/*************************************************************
+* FILE: GGlyphCacheSource.c
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Source file for the dynamic glyph atlas
+* CONTENTS:
+*	- Includes
+*	- Backend struct defs
+*	- File-Specifc functions
+*	- Functions
+*
+*************************************************************/
+
+#include <stdio.h>  // I/O
+#include <stdlib.h> // For memory management
+
+#include "GGlyphCache.h" // Header
+
+/*************************************************************
+* NAME: BLGlyphSlot
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLInt glyphIndex -> index of the font glyph in the slot
+*	BLRect uv        -> texture coords of the glyph
+*	BLInt bucketNext -> next slot in the same bucket
+*	BLInt lruPrev    -> more recently used slot
+*	BLInt lruNext    -> less recently used slot
+* NOTE: File specific struct
+*************************************************************/
+typedef struct BLGlyphSlot
+{
+	BLInt  glyphIndex;
+	BLRect uv;
+	BLInt  bucketNext;
+	BLInt  lruPrev;
+	BLInt  lruNext;
+}BLGlyphSlot;
+
+/*************************************************************
+* NAME: BLGlyphCache
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	const BLBitmapFont* font -> font to draw glyphs from
+*	BLTextureHandle atlas    -> atlas texture
+*	BLUInt atlasSize  -> atlas width and height
+*	BLUInt slotW      -> slot width
+*	BLUInt slotH      -> slot height
+*	BLUInt slotsPerRow -> slots in each atlas row
+*	BLGlyphSlot* slots -> every slot
+*	BLInt* buckets    -> first slot of each hash bucket
+*	BLUInt bucketMask -> bucket count - 1 (power of 2)
+*	BLInt lruHead     -> most recently used slot
+*	BLInt lruTail     -> least recently used slot
+*	BLByte* scratch   -> RGBA buffer one slot large
+*	BLGlyphCacheStats stats -> counters
+*	BLGlyphEvictHook evictHook -> called before evictions
+* NOTE: N/A
+*************************************************************/
+struct BLGlyphCache
+{
+	const BLBitmapFont* font;
+	BLTextureHandle     atlas;
+	BLUInt              atlasSize;
+	BLUInt              slotW;
+	BLUInt              slotH;
+	BLUInt              slotsPerRow;
+	BLGlyphSlot*        slots;
+	BLInt*              buckets;
+	BLUInt              bucketMask;
+	BLInt               lruHead;
+	BLInt               lruTail;
+	BLByte*             scratch;
+	BLGlyphCacheStats   stats;
+	BLGlyphEvictHook    evictHook;
+};
+
+/*************************************************************
+* NAME: BLHelperHashGlyph
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLGlyphCache* gCache -> glyph cache
+*	BLInt glyphIndex -> font glyph index
+* RETURNS:
+*	BLUInt bucket of the glyph
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline BLUInt BLHelperHashGlyph(const BLGlyphCache* gCache, BLInt glyphIndex)
+{
+	return ((BLUInt)glyphIndex * 2654435761u) & gCache->bucketMask;
+}
+
+/*************************************************************
+* NAME: BLHelperLRUUnlink
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLGlyphCache* gCache -> glyph cache
+*	BLInt index -> slot to unlink
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline void BLHelperLRUUnlink(BLGlyphCache* gCache, BLInt index)
+{
+	BLGlyphSlot* slot = &gCache->slots[index];
+
+	if(slot->lruPrev != -1)
+	{
+		gCache->slots[slot->lruPrev].lruNext = slot->lruNext;
+	}
+	else
+	{
+		gCache->lruHead = slot->lruNext;
+	}
+
+	if(slot->lruNext != -1)
+	{
+		gCache->slots[slot->lruNext].lruPrev = slot->lruPrev;
+	}
+	else
+	{
+		gCache->lruTail = slot->lruPrev;
+	}
+
+	slot->lruPrev = -1;
+	slot->lruNext = -1;
+	return;
+}
+
+/*************************************************************
+* NAME: BLHelperLRUPushFront
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLGlyphCache* gCache -> glyph cache
+*	BLInt index -> slot to mark as most recently used
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline void BLHelperLRUPushFront(BLGlyphCache* gCache, BLInt index)
+{
+	BLGlyphSlot* slot = &gCache->slots[index];
+
+	slot->lruPrev = -1;
+	slot->lruNext = gCache->lruHead;
+
+	if(gCache->lruHead != -1)
+	{
+		gCache->slots[gCache->lruHead].lruPrev = index;
+	}
+	gCache->lruHead = index;
+
+	if(gCache->lruTail == -1)
+	{
+		gCache->lruTail = index;
+	}
+	return;
+}
+
+/*************************************************************
+* NAME: BLHelperBucketRemove
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLGlyphCache* gCache -> glyph cache
+*	BLInt index -> slot to remove from its bucket
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static void BLHelperBucketRemove(BLGlyphCache* gCache, BLInt index)
+{
+	BLInt* link = &gCache->buckets[BLHelperHashGlyph(gCache, gCache->slots[index].glyphIndex)];
+
+	//walk chain until the slot is found
+	while(*link != -1)
+	{
+		if(*link == index)
+		{
+			*link = gCache->slots[index].bucketNext;
+			break;
+		}
+		link = &gCache->slots[*link].bucketNext;
+	}
+
+	gCache->slots[index].bucketNext = -1;
+	return;
+}
+
+/*************************************************************
+* NAME: BLHelperRasterGlyph
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLGlyphCache* gCache -> glyph cache
+*	BLInt index -> slot to draw into
+*	const BLBitmapGlyph* glyph -> glyph to draw
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Expands the glyph's bits to WHITE RGBA and sends only the
+*	glyph's region of the slot down to openGL
+*************************************************************/
+static void BLHelperRasterGlyph(BLGlyphCache* gCache, BLInt index, const BLBitmapGlyph* glyph)
+{
+	const BLUInt  width   = (BLUInt)glyph->width;
+	const BLUInt  height  = (BLUInt)glyph->height;
+	const BLUInt  rowSize = (width + 7) / 8;
+	const BLByte* bits    = gCache->font->bits + glyph->bitsOffset;
+
+	//expand bits
+	for(BLUInt y = 0; y < height; y++)
+	{
+		for(BLUInt x = 0; x < width; x++)
+		{
+			BLByte* pix = gCache->scratch + (((y * width) + x) * BL_FIXEDTEX_COLOR_CHANNELS);
+			pix[0] = 255;
+			pix[1] = 255;
+			pix[2] = 255;
+			pix[3] = (bits[(y * rowSize) + (x / 8)] & (0x80 >> (x % 8))) ? 255 : 0;
+		}
+	}
+
+	//get slot position
+	const BLUInt slotX = ((BLUInt)index % gCache->slotsPerRow) * gCache->slotW;
+	const BLUInt slotY = ((BLUInt)index / gCache->slotsPerRow) * gCache->slotH;
+
+	BLUpdateTexHandleRegion(gCache->atlas, gCache->scratch, slotX, slotY, width, height);
+
+	//get texture coords
+	const float fSize = (float)gCache->atlasSize;
+	gCache->slots[index].uv = BLCreateRect((float)slotX / fSize, (float)slotY / fSize, (float)width / fSize, (float)height / fSize);
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLCreateGlyphCache
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLBitmapFont* font -> font to draw glyphs from
+*	BLUInt atlasSize -> atlas width and height, power of 2 (0
+*	for BL_GGLYPHCACHE_DEFAULT_SIZE)
+* RETURNS:
+*	BLGlyphCache* created, NULL for failure
+* NOTE:
+*	Every slot is the size of the font's bounding box, so the
+*	atlas holds (atlasSize / (boxW + 1)) * (atlasSize / (boxH + 1))
+*	glyphs. Requires an ACTIVE window to run
+*************************************************************/
+BLGlyphCache* BLCreateGlyphCache(const BLBitmapFont* font, BLUInt atlasSize)
+{
+	//get size
+	if(atlasSize == 0)
+	{
+		atlasSize = BL_GGLYPHCACHE_DEFAULT_SIZE;
+	}
+
+	//check that a glyph fits
+	const BLUInt slotW = (BLUInt)font->boxW + 1;
+	const BLUInt slotH = (BLUInt)font->boxH + 1;
+	if(slotW > atlasSize || slotH > atlasSize)
+	{
+		fprintf(stderr, "Glyph cache atlas too small for font\n");
+		return NULL;
+	}
+
+	//allocate
+	BLGlyphCache* gCache = calloc(1, sizeof(BLGlyphCache));
+	if(gCache == NULL)
+	{
+		fprintf(stderr, "Glyph cache memory err\n");
+		return NULL;
+	}
+
+	gCache->font        = font;
+	gCache->atlasSize   = atlasSize;
+	gCache->slotW       = slotW;
+	gCache->slotH       = slotH;
+	gCache->slotsPerRow = atlasSize / slotW;
+	gCache->lruHead     = -1;
+	gCache->lruTail     = -1;
+	gCache->stats.slotCount = gCache->slotsPerRow * (atlasSize / slotH);
+
+	//bucket count is the next power of 2
+	BLUInt bucketCount = 1;
+	while(bucketCount < gCache->stats.slotCount)
+	{
+		bucketCount <<= 1;
+	}
+	gCache->bucketMask = bucketCount - 1;
+
+	gCache->slots   = malloc(gCache->stats.slotCount * sizeof(BLGlyphSlot));
+	gCache->buckets = malloc(bucketCount * sizeof(BLInt));
+	gCache->scratch = malloc(slotW * slotH * BL_FIXEDTEX_COLOR_CHANNELS);
+
+	//atlas starts out transparent
+	BLByte* atlasData = calloc(atlasSize * atlasSize, BL_FIXEDTEX_COLOR_CHANNELS);
+
+	if(gCache->slots == NULL || gCache->buckets == NULL || gCache->scratch == NULL || atlasData == NULL)
+	{
+		fprintf(stderr, "Glyph cache memory err\n");
+		free(atlasData);
+		free(gCache->slots);
+		free(gCache->buckets);
+		free(gCache->scratch);
+		free(gCache);
+		return NULL;
+	}
+
+	for(BLUInt i = 0; i < bucketCount; i++)
+	{
+		gCache->buckets[i] = -1;
+	}
+
+	//send atlas down to openGL
+	gCache->atlas = BLCreateTexHandleFree(atlasData, atlasSize, atlasSize);
+	free(atlasData);
+
+	//end
+	return gCache;
+}
+
+/*************************************************************
+* NAME: BLDestroyGlyphCache
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLGlyphCache* gCache -> glyph cache to free
+* RETURNS:
+*	void
+* NOTE:
+*	Frees the glyph cache from both CPU and GPU
+*************************************************************/
+void BLDestroyGlyphCache(BLGlyphCache* gCache)
+{
+	//check if null
+	if(gCache == NULL)
+	{
+		return;
+	}
+
+	//free everything
+	BLDestroyTexHandle(gCache->atlas);
+	free(gCache->slots);
+	free(gCache->buckets);
+	free(gCache->scratch);
+	free(gCache);
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLGetCachedGlyph
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLGlyphCache* gCache -> glyph cache to use
+*	BLUInt codepoint -> codepoint of glyph
+*	BLRect* uv       -> set to the glyph's texture coords
+* RETURNS:
+*	BLTextureHandle of the atlas
+* NOTE:
+*	Draws the glyph into the atlas if it isn't there, throwing
+*	out the least recently used glyph when full. uv has a width
+*	of 0 for glyphs with nothing to draw. uv is only valid
+*	until the next eviction
+*************************************************************/
+BLTextureHandle BLGetCachedGlyph(BLGlyphCache* gCache, BLUInt codepoint, BLRect* uv)
+{
+	//get font glyph (missing codepoints share the default glyph)
+	const BLBitmapGlyph* glyph = BLGetBitmapGlyph(gCache->font, codepoint);
+	const BLInt glyphIndex = (BLInt)(glyph - gCache->font->glyphs);
+
+	//empty glyphs need no slot
+	if(glyph->width <= 0 || glyph->height <= 0)
+	{
+		*uv = BLCreateRect(0, 0, 0, 0);
+		return gCache->atlas;
+	}
+
+	//look up glyph
+	const BLUInt bucket = BLHelperHashGlyph(gCache, glyphIndex);
+	for(BLInt index = gCache->buckets[bucket]; index != -1; index = gCache->slots[index].bucketNext)
+	{
+		if(gCache->slots[index].glyphIndex == glyphIndex)
+		{
+			//hit, mark as most recently used
+			gCache->stats.hits++;
+			BLHelperLRUUnlink(gCache, index);
+			BLHelperLRUPushFront(gCache, index);
+			*uv = gCache->slots[index].uv;
+			return gCache->atlas;
+		}
+	}
+
+	//miss, take a free slot or the least recently used one
+	gCache->stats.misses++;
+	BLInt index = 0;
+	if(gCache->stats.slotsUsed < gCache->stats.slotCount)
+	{
+		index = (BLInt)gCache->stats.slotsUsed;
+		gCache->stats.slotsUsed++;
+	}
+	else
+	{
+		//let queued draws using the old glyph go first
+		if(gCache->evictHook != NULL)
+		{
+			gCache->evictHook( );
+		}
+
+		index = gCache->lruTail;
+		BLHelperLRUUnlink(gCache, index);
+		BLHelperBucketRemove(gCache, index);
+		gCache->stats.evictions++;
+	}
+
+	//fill slot
+	BLGlyphSlot* slot = &gCache->slots[index];
+	slot->glyphIndex = glyphIndex;
+	slot->bucketNext = gCache->buckets[bucket];
+	gCache->buckets[bucket] = index;
+	BLHelperLRUPushFront(gCache, index);
+	BLHelperRasterGlyph(gCache, index, glyph);
+
+	//end
+	*uv = slot->uv;
+	return gCache->atlas;
+}
+
+/*************************************************************
+* NAME: BLSetGlyphCacheEvictHook
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLGlyphCache* gCache -> glyph cache to change
+*	BLGlyphEvictHook hook -> function to call before each
+*	eviction (NULL for none)
+* RETURNS:
+*	void
+* NOTE:
+*	Lets users that queue draws with cached uvs draw them
+*	before the atlas changes under them
+*************************************************************/
+void BLSetGlyphCacheEvictHook(BLGlyphCache* gCache, BLGlyphEvictHook hook)
+{
+	gCache->evictHook = hook;
+	return;
+}
+
+/*************************************************************
+* NAME: BLGetGlyphCacheFont
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLGlyphCache* gCache -> glyph cache to check
+* RETURNS:
+*	const BLBitmapFont* that the glyph cache draws from
+* NOTE: N/A
+*************************************************************/
+const BLBitmapFont* BLGetGlyphCacheFont(const BLGlyphCache* gCache)
+{
+	return gCache->font;
+}
+
+/*************************************************************
+* NAME: BLGetGlyphCacheStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLGlyphCache* gCache -> glyph cache to check
+* RETURNS:
+*	BLGlyphCacheStats of the glyph cache
+* NOTE: N/A
+*************************************************************/
+BLGlyphCacheStats BLGetGlyphCacheStats(const BLGlyphCache* gCache)
+{
+	return gCache->stats;
+}
+
+/*************************************************************
+* NAME: BLResetGlyphCacheStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLGlyphCache* gCache -> glyph cache to reset
+* RETURNS:
+*	void
+* NOTE:
+*	Zeros hits and misses. evictions is kept, it tells users
+*	of old uvs that the atlas changed
+*************************************************************/
+void BLResetGlyphCacheStats(BLGlyphCache* gCache)
+{
+	gCache->stats.hits   = 0;
+	gCache->stats.misses = 0;
+	return;
+}
\ No newline at end of file
@@ -153,4 +153,24 @@ void BLEditTexDrawRectFixed(void* fixedTex, BLColor drawColor, enum BL_TARGET_TE
 *************************************************************/
 BLColor BLEditTexGetPixColorFixed(void* fixedTex, enum BL_TARGET_TEXEDIT_TYPE texType, BLUInt x, BLUInt y);
 
+/*************************************************************
+* NAME: BLEditTexBlendPixFree
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	void* tex      -> RGBA texture data to draw Pixel on
+*	BLUInt texW    -> width of texture
+*	BLUInt texH    -> height of texture
+*	BLColor drawColor -> color to blend onto Pixel
+*	BLUInt x -> Pixel X position (0 Indexed)
+*	BLUInt y -> Pixel Y position (0 Indexed)
+* RETURNS:
+*	void
+* NOTE:
+*	Works on any RGBA byte texture (the same layout that
+*	BLCreateTexHandleFree takes), fixed textures included.
+*	drawColor is alpha blended over the existing Pixel,
+*	out of bounds Pixels are ignored
+*************************************************************/
+void BLEditTexBlendPixFree(void* tex, BLUInt texW, BLUInt texH, BLColor drawColor, BLUInt x, BLUInt y);
+
 #endif
\ No newline at end of file
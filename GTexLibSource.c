@@ -347,4 +347,62 @@ BLColor BLEditTexGetPixColorFixed(void* fixedTex, enum BL_TARGET_TEXEDIT_TYPE te
 
 	//end
 	return returnCol;
+}
+
+/*************************************************************
+* NAME: BLEditTexBlendPixFree
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	void* tex      -> RGBA texture data to draw Pixel on
+*	BLUInt texW    -> width of texture
+*	BLUInt texH    -> height of texture
+*	BLColor drawColor -> color to blend onto Pixel
+*	BLUInt x -> Pixel X position (0 Indexed)
+*	BLUInt y -> Pixel Y position (0 Indexed)
+* RETURNS:
+*	void
+* NOTE:
+*	Works on any RGBA byte texture (the same layout that
+*	BLCreateTexHandleFree takes), fixed textures included.
+*	drawColor is alpha blended over the existing Pixel,
+*	out of bounds Pixels are ignored
+*************************************************************/
+void BLEditTexBlendPixFree(void* tex, BLUInt texW, BLUInt texH, BLColor drawColor, BLUInt x, BLUInt y)
+{
+	//clamp
+	if(x > texW - 1 || y > texH - 1 || texW == 0 || texH == 0)
+	{
+		return;
+	}
+
+	//get pixel pointer (rows are texW pixels long)
+	BLByte* pix = (BLByte*)tex + (((y * texW) + x) * BL_FIXEDTEX_COLOR_CHANNELS);
+
+	//fully opaque, just copy
+	if(drawColor.A == 255)
+	{
+		pix[0] = drawColor.R;
+		pix[1] = drawColor.G;
+		pix[2] = drawColor.B;
+		pix[3] = drawColor.A;
+		return;
+	}
+
+	//fully transparent, nothing to do
+	if(drawColor.A == 0)
+	{
+		return;
+	}
+
+	//blend (source over destination)
+	const BLUInt srcA = drawColor.A;
+	const BLUInt invA = 255 - srcA;
+
+	pix[0] = (BLByte)(((drawColor.R * srcA) + (pix[0] * invA)) / 255);
+	pix[1] = (BLByte)(((drawColor.G * srcA) + (pix[1] * invA)) / 255);
+	pix[2] = (BLByte)(((drawColor.B * srcA) + (pix[2] * invA)) / 255);
+	pix[3] = (BLByte)(srcA + ((pix[3] * invA) / 255));
+
+	//end
+	return;
 }
\ No newline at end of file
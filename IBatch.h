@@ -0,0 +1,302 @@
+#ifndef __IBATCH_INCLUDE__
+#define __IBATCH_INCLUDE__
+
+
+/*************************************************************
+* FILE: IBatch.h
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Quad batching, every quad that shares an atlas is drawn
+*	with a single call
+* CONTENTS:
+*	- Includes
+*	- Defs
+*	- Structs
+*	- Functions
+*
+*************************************************************/
+
+#include "ICore.h"
+
+#define BL_IBATCH_QUAD_MAX     0x1000 // quads held before a forced flush
+#define BL_IBATCH_SHAPE_SIZE   0x20   // size of each disc in the shape texture (pixels)
+#define BL_IBATCH_SOLID_U      0.25f  // shape texture coords that are solid white
+#define BL_IBATCH_SOLID_V      0.5f
+#define BL_IBATCH_BORDER_VERTS 16     // max verts written by BLIBuildBorder
+#define BL_IBATCH_NINE_VERTS   36     // verts written by BLIBuildRounded and BLIBuildNineSlice
+#define BL_IBATCH_GRADIENT_VERTS ((BL_ICORE_GRADIENT_STOP_MAX + 1) * 4) // max verts written by BLIBuildGradient
+
+/*************************************************************
+* NAME: BL_IBATCH_SHAPE
+* DATE: 2026 - 10 - 19
+* NOTE: This enum is for which disc of the shape texture
+* corners are cut from
+*************************************************************/
+enum BL_IBATCH_SHAPE
+{
+	BL_IBATCH_SHAPE_ROUND = 0, // hard (anti aliased) edge
+	BL_IBATCH_SHAPE_SOFT  = 1  // smooth falloff, for shadows
+};
+
+/*************************************************************
+* NAME: BLIBatchStats
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLUInt quads   -> quads drawn
+*	BLUInt flushes -> draw calls made
+* NOTE: N/A
+*************************************************************/
+typedef struct BLIBatchStats
+{
+	BLUInt quads;
+	BLUInt flushes;
+}BLIBatchStats;
+
+/*************************************************************
+* NAME: BLInitIBatch
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	Without init, every batched quad is drawn on its own
+*************************************************************/
+int BLInitIBatch( );
+
+/*************************************************************
+* NAME: BLTerminateIBatch
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE: N/A
+*************************************************************/
+void BLTerminateIBatch( );
+
+/*************************************************************
+* NAME: BLIBatchQuad
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLTextureHandle atlas -> atlas to draw from
+*	int alphaTest   -> 1 to cut at half alpha (distance fields),
+*	0 to alpha blend
+*	BLRecti bounds  -> screenspace bounds of quad
+*	BLRect uv       -> texture coords in the atlas
+*	BLColor color   -> color to tint the quad
+* RETURNS:
+*	void
+* NOTE:
+*	Quads are drawn when the atlas or alphaTest changes, when
+*	the batch is full, or by BLISubmitBatch and BLIFlushBatch
+*************************************************************/
+void BLIBatchQuad(BLTextureHandle atlas, int alphaTest, BLRecti bounds, BLRect uv, BLColor color);
+
+/*************************************************************
+* NAME: BLIBatchVerts
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLTextureHandle atlas -> atlas to draw from
+*	int alphaTest   -> 1 to cut at half alpha (distance fields),
+*	0 to alpha blend
+*	const BLIVertex* verts -> quads to add (4 verts each)
+*	BLUInt vertCount -> amount of verts
+* RETURNS:
+*	void
+* NOTE:
+*	Same as BLIBatchQuad for prebuilt quads
+*************************************************************/
+void BLIBatchVerts(BLTextureHandle atlas, int alphaTest, const BLIVertex* verts, BLUInt vertCount);
+
+/*************************************************************
+* NAME: BLIBeginBatch
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Until BLIEndBatch, BLISubmitBatch does nothing, so every
+*	string drawn in between is merged into as few draws as
+*	possible. Calls can nest
+*************************************************************/
+void BLIBeginBatch( );
+
+/*************************************************************
+* NAME: BLIEndBatch
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Draws every merged quad once the outermost batch ends
+*************************************************************/
+void BLIEndBatch( );
+
+/*************************************************************
+* NAME: BLISubmitBatch
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Draws pending quads, unless between BLIBeginBatch and
+*	BLIEndBatch. Called after each string
+*************************************************************/
+void BLISubmitBatch( );
+
+/*************************************************************
+* NAME: BLIFlushBatch
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Draws pending quads now. Anything drawn without the batch
+*	calls this first so that draw order is kept
+*************************************************************/
+void BLIFlushBatch( );
+
+/*************************************************************
+* NAME: BLIGetBatchStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLIBatchStats of the batch
+* NOTE: N/A
+*************************************************************/
+BLIBatchStats BLIGetBatchStats( );
+
+/*************************************************************
+* NAME: BLIResetBatchStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Call once per frame to get per frame counts
+*************************************************************/
+void BLIResetBatchStats( );
+
+/*************************************************************
+* NAME: BLIGetWhiteTexture
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLTextureHandle of a 1x1 white texture (0 if not init)
+* NOTE:
+*	Batch untextured quads with this atlas, the vertex color
+*	is then the quad's color
+*************************************************************/
+BLTextureHandle BLIGetWhiteTexture( );
+
+/*************************************************************
+* NAME: BLIGetShapeTexture
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLTextureHandle of the shape texture (0 if not init)
+* NOTE:
+*	Two white discs side by side, the left with a hard edge
+*	and the right fading out. Coords (BL_IBATCH_SOLID_U,
+*	BL_IBATCH_SOLID_V) are solid, so plain, outlined, rounded
+*	and shadowed boxes all merge into one draw
+*************************************************************/
+BLTextureHandle BLIGetShapeTexture( );
+
+/*************************************************************
+* NAME: BLIBuildQuad
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLIVertex* verts -> 4 verts to write
+*	BLRecti bounds   -> screenspace bounds of quad
+*	BLColor colorLeft  -> leftside color
+*	BLColor colorRight -> rightside color
+* RETURNS:
+*	BLUInt amount of verts written (4)
+* NOTE:
+*	For the shape texture, the quad is solid
+*************************************************************/
+BLUInt BLIBuildQuad(BLIVertex* verts, BLRecti bounds, BLColor colorLeft, BLColor colorRight);
+
+/*************************************************************
+* NAME: BLIBuildBorder
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLIVertex* verts -> BL_IBATCH_BORDER_VERTS verts to write
+*	BLRecti bounds   -> outer bounds of the border
+*	BLUInt border    -> border size (pixels)
+*	BLColor color    -> border color
+* RETURNS:
+*	BLUInt amount of verts written
+* NOTE:
+*	For the shape texture. The border is 4 strips around the
+*	inside of bounds, so nothing is drawn under the body. A
+*	border that fills bounds is a single quad
+*************************************************************/
+BLUInt BLIBuildBorder(BLIVertex* verts, BLRecti bounds, BLUInt border, BLColor color);
+
+/*************************************************************
+* NAME: BLIBuildRounded
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLIVertex* verts -> BL_IBATCH_NINE_VERTS verts to write
+*	BLRecti bounds   -> screenspace bounds of the box
+*	BLInt corner     -> size of each corner (pixels), cut to
+*	half the box
+*	enum BL_IBATCH_SHAPE shape -> disc the corners come from
+*	BLColor color    -> box color
+* RETURNS:
+*	BLUInt amount of verts written
+* NOTE:
+*	For the shape texture. 9 quads, corners take a quarter of
+*	the disc, edges and middle stretch its center lines
+*************************************************************/
+BLUInt BLIBuildRounded(BLIVertex* verts, BLRecti bounds, BLInt corner, enum BL_IBATCH_SHAPE shape, BLColor color);
+
+/*************************************************************
+* NAME: BLIBuildNineSlice
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLIVertex* verts -> BL_IBATCH_NINE_VERTS verts to write
+*	BLRecti bounds   -> screenspace bounds of the box
+*	const BLINineSlice* slice -> skin to cut up
+*	BLColor color    -> color to tint the skin
+* RETURNS:
+*	BLUInt amount of verts written
+* NOTE:
+*	For slice->atlas. Edges wider than bounds are shrunk
+*	evenly
+*************************************************************/
+BLUInt BLIBuildNineSlice(BLIVertex* verts, BLRecti bounds, const BLINineSlice* slice, BLColor color);
+
+/*************************************************************
+* NAME: BLIBuildGradient
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLIVertex* verts -> BL_IBATCH_GRADIENT_VERTS verts to write
+*	BLRecti bounds   -> screenspace bounds of the box
+*	enum BL_IGRADIENT_DIR dir -> which way colors change
+*	const BLIGradientStop* stops -> stops in order of pos
+*	BLUInt stopCount -> amount of stops (up to
+*	BL_ICORE_GRADIENT_STOP_MAX)
+* RETURNS:
+*	BLUInt amount of verts written
+* NOTE:
+*	For the shape texture. One quad per band, the vertex
+*	colors blend each band. Stops out of order are pushed up
+*	to the one before
+*************************************************************/
+BLUInt BLIBuildGradient(BLIVertex* verts, BLRecti bounds, enum BL_IGRADIENT_DIR dir, const BLIGradientStop* stops,
+	BLUInt stopCount);
+
+#endif
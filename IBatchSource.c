@@ -0,0 +1,848 @@
+
+
+/*************************************************************
+* FILE: IBatchSource.c
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Source file for quad batching
+* CONTENTS:
+*	- Includes
+*	- Backend struct defs
+*	- Backend objects
+*	- File-Specifc functions
+*	- Functions
+*
+*************************************************************/
+
+#include <stdio.h>   // I/O
+#include <stdlib.h>  // For memory management
+#include <string.h>  // For vertex copies
+#include <math.h>    // For the shape texture
+#include <Windows.h> // OpenGL dependancy
+#include <gl/GL.h>   // For rendering
+#include <gl/GLU.h>  // For projection related functions
+
+#include "IBatch.h"  // Header
+
+/*************************************************************
+* NAME: BLBatch
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLIVertex verts[] -> pending quads
+*	BLUInt vertCount  -> amount of pending verts
+*	BLTextureHandle atlas -> atlas of pending quads
+*	int alphaTest     -> alpha test of pending quads
+*	BLInt depth       -> BLIBeginBatch nesting
+*	BLIBatchStats stats -> counters
+*	BLTextureHandle white -> 1x1 white texture for untextured
+*	quads
+*	BLTextureHandle shape -> disc texture for solid, rounded
+*	and shadowed boxes
+* NOTE: File specific struct, there should only be one
+* instance of this struct at ALL times
+*************************************************************/
+typedef struct BLBatch
+{
+	BLIVertex       verts[BL_IBATCH_QUAD_MAX * 4];
+	BLUInt          vertCount;
+	BLTextureHandle atlas;
+	int             alphaTest;
+	BLInt           depth;
+	BLIBatchStats   stats;
+	BLTextureHandle white;
+	BLTextureHandle shape;
+}BLBatch;
+
+/*************************************************************
+* NAME: batch (object)
+* DATE: 2026 - 10 - 19
+* USE:
+*	This is an instance of the BLBatch struct used to hold
+*	every pending quad
+* NOTE: N/A
+*************************************************************/
+static BLBatch* batch = NULL;
+
+/*************************************************************
+* NAME: BLHelperSetupProjectionMatrix
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	This function sets up the projection matrix based on the
+*	viewport dimensions
+*************************************************************/
+static inline void BLHelperSetupProjectionMatrix( )
+{
+	//var to get viewport dimensions
+	//0 -> X, 1 -> Y, 2 -> width, 3 -> height
+	int viewPortDimensions[4];
+	glGetIntegerv(GL_VIEWPORT, viewPortDimensions);
+
+	//set matrix mode and clear
+	glMatrixMode(GL_PROJECTION);
+	glLoadIdentity( );
+
+	//set so that modelspace maps to screenspace
+	gluOrtho2D(0, viewPortDimensions[2], 0, viewPortDimensions[3]);
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLHelperDrawVerts
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLIVertex* verts -> quads to draw
+*	BLUInt vertCount -> amount of verts
+*	BLTextureHandle atlas -> atlas to draw from
+*	int alphaTest    -> 1 to cut at half alpha (distance fields),
+*	0 to alpha blend
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Draws every quad with the atlas in a single call
+*************************************************************/
+static void BLHelperDrawVerts(const BLIVertex* verts, BLUInt vertCount, BLTextureHandle atlas, int alphaTest)
+{
+	//check if anything to draw
+	if(vertCount == 0)
+	{
+		return;
+	}
+
+	//set up projection matrix to match up with screenspace
+	BLHelperSetupProjectionMatrix( );
+
+	//load modelview and reset matrix
+	glMatrixMode(GL_MODELVIEW);
+	glLoadIdentity( );
+
+	//bind atlas, vertex colors tint it
+	glShadeModel(GL_SMOOTH);
+	glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+	glEnable(GL_TEXTURE_2D);
+	glBindTexture(GL_TEXTURE_2D, (GLuint)atlas);
+
+	//distance fields are cut at the glyph's edge
+	if(alphaTest)
+	{
+		glEnable(GL_ALPHA_TEST);
+		glAlphaFunc(GL_GEQUAL, 0.5f);
+	}
+	else
+	{
+		BLSetupBlend( );
+	}
+
+	//point openGL at the verts
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+	glEnableClientState(GL_COLOR_ARRAY);
+
+	glVertexPointer  (2, GL_FLOAT,         sizeof(BLIVertex), &verts[0].X);
+	glTexCoordPointer(2, GL_FLOAT,         sizeof(BLIVertex), &verts[0].U);
+	glColorPointer   (4, GL_UNSIGNED_BYTE, sizeof(BLIVertex), &verts[0].color);
+
+	//draw
+	glDrawArrays(GL_QUADS, 0, (GLsizei)vertCount);
+
+	//clean up
+	glDisableClientState(GL_COLOR_ARRAY);
+	glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+	glDisableClientState(GL_VERTEX_ARRAY);
+
+	glDisable(GL_ALPHA_TEST);
+	glDisable(GL_BLEND);
+	glDisable(GL_TEXTURE_2D);
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLHelperPrepareBatch
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLTextureHandle atlas -> atlas of the next quads
+*	int alphaTest    -> alpha test of the next quads
+*	BLUInt vertCount -> amount of verts about to be added
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Flushes if the state changes or the verts won't fit
+*************************************************************/
+static inline void BLHelperPrepareBatch(BLTextureHandle atlas, int alphaTest, BLUInt vertCount)
+{
+	//flush on state change or when full
+	if(batch->vertCount != 0 && (batch->atlas != atlas || batch->alphaTest != alphaTest ||
+		batch->vertCount + vertCount > BL_IBATCH_QUAD_MAX * 4))
+	{
+		BLIFlushBatch( );
+	}
+
+	//set state
+	batch->atlas     = atlas;
+	batch->alphaTest = alphaTest;
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLHelperCreateShapeTexture
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLTextureHandle of the shape texture
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Linear filtered, so corners stay smooth when stretched
+*************************************************************/
+static BLTextureHandle BLHelperCreateShapeTexture( )
+{
+	BLByte       pixels[BL_IBATCH_SHAPE_SIZE * BL_IBATCH_SHAPE_SIZE * 2 * 4];
+	const float  radius = (float)BL_IBATCH_SHAPE_SIZE * 0.5f;
+	const BLUInt width  = BL_IBATCH_SHAPE_SIZE * 2;
+
+	for(BLUInt y = 0; y < BL_IBATCH_SHAPE_SIZE; y++)
+	{
+		for(BLUInt x = 0; x < BL_IBATCH_SHAPE_SIZE; x++)
+		{
+			//distance of the texel center from the disc center
+			const float dX   = ((float)x + 0.5f) - radius;
+			const float dY   = ((float)y + 0.5f) - radius;
+			const float dist = sqrtf(dX * dX + dY * dY);
+
+			//hard disc covers up to the radius
+			float hard = radius - dist;
+			hard = (hard < 0.0f) ? 0.0f : ((hard > 1.0f) ? 1.0f : hard);
+
+			//soft disc fades out smoothly to the radius
+			float fall = dist / radius;
+			fall = (fall > 1.0f) ? 1.0f : fall;
+			const float soft = 1.0f - fall * fall * (3.0f - 2.0f * fall);
+
+			BLByte* hardPixel = pixels + ((size_t)y * width + x) * 4;
+			BLByte* softPixel = pixels + ((size_t)y * width + x + BL_IBATCH_SHAPE_SIZE) * 4;
+			hardPixel[0] = hardPixel[1] = hardPixel[2] = 0xff;
+			softPixel[0] = softPixel[1] = softPixel[2] = 0xff;
+			hardPixel[3] = (BLByte)(hard * 255.0f + 0.5f);
+			softPixel[3] = (BLByte)(soft * 255.0f + 0.5f);
+		}
+	}
+
+	BLTextureHandle shape = BLCreateTexHandleFree(pixels, BL_IBATCH_SHAPE_SIZE, width);
+	glBindTexture(GL_TEXTURE_2D, (GLuint)shape);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+
+	//end
+	return shape;
+}
+
+/*************************************************************
+* NAME: BLHelperWriteQuad
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLIVertex* quad -> 4 verts to write
+*	float bX, bY -> bottom left corner
+*	float tX, tY -> top right corner
+*	float bU, bV -> texture coords of the bottom left corner
+*	float tU, tV -> texture coords of the top right corner
+*	BLColor colorLeft  -> leftside color
+*	BLColor colorRight -> rightside color
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline void BLHelperWriteQuad(BLIVertex* quad, float bX, float bY, float tX, float tY, float bU, float bV,
+	float tU, float tV, BLColor colorLeft, BLColor colorRight)
+{
+	quad[0] = (BLIVertex){ bX, bY, bU, bV, colorLeft  }; //bottom left
+	quad[1] = (BLIVertex){ bX, tY, bU, tV, colorLeft  }; //top left
+	quad[2] = (BLIVertex){ tX, tY, tU, tV, colorRight }; //top right
+	quad[3] = (BLIVertex){ tX, bY, tU, bV, colorRight }; //bottom right
+}
+
+/*************************************************************
+* NAME: BLHelperWriteNine
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLIVertex* verts -> BL_IBATCH_NINE_VERTS verts to write
+*	const float* xs -> 4 screenspace X cuts, left to right
+*	const float* ys -> 4 screenspace Y cuts, bottom to top
+*	const float* us -> 4 texture U cuts
+*	const float* vs -> 4 texture V cuts
+*	BLColor color   -> color of every vert
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Writes the 9 quads between the cuts, bottom row first
+*************************************************************/
+static void BLHelperWriteNine(BLIVertex* verts, const float* xs, const float* ys, const float* us, const float* vs,
+	BLColor color)
+{
+	for(BLUInt row = 0; row < 3; row++)
+	{
+		for(BLUInt col = 0; col < 3; col++)
+		{
+			BLHelperWriteQuad(verts + (row * 3 + col) * 4, xs[col], ys[row], xs[col + 1], ys[row + 1],
+				us[col], vs[row], us[col + 1], vs[row + 1], color, color);
+		}
+	}
+}
+
+/*************************************************************
+* NAME: BLInitIBatch
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	Without init, every batched quad is drawn on its own
+*************************************************************/
+int BLInitIBatch( )
+{
+	//see if already init
+	if(batch != NULL)
+	{
+		fprintf(stderr, "IBatch already init!\n");
+		return 0;
+	}
+
+	//init batch
+	batch = calloc(1, sizeof(BLBatch));
+
+	//check if null
+	if(batch == NULL)
+	{
+		fprintf(stderr, "Cannot Init IBatch: memory err\n");
+		return 0;
+	}
+
+	//create white texture, so plain boxes share the batch
+	BLByte whitePixel[4] = { 0xff, 0xff, 0xff, 0xff };
+	batch->white = BLCreateTexHandleFree(whitePixel, 1, 1);
+	batch->shape = BLHelperCreateShapeTexture( );
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLTerminateIBatch
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE: N/A
+*************************************************************/
+void BLTerminateIBatch( )
+{
+	//check if init
+	if(batch == NULL)
+	{
+		return;
+	}
+
+	//free batch
+	BLDestroyTexHandle(batch->white);
+	BLDestroyTexHandle(batch->shape);
+	free(batch);
+	batch = NULL;
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLIBatchQuad
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLTextureHandle atlas -> atlas to draw from
+*	int alphaTest   -> 1 to cut at half alpha (distance fields),
+*	0 to alpha blend
+*	BLRecti bounds  -> screenspace bounds of quad
+*	BLRect uv       -> texture coords in the atlas
+*	BLColor color   -> color to tint the quad
+* RETURNS:
+*	void
+* NOTE:
+*	Quads are drawn when the atlas or alphaTest changes, when
+*	the batch is full, or by BLISubmitBatch and BLIFlushBatch
+*************************************************************/
+void BLIBatchQuad(BLTextureHandle atlas, int alphaTest, BLRecti bounds, BLRect uv, BLColor color)
+{
+	//precalculate coords
+	const float bX = (float)bounds.X; //bottom x
+	const float bY = (float)bounds.Y; //bottom y
+	const float tX = (float)(bounds.X + bounds.W); //top x
+	const float tY = (float)(bounds.Y + bounds.H); //top y
+
+	const BLIVertex quad[4] =
+	{
+		{ bX, bY, uv.X,            uv.Y,             color }, //bottom left
+		{ bX, tY, uv.X,            uv.Y + uv.height, color }, //top left
+		{ tX, tY, uv.X + uv.width, uv.Y + uv.height, color }, //top right
+		{ tX, bY, uv.X + uv.width, uv.Y,             color }  //bottom right
+	};
+
+	//add quad
+	BLIBatchVerts(atlas, alphaTest, quad, 4);
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLIBatchVerts
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLTextureHandle atlas -> atlas to draw from
+*	int alphaTest   -> 1 to cut at half alpha (distance fields),
+*	0 to alpha blend
+*	const BLIVertex* verts -> quads to add (4 verts each)
+*	BLUInt vertCount -> amount of verts
+* RETURNS:
+*	void
+* NOTE:
+*	Same as BLIBatchQuad for prebuilt quads
+*************************************************************/
+void BLIBatchVerts(BLTextureHandle atlas, int alphaTest, const BLIVertex* verts, BLUInt vertCount)
+{
+	//not init, draw now
+	if(batch == NULL)
+	{
+		BLHelperDrawVerts(verts, vertCount, atlas, alphaTest);
+		return;
+	}
+
+	//add verts, a full batch at a time
+	while(vertCount > 0)
+	{
+		BLUInt addCount = vertCount;
+		if(addCount > BL_IBATCH_QUAD_MAX * 4)
+		{
+			addCount = BL_IBATCH_QUAD_MAX * 4;
+		}
+
+		BLHelperPrepareBatch(atlas, alphaTest, addCount);
+		memcpy(&batch->verts[batch->vertCount], verts, addCount * sizeof(BLIVertex));
+		batch->vertCount += addCount;
+
+		verts     += addCount;
+		vertCount -= addCount;
+	}
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLIBeginBatch
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Until BLIEndBatch, BLISubmitBatch does nothing, so every
+*	string drawn in between is merged into as few draws as
+*	possible. Calls can nest
+*************************************************************/
+void BLIBeginBatch( )
+{
+	if(batch != NULL)
+	{
+		batch->depth++;
+	}
+	return;
+}
+
+/*************************************************************
+* NAME: BLIEndBatch
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Draws every merged quad once the outermost batch ends
+*************************************************************/
+void BLIEndBatch( )
+{
+	//check if init
+	if(batch == NULL || batch->depth == 0)
+	{
+		return;
+	}
+
+	//draw at outermost end
+	batch->depth--;
+	if(batch->depth == 0)
+	{
+		BLIFlushBatch( );
+	}
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLISubmitBatch
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Draws pending quads, unless between BLIBeginBatch and
+*	BLIEndBatch. Called after each string
+*************************************************************/
+void BLISubmitBatch( )
+{
+	if(batch != NULL && batch->depth == 0)
+	{
+		BLIFlushBatch( );
+	}
+	return;
+}
+
+/*************************************************************
+* NAME: BLIFlushBatch
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Draws pending quads now. Anything drawn without the batch
+*	calls this first so that draw order is kept
+*************************************************************/
+void BLIFlushBatch( )
+{
+	//check if anything to draw
+	if(batch == NULL || batch->vertCount == 0)
+	{
+		return;
+	}
+
+	//draw
+	BLHelperDrawVerts(batch->verts, batch->vertCount, batch->atlas, batch->alphaTest);
+	batch->stats.quads += batch->vertCount / 4;
+	batch->stats.flushes++;
+	batch->vertCount = 0;
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLIGetBatchStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLIBatchStats of the batch
+* NOTE: N/A
+*************************************************************/
+BLIBatchStats BLIGetBatchStats( )
+{
+	//check if init
+	if(batch == NULL)
+	{
+		BLIBatchStats empty = { 0 };
+		return empty;
+	}
+
+	return batch->stats;
+}
+
+/*************************************************************
+* NAME: BLIResetBatchStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Call once per frame to get per frame counts
+*************************************************************/
+void BLIResetBatchStats( )
+{
+	if(batch != NULL)
+	{
+		batch->stats.quads   = 0;
+		batch->stats.flushes = 0;
+	}
+	return;
+}
+
+/*************************************************************
+* NAME: BLIGetWhiteTexture
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLTextureHandle of a 1x1 white texture (0 if not init)
+* NOTE:
+*	Batch untextured quads with this atlas, the vertex color
+*	is then the quad's color
+*************************************************************/
+BLTextureHandle BLIGetWhiteTexture( )
+{
+	return (batch != NULL) ? batch->white : 0;
+}
+
+/*************************************************************
+* NAME: BLIGetShapeTexture
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLTextureHandle of the shape texture (0 if not init)
+* NOTE:
+*	Two white discs side by side, the left with a hard edge
+*	and the right fading out. Coords (BL_IBATCH_SOLID_U,
+*	BL_IBATCH_SOLID_V) are solid, so plain, outlined, rounded
+*	and shadowed boxes all merge into one draw
+*************************************************************/
+BLTextureHandle BLIGetShapeTexture( )
+{
+	return (batch != NULL) ? batch->shape : 0;
+}
+
+/*************************************************************
+* NAME: BLIBuildQuad
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLIVertex* verts -> 4 verts to write
+*	BLRecti bounds   -> screenspace bounds of quad
+*	BLColor colorLeft  -> leftside color
+*	BLColor colorRight -> rightside color
+* RETURNS:
+*	BLUInt amount of verts written (4)
+* NOTE:
+*	For the shape texture, the quad is solid
+*************************************************************/
+BLUInt BLIBuildQuad(BLIVertex* verts, BLRecti bounds, BLColor colorLeft, BLColor colorRight)
+{
+	BLHelperWriteQuad(verts, (float)bounds.X, (float)bounds.Y, (float)(bounds.X + bounds.W), (float)(bounds.Y + bounds.H),
+		BL_IBATCH_SOLID_U, BL_IBATCH_SOLID_V, BL_IBATCH_SOLID_U, BL_IBATCH_SOLID_V, colorLeft, colorRight);
+	return 4;
+}
+
+/*************************************************************
+* NAME: BLIBuildBorder
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLIVertex* verts -> BL_IBATCH_BORDER_VERTS verts to write
+*	BLRecti bounds   -> outer bounds of the border
+*	BLUInt border    -> border size (pixels)
+*	BLColor color    -> border color
+* RETURNS:
+*	BLUInt amount of verts written
+* NOTE:
+*	For the shape texture. The border is 4 strips around the
+*	inside of bounds, so nothing is drawn under the body. A
+*	border that fills bounds is a single quad
+*************************************************************/
+BLUInt BLIBuildBorder(BLIVertex* verts, BLRecti bounds, BLUInt border, BLColor color)
+{
+	if(border == 0)
+	{
+		return 0;
+	}
+
+	//nothing left inside
+	const BLInt size = (BLInt)border;
+	if(size * 2 >= bounds.W || size * 2 >= bounds.H)
+	{
+		return BLIBuildQuad(verts, bounds, color, color);
+	}
+
+	//bottom and top span the whole width, sides fit between
+	const BLInt right = bounds.X + bounds.W;
+	const BLInt top   = bounds.Y + bounds.H;
+	BLIBuildQuad(verts,      BLCreateRecti(bounds.X, bounds.Y, bounds.W, size), color, color);
+	BLIBuildQuad(verts + 4,  BLCreateRecti(bounds.X, top - size, bounds.W, size), color, color);
+	BLIBuildQuad(verts + 8,  BLCreateRecti(bounds.X, bounds.Y + size, size, bounds.H - (size * 2)), color, color);
+	BLIBuildQuad(verts + 12, BLCreateRecti(right - size, bounds.Y + size, size, bounds.H - (size * 2)), color, color);
+
+	//end
+	return BL_IBATCH_BORDER_VERTS;
+}
+
+/*************************************************************
+* NAME: BLIBuildRounded
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLIVertex* verts -> BL_IBATCH_NINE_VERTS verts to write
+*	BLRecti bounds   -> screenspace bounds of the box
+*	BLInt corner     -> size of each corner (pixels), cut to
+*	half the box
+*	enum BL_IBATCH_SHAPE shape -> disc the corners come from
+*	BLColor color    -> box color
+* RETURNS:
+*	BLUInt amount of verts written
+* NOTE:
+*	For the shape texture. 9 quads, corners take a quarter of
+*	the disc, edges and middle stretch its center lines
+*************************************************************/
+BLUInt BLIBuildRounded(BLIVertex* verts, BLRecti bounds, BLInt corner, enum BL_IBATCH_SHAPE shape, BLColor color)
+{
+	//cut corners to half the box
+	corner = (corner * 2 > bounds.W) ? bounds.W / 2 : corner;
+	corner = (corner * 2 > bounds.H) ? bounds.H / 2 : corner;
+	corner = (corner > 0) ? corner : 0;
+
+	//edges of the 9 quads, on screen and in the disc
+	const float uStart = (shape == BL_IBATCH_SHAPE_SOFT) ? 0.5f : 0.0f;
+	const float xs[4] = { (float)bounds.X, (float)(bounds.X + corner), (float)(bounds.X + bounds.W - corner),
+		(float)(bounds.X + bounds.W) };
+	const float ys[4] = { (float)bounds.Y, (float)(bounds.Y + corner), (float)(bounds.Y + bounds.H - corner),
+		(float)(bounds.Y + bounds.H) };
+	const float us[4] = { uStart, uStart + 0.25f, uStart + 0.25f, uStart + 0.5f };
+	const float vs[4] = { 0.0f, 0.5f, 0.5f, 1.0f };
+	BLHelperWriteNine(verts, xs, ys, us, vs, color);
+
+	//end
+	return BL_IBATCH_NINE_VERTS;
+}
+
+/*************************************************************
+* NAME: BLIBuildNineSlice
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLIVertex* verts -> BL_IBATCH_NINE_VERTS verts to write
+*	BLRecti bounds   -> screenspace bounds of the box
+*	const BLINineSlice* slice -> skin to cut up
+*	BLColor color    -> color to tint the skin
+* RETURNS:
+*	BLUInt amount of verts written
+* NOTE:
+*	For slice->atlas. Edges wider than bounds are shrunk
+*	evenly
+*************************************************************/
+BLUInt BLIBuildNineSlice(BLIVertex* verts, BLRecti bounds, const BLINineSlice* slice, BLColor color)
+{
+	//edges on screen, shrunk to fit
+	float left   = (float)slice->left;
+	float right  = (float)slice->right;
+	float bottom = (float)slice->bottom;
+	float top    = (float)slice->top;
+	if(left + right > (float)bounds.W && left + right > 0.0f)
+	{
+		const float fit = (float)bounds.W / (left + right);
+		left  *= fit;
+		right *= fit;
+	}
+	if(bottom + top > (float)bounds.H && bottom + top > 0.0f)
+	{
+		const float fit = (float)bounds.H / (bottom + top);
+		bottom *= fit;
+		top    *= fit;
+	}
+
+	//texels to texture coords
+	const float texelU = (slice->W > 0) ? slice->uv.width  / (float)slice->W : 0.0f;
+	const float texelV = (slice->H > 0) ? slice->uv.height / (float)slice->H : 0.0f;
+
+	const float xs[4] = { (float)bounds.X, (float)bounds.X + left, (float)(bounds.X + bounds.W) - right,
+		(float)(bounds.X + bounds.W) };
+	const float ys[4] = { (float)bounds.Y, (float)bounds.Y + bottom, (float)(bounds.Y + bounds.H) - top,
+		(float)(bounds.Y + bounds.H) };
+	const float us[4] = { slice->uv.X, slice->uv.X + texelU * (float)slice->left,
+		slice->uv.X + slice->uv.width - texelU * (float)slice->right, slice->uv.X + slice->uv.width };
+	const float vs[4] = { slice->uv.Y, slice->uv.Y + texelV * (float)slice->bottom,
+		slice->uv.Y + slice->uv.height - texelV * (float)slice->top, slice->uv.Y + slice->uv.height };
+	BLHelperWriteNine(verts, xs, ys, us, vs, color);
+
+	//end
+	return BL_IBATCH_NINE_VERTS;
+}
+
+/*************************************************************
+* NAME: BLIBuildGradient
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLIVertex* verts -> BL_IBATCH_GRADIENT_VERTS verts to write
+*	BLRecti bounds   -> screenspace bounds of the box
+*	enum BL_IGRADIENT_DIR dir -> which way colors change
+*	const BLIGradientStop* stops -> stops in order of pos
+*	BLUInt stopCount -> amount of stops (up to
+*	BL_ICORE_GRADIENT_STOP_MAX)
+* RETURNS:
+*	BLUInt amount of verts written
+* NOTE:
+*	For the shape texture. One quad per band, the vertex
+*	colors blend each band. Stops out of order are pushed up
+*	to the one before
+*************************************************************/
+BLUInt BLIBuildGradient(BLIVertex* verts, BLRecti bounds, enum BL_IGRADIENT_DIR dir, const BLIGradientStop* stops,
+	BLUInt stopCount)
+{
+	if(stops == NULL || stopCount == 0)
+	{
+		return 0;
+	}
+	stopCount = (stopCount > BL_ICORE_GRADIENT_STOP_MAX) ? BL_ICORE_GRADIENT_STOP_MAX : stopCount;
+
+	//precalculate box coords
+	const float bX = (float)bounds.X; //bottom x
+	const float bY = (float)bounds.Y; //bottom y
+	const float tX = (float)(bounds.X + bounds.W); //top x
+	const float tY = (float)(bounds.Y + bounds.H); //top y
+
+	//one band from each stop to the next, color is held past the ends
+	BLUInt  vertCount = 0;
+	float   lastPos   = 0.0f;
+	BLColor lastColor = stops[0].color;
+	for(BLUInt i = 0; i <= stopCount; i++)
+	{
+		float   pos   = (i < stopCount) ? stops[i].pos : 1.0f;
+		BLColor color = (i < stopCount) ? stops[i].color : lastColor;
+		pos = (pos < lastPos) ? lastPos : ((pos > 1.0f) ? 1.0f : pos);
+
+		if(pos > lastPos)
+		{
+			BLIVertex* quad = verts + vertCount;
+			if(dir == BL_IGRADIENT_DIR_VERTICAL)
+			{
+				//top to bottom
+				const float bandTop    = tY - (tY - bY) * lastPos;
+				const float bandBottom = tY - (tY - bY) * pos;
+				quad[0] = (BLIVertex){ bX, bandBottom, BL_IBATCH_SOLID_U, BL_IBATCH_SOLID_V, color     }; //bottom left
+				quad[1] = (BLIVertex){ bX, bandTop,    BL_IBATCH_SOLID_U, BL_IBATCH_SOLID_V, lastColor }; //top left
+				quad[2] = (BLIVertex){ tX, bandTop,    BL_IBATCH_SOLID_U, BL_IBATCH_SOLID_V, lastColor }; //top right
+				quad[3] = (BLIVertex){ tX, bandBottom, BL_IBATCH_SOLID_U, BL_IBATCH_SOLID_V, color     }; //bottom right
+			}
+			else
+			{
+				//left to right
+				BLHelperWriteQuad(quad, bX + (tX - bX) * lastPos, bY, bX + (tX - bX) * pos, tY,
+					BL_IBATCH_SOLID_U, BL_IBATCH_SOLID_V, BL_IBATCH_SOLID_U, BL_IBATCH_SOLID_V, lastColor, color);
+			}
+			vertCount += 4;
+		}
+
+		lastPos   = pos;
+		lastColor = color;
+	}
+
+	//end
+	return vertCount;
+}
\ No newline at end of file
@@ -17,12 +17,22 @@
 *************************************************************/
 
 #include "ICore.h"
+#include "ITextEdit.h" // For editable text
+#include "IHitGrid.h"  // For button hover and click
 
 #define BL_BLOCK_TEXT_MAX    0x80
-#define BL_TEXFIELD_TEXT_MAX 0xf0
 #define BL_BUTTON_TEXT_MAX   0x20
 
-typedef BLShort BLBlockHandle;
+#define BL_BLOCK_STORE_START       0x100    // starting block store size
+#define BL_BLOCK_STORE_TEXT_START  0x1000   // starting text arena size (in bytes)
+#define BL_BLOCK_STORE_VERT_START  0x1000   // starting glyph vertex arena size (in verts)
+#define BL_BLOCK_BOX_VERTS         20       // verts kept per block (border strips and body quad)
+#define BL_BLOCK_HANDLE_INDEX_BITS 20       // low bits of a handle holding the slot
+#define BL_BLOCK_HANDLE_INDEX_MASK 0xFFFFF  // mask for the slot of a handle
+#define BL_BLOCK_HANDLE_GEN_MAX    0xFFF    // highest generation of a slot
+#define BL_BLOCK_HANDLE_NONE       0        // handle that never points to a block
+
+typedef BLUInt BLBlockHandle;
 
 /*************************************************************
 * NAME: BL_BLOCK_TYPE
@@ -88,7 +98,8 @@ typedef struct BLBlock
 *	BLUInt textScale    -> scale of text
 *	BLByte hasTextClamp -> 1 for use textClamp, 0 for no clamp
 *	BLUInt textClamp    -> max amount of text
-*	BLByte bText[]      -> text to render
+*	BLITextEdit* edit   -> editable text (create with
+*	BLICreateTextEdit(textClamp) if hasTextClamp, else 0)
 *	BLRecti dims -> dimensions
 * NOTE: N/A
 *************************************************************/
@@ -98,7 +109,7 @@ typedef struct BLTextField
 	BLUInt textScale;
 	BLByte hasTextClamp;
 	BLUInt textClamp;
-	BLByte bText[BL_TEXFIELD_TEXT_MAX];
+	BLITextEdit* edit;
 	BLRecti dims;
 } BLTextField;
 
@@ -135,10 +146,61 @@ typedef struct BLButton
 	float hoverScale;
 	float clickScale;
 	BLRecti dims;
-};
+}BLButton;
+
+/*************************************************************
+* NAME: BLBlockStore
+* DATE: 2026 - 10 - 19
+* NOTE:
+*	Members are private to IBlocksSource.c. Create with
+*	BLICreateBlockStore, free with BLIDestroyBlockStore
+*************************************************************/
+typedef struct BLBlockStore BLBlockStore;
+
+/*************************************************************
+* NAME: BLBlockStoreView
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLUInt count -> amount of live blocks
+*	const BLBlockHandle* handles -> handle of each block
+*	BLRecti* dims     -> dims of each block (writable, for
+*	layout, changes are picked up by the next render)
+*	const BLColor* color0 -> first color of each block
+*	const BLColor* color1 -> second color of each block
+*	const BLByte* looks   -> enum BL_BLOCK_LOOK of each block
+*	const BLShort* borderSizes -> border of each block, 0 for none
+* NOTE:
+*	Every array is count long and in the same order. The view
+*	is good until the next add or remove
+*************************************************************/
+typedef struct BLBlockStoreView
+{
+	BLUInt               count;
+	const BLBlockHandle* handles;
+	BLRecti*             dims;
+	const BLColor*       color0;
+	const BLColor*       color1;
+	const BLByte*        looks;
+	const BLShort*       borderSizes;
+} BLBlockStoreView;
 
 /*************************************************************
-* NAME: BLCreateRecti
+* NAME: BLBlockStoreStats
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLUInt regenerated -> blocks whose geometry was rebuilt
+*	BLUInt reused      -> blocks drawn from kept geometry
+* NOTE:
+*	Counts for the last BLIRenderBlockStore call
+*************************************************************/
+typedef struct BLBlockStoreStats
+{
+	BLUInt regenerated;
+	BLUInt reused;
+} BLBlockStoreStats;
+
+/*************************************************************
+* NAME: BLICreateBlock
 * DATE: 2021 - 09 - 12
 * PARAMS:
 *	enum BL_BLOCK_LOOK bLook -> how the BLBlock will be rendered
@@ -156,5 +218,348 @@ typedef struct BLButton
 *************************************************************/
 BLBlock BLICreateBlock(enum BL_BLOCK_LOOK bLook, BLRecti bDims, BLColor* bCols, BLUInt bSize, BLUInt tScale, BLByte* tBuf);
 
+/*************************************************************
+* NAME: BLIRenderBlocks
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLBlock* blocks -> blocks to render
+*	BLUInt count -> amount of blocks
+*	enum BL_GFONT_TYPE sType -> type of font for block text
+* RETURNS:
+*	void
+* NOTE:
+*	Everything is put in one batch: first every border, solid
+*	and gradient look, then every texture look, then all
+*	text. Blocks in one call shouldn't overlap. The border is
+*	color1 (for gradients, also the right color)
+*************************************************************/
+void BLIRenderBlocks(const BLBlock* blocks, BLUInt count, enum BL_GFONT_TYPE sType);
+
+/*************************************************************
+* NAME: BLIAddButtonHits
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLIHitGrid* grid -> hit grid to add to
+*	const BLButton* buttons -> buttons to add
+*	BLUInt count -> amount of buttons
+*	BLInt z -> z order of the buttons
+*	BLUInt keyBase -> key of the first button, the rest
+*	follow in order
+* RETURNS:
+*	void
+* NOTE:
+*	Call between BLIHitGridBegin and BLIHitGridEnd
+*************************************************************/
+void BLIAddButtonHits(BLIHitGrid* grid, const BLButton* buttons, BLUInt count, BLInt z, BLUInt keyBase);
+
+/*************************************************************
+* NAME: BLIRenderButtons
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLButton* buttons -> buttons to render
+*	BLUInt count -> amount of buttons
+*	enum BL_GFONT_TYPE sType -> type of font for button text
+*	const BLIHitGrid* grid -> hit grid the buttons were added
+*	to (NULL for no hover or click scaling)
+*	BLUInt keyBase -> key of the first button in grid
+* RETURNS:
+*	void
+* NOTE:
+*	Everything is put in one batch: first every border and
+*	button, then all text. Hovered buttons are scaled by
+*	hoverScale, held ones by clickScale
+*************************************************************/
+void BLIRenderButtons(const BLButton* buttons, BLUInt count, enum BL_GFONT_TYPE sType, const BLIHitGrid* grid, BLUInt keyBase);
+
+/*************************************************************
+* NAME: BLIRenderTextFields
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLTextField* fields -> text fields to render
+*	BLUInt count -> amount of text fields
+*	BLColor boxColor -> color behind the text
+*	BLColor cursorColor -> color of the cursor and selection
+*	BLInt focused -> index of the field showing its cursor
+*	(-1 for none)
+* RETURNS:
+*	void
+* NOTE:
+*	Everything is put in one batch: first every box, then all
+*	text, then the focused field's selection and cursor
+*************************************************************/
+void BLIRenderTextFields(const BLTextField* fields, BLUInt count, BLColor boxColor, BLColor cursorColor, BLInt focused);
+
+/*************************************************************
+* NAME: BLICreateBlockStore
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt capacity -> blocks to make room for, 0 for
+*	BL_BLOCK_STORE_START
+* RETURNS:
+*	BLBlockStore* created (empty), NULL for failure
+* NOTE: N/A
+*************************************************************/
+BLBlockStore* BLICreateBlockStore(BLUInt capacity);
+
+/*************************************************************
+* NAME: BLIDestroyBlockStore
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> block store to free
+* RETURNS:
+*	void
+* NOTE:
+*	Every handle from the store becomes invalid
+*************************************************************/
+void BLIDestroyBlockStore(BLBlockStore* store);
+
+/*************************************************************
+* NAME: BLIBlockStoreAdd
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> block store to add to
+*	const BLBlock* block -> block to copy in (make with
+*	BLICreateBlock)
+* RETURNS:
+*	BLBlockHandle of the new block, BL_BLOCK_HANDLE_NONE for
+*	failure
+* NOTE: N/A
+*************************************************************/
+BLBlockHandle BLIBlockStoreAdd(BLBlockStore* store, const BLBlock* block);
+
+/*************************************************************
+* NAME: BLIBlockStoreRemove
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> block store to remove from
+*	BLBlockHandle handle -> block to remove
+* RETURNS:
+*	int, 1 for success, 0 for failure (stale handle)
+* NOTE:
+*	The last block is moved into the hole, so the order of
+*	the view changes. The handle and any copies of it go
+*	stale
+*************************************************************/
+int BLIBlockStoreRemove(BLBlockStore* store, BLBlockHandle handle);
+
+/*************************************************************
+* NAME: BLIBlockStoreIsValid
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLBlockStore* store -> block store to check
+*	BLBlockHandle handle -> handle to check
+* RETURNS:
+*	int, 1 if handle points to a live block, 0 if not
+* NOTE: N/A
+*************************************************************/
+int BLIBlockStoreIsValid(const BLBlockStore* store, BLBlockHandle handle);
+
+/*************************************************************
+* NAME: BLIBlockStoreGet
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLBlockStore* store -> block store to read
+*	BLBlockHandle handle -> block to read
+*	BLBlock* block -> set to a copy of the block
+* RETURNS:
+*	int, 1 for success, 0 for failure (stale handle)
+* NOTE: N/A
+*************************************************************/
+int BLIBlockStoreGet(const BLBlockStore* store, BLBlockHandle handle, BLBlock* block);
+
+/*************************************************************
+* NAME: BLIBlockStoreSetDims
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> block store to edit
+*	BLBlockHandle handle -> block to edit
+*	BLRecti dims -> new dims
+* RETURNS:
+*	int, 1 for success, 0 for failure (stale handle)
+* NOTE: N/A
+*************************************************************/
+int BLIBlockStoreSetDims(BLBlockStore* store, BLBlockHandle handle, BLRecti dims);
+
+/*************************************************************
+* NAME: BLIBlockStoreSetColors
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> block store to edit
+*	BLBlockHandle handle -> block to edit
+*	BLColor color0 -> new first color
+*	BLColor color1 -> new second color
+* RETURNS:
+*	int, 1 for success, 0 for failure (stale handle)
+* NOTE: N/A
+*************************************************************/
+int BLIBlockStoreSetColors(BLBlockStore* store, BLBlockHandle handle, BLColor color0, BLColor color1);
+
+/*************************************************************
+* NAME: BLIBlockStoreGetColors
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLBlockStore* store -> block store to read
+*	BLBlockHandle handle -> block to read
+*	BLColor* color0 -> set to the first color
+*	BLColor* color1 -> set to the second color
+* RETURNS:
+*	int, 1 for success, 0 for failure (stale handle)
+* NOTE: N/A
+*************************************************************/
+int BLIBlockStoreGetColors(const BLBlockStore* store, BLBlockHandle handle, BLColor* color0, BLColor* color1);
+
+/*************************************************************
+* NAME: BLIBlockStoreSetScale
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> block store to edit
+*	BLBlockHandle handle -> block to edit
+*	float scale -> scale of the block around its center
+* RETURNS:
+*	int, 1 for success, 0 for failure (stale handle)
+* NOTE:
+*	Only changes how the block is drawn, dims and hit testing
+*	are kept. Stacks with the hover and click scales
+*************************************************************/
+int BLIBlockStoreSetScale(BLBlockStore* store, BLBlockHandle handle, float scale);
+
+/*************************************************************
+* NAME: BLIBlockStoreGetScale
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLBlockStore* store -> block store to read
+*	BLBlockHandle handle -> block to read
+* RETURNS:
+*	float scale of the block, 1 for a stale handle
+* NOTE: N/A
+*************************************************************/
+float BLIBlockStoreGetScale(const BLBlockStore* store, BLBlockHandle handle);
+
+/*************************************************************
+* NAME: BLIBlockStoreSetText
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> block store to edit
+*	BLBlockHandle handle -> block to edit
+*	const BLByte* text -> new text (null terminated), NULL
+*	for no text
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	Text is cut to BL_BLOCK_TEXT_MAX - 1 like BLICreateBlock
+*************************************************************/
+int BLIBlockStoreSetText(BLBlockStore* store, BLBlockHandle handle, const BLByte* text);
+
+/*************************************************************
+* NAME: BLIBlockStoreGetText
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLBlockStore* store -> block store to read
+*	BLBlockHandle handle -> block to read
+* RETURNS:
+*	const BLByte* text of the block (null terminated), NULL
+*	for no text or a stale handle
+* NOTE:
+*	Good until the next add, remove or text change
+*************************************************************/
+const BLByte* BLIBlockStoreGetText(const BLBlockStore* store, BLBlockHandle handle);
+
+/*************************************************************
+* NAME: BLIBlockStoreGetView
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> block store to view
+* RETURNS:
+*	BLBlockStoreView of every live block
+* NOTE: N/A
+*************************************************************/
+BLBlockStoreView BLIBlockStoreGetView(BLBlockStore* store);
+
+/*************************************************************
+* NAME: BLIAddBlockStoreHits
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLIHitGrid* grid -> hit grid to add to
+*	const BLBlockStore* store -> blocks to add
+*	BLInt z -> z order of the blocks
+* RETURNS:
+*	void
+* NOTE:
+*	The key of each block is its handle. Call between
+*	BLIHitGridBegin and BLIHitGridEnd
+*************************************************************/
+void BLIAddBlockStoreHits(BLIHitGrid* grid, const BLBlockStore* store, BLInt z);
+
+/*************************************************************
+* NAME: BLIBlockStoreSetStateScales
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> block store to edit
+*	float hoverScale -> scale of the hovered block
+*	float clickScale -> scale of the held block
+* RETURNS:
+*	void
+* NOTE:
+*	Both start at 1 (no scaling), same as BLButton
+*************************************************************/
+void BLIBlockStoreSetStateScales(BLBlockStore* store, float hoverScale, float clickScale);
+
+/*************************************************************
+* NAME: BLIBlockStoreSetHitState
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> block store to edit
+*	const BLIHitGrid* grid -> hit grid the blocks were added to
+*	with BLIAddBlockStoreHits
+* RETURNS:
+*	void
+* NOTE:
+*	Only the blocks that gain or lose hover or click are
+*	rebuilt. Call after BLIHitGridEnd
+*************************************************************/
+void BLIBlockStoreSetHitState(BLBlockStore* store, const BLIHitGrid* grid);
+
+/*************************************************************
+* NAME: BLIBlockStoreAddDamage
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLBlockStore* store -> block store to check
+* RETURNS:
+*	void
+* NOTE:
+*	Reports the old and new rect of every block the next
+*	render rebuilds to IDamage. Call before BLIBeginDamage.
+*	Removed blocks are reported when removed
+*************************************************************/
+void BLIBlockStoreAddDamage(const BLBlockStore* store);
+
+/*************************************************************
+* NAME: BLIRenderBlockStore
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> blocks to render
+*	enum BL_GFONT_TYPE sType -> type of font for block text
+* RETURNS:
+*	void
+* NOTE:
+*	Same passes as BLIRenderBlocks. Each block keeps its
+*	verts, and only blocks whose dims, colors, text or hover
+*	state changed are rebuilt. Every block is rebuilt when the
+*	font, string mode, sType or glyph cache contents change.
+*	Text is drawn straight when the glyph cache can't hold
+*	every block's glyphs at once
+*************************************************************/
+void BLIRenderBlockStore(BLBlockStore* store, enum BL_GFONT_TYPE sType);
+
+/*************************************************************
+* NAME: BLIGetBlockStoreStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLBlockStore* store -> block store to check
+* RETURNS:
+*	BLBlockStoreStats of the last render
+* NOTE: N/A
+*************************************************************/
+BLBlockStoreStats BLIGetBlockStoreStats(const BLBlockStore* store);
 
 #endif
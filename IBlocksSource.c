@@ -0,0 +1,1716 @@
+/*************************************************************
+* FILE: IBlocksSource.c
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Source file for the extended user interface library
+* CONTENTS:
+*	- Includes
+*	- Backend struct defs
+*	- File-Specifc functions
+*	- Functions
+*
+*************************************************************/
+
+#include <stdio.h>   // I/O
+#include <stdlib.h>  // For memory management
+#include <string.h>  // For text copies
+
+#include "IBlocks.h" // Header
+#include "IBatch.h"  // For drawing every widget at once
+#include "IDamage.h" // For reporting changed blocks
+
+#define BL_BLOCK_SLOT_NONE 0xFFFFFFFF // end of the free slot list
+
+/*************************************************************
+* NAME: BLBlockStore
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLUInt count -> amount of live blocks
+*	BLUInt cap   -> size of every block array
+*	BLBlockHandle* handles -> handle of each block
+*	BLRecti* dims   -> dims of each block
+*	float* scales   -> scale of each block (for animation)
+*	BLColor* color0 -> first color of each block
+*	BLColor* color1 -> second color of each block
+*	BLByte* looks   -> look of each block
+*	BLShort* borderSizes -> border of each block
+*	BLShort* textScales  -> text scale of each block
+*	BLTextureHandle* textures -> texture of each block
+*	BLUInt* textOffsets -> start of each block's text in text
+*	BLUInt* textLengths -> length of each block's text, 0 for
+*	no text
+*	BLByte* dirty -> 1 if a block's geometry must be rebuilt
+*	BLRecti* builtDims -> dims each block was last built with
+*	BLRecti* drawnDims -> rect each block last covered (with
+*	hover scaling), empty if never built
+*	BLIVertex* boxVerts -> BL_BLOCK_BOX_VERTS kept verts of
+*	each block
+*	BLUInt* glyphOffsets -> start of each block's glyph quads
+*	in glyphVerts
+*	BLUInt* glyphCounts  -> amount of each block's glyph verts
+*	BLTextureHandle* glyphAtlases -> atlas of each block's
+*	glyphs
+*	BLShort* slotGens -> generation of each slot
+*	BLUInt* slotBlocks -> block index of each live slot, next
+*	free slot for dead ones
+*	BLUInt slotCount -> slots handed out
+*	BLUInt slotCap   -> size of the slot arrays
+*	BLUInt freeSlot  -> first free slot, BL_BLOCK_SLOT_NONE
+*	for none
+*	BLByte* text     -> text arena
+*	BLUInt textUsed  -> bytes of text used
+*	BLUInt textCap   -> size of text
+*	BLUInt textDead  -> bytes of text no block points to
+*	BLIVertex* glyphVerts -> glyph vertex arena
+*	BLUInt glyphUsed -> verts of glyphVerts used
+*	BLUInt glyphCap  -> size of glyphVerts
+*	BLUInt glyphDead -> verts no block points to
+*	BLIGlyph* gBuf   -> scratch buffer for layouts
+*	BLUInt gBufSize  -> size of gBuf
+*	float hoverScale -> scale of the hovered block
+*	float clickScale -> scale of the held block
+*	BLBlockHandle hovered -> block under the mouse
+*	BLBlockHandle active  -> block held down
+*	enum BL_ISTRING_MODE sMode -> string mode glyphs were built
+*	with
+*	const BLBitmapFont* font -> bitmap font glyphs were built
+*	with
+*	BLGlyphCache* gCache -> glyph cache glyphs were built with
+*	BLUInt gEpoch -> glyph cache evictions when built
+*	enum BL_GFONT_TYPE sType -> font type glyphs were built with
+*	BLBlockStoreStats stats -> counts of the last render
+* NOTE:
+*	Blocks are packed (removal swaps the last block in), slots
+*	keep handles stable across the swaps. Text is null
+*	terminated in the arena and compacted once half of it is
+*	dead, glyph verts the same way
+*************************************************************/
+struct BLBlockStore
+{
+	BLUInt           count;
+	BLUInt           cap;
+	BLBlockHandle*   handles;
+	BLRecti*         dims;
+	float*           scales;
+	BLColor*         color0;
+	BLColor*         color1;
+	BLByte*          looks;
+	BLShort*         borderSizes;
+	BLShort*         textScales;
+	BLTextureHandle* textures;
+	BLUInt*          textOffsets;
+	BLUInt*          textLengths;
+	BLByte*          dirty;
+	BLRecti*         builtDims;
+	BLRecti*         drawnDims;
+	BLIVertex*       boxVerts;
+	BLUInt*          glyphOffsets;
+	BLUInt*          glyphCounts;
+	BLTextureHandle* glyphAtlases;
+	BLShort*         slotGens;
+	BLUInt*          slotBlocks;
+	BLUInt           slotCount;
+	BLUInt           slotCap;
+	BLUInt           freeSlot;
+	BLByte*          text;
+	BLUInt           textUsed;
+	BLUInt           textCap;
+	BLUInt           textDead;
+	BLIVertex*           glyphVerts;
+	BLUInt               glyphUsed;
+	BLUInt               glyphCap;
+	BLUInt               glyphDead;
+	BLIGlyph*            gBuf;
+	BLUInt               gBufSize;
+	float                hoverScale;
+	float                clickScale;
+	BLBlockHandle        hovered;
+	BLBlockHandle        active;
+	enum BL_ISTRING_MODE sMode;
+	const BLBitmapFont*  font;
+	BLGlyphCache*        gCache;
+	BLUInt               gEpoch;
+	enum BL_GFONT_TYPE   sType;
+	BLBlockStoreStats    stats;
+};
+
+/*************************************************************
+* NAME: BLHelperInnerRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLRecti bounds -> outer bounds
+*	BLUInt border  -> border size (in pixels)
+* RETURNS:
+*	BLRecti inside of the border
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline BLRecti BLHelperInnerRect(BLRecti bounds, BLUInt border)
+{
+	return BLCreateRecti(bounds.X + (BLInt)border, bounds.Y + (BLInt)border,
+		bounds.W - (BLInt)(border * 2), bounds.H - (BLInt)(border * 2));
+}
+
+/*************************************************************
+* NAME: BLHelperButtonRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLButton* button -> button to check
+*	BLUInt key -> key of button in grid
+*	const BLIHitGrid* grid -> hit grid (can be NULL)
+* RETURNS:
+*	BLRecti of the button scaled by its hover or click state
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline BLRecti BLHelperButtonRect(const BLButton* button, BLUInt key, const BLIHitGrid* grid)
+{
+	if(grid != NULL && BLIHitGridGetActive(grid) == key)
+	{
+		return BLScaleRecti(button->dims, button->clickScale);
+	}
+	if(grid != NULL && BLIHitGridGetHovered(grid) == key)
+	{
+		return BLScaleRecti(button->dims, button->hoverScale);
+	}
+	return button->dims;
+}
+
+/*************************************************************
+* NAME: BLHelperRenderBlockBox
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLRecti dims -> dims of the block
+*	BLByte look  -> enum BL_BLOCK_LOOK of the block
+*	BLUInt border -> border size, 0 for none
+*	BLColor color0 -> first color
+*	BLColor color1 -> second color (and border)
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Draws the border and untextured looks
+*************************************************************/
+static inline void BLHelperRenderBlockBox(BLRecti dims, BLByte look, BLUInt border, BLColor color0, BLColor color1)
+{
+	//border strips around the body, so nothing is filled twice
+	BLIRenderBoxBorder(dims, border, color1);
+
+	const BLRecti inner = BLHelperInnerRect(dims, border);
+	if(inner.W <= 0 || inner.H <= 0)
+	{
+		return;
+	}
+
+	switch (look)
+	{
+	case BL_BLOCK_LOOK_SOLID:
+		BLIRenderBox(inner, color0);
+		break;
+
+	case BL_BLOCK_LOOK_GRADIENT:
+		BLIRenderBoxGradient(inner, color1, color0);
+		break;
+
+	default:
+		break;
+	}
+}
+
+/*************************************************************
+* NAME: BLHelperGrowArray
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	void** array -> array to grow
+*	BLUInt cap   -> new capacity (in elements)
+*	size_t elemSize -> size of each element
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static int BLHelperGrowArray(void** array, BLUInt cap, size_t elemSize)
+{
+	void* newArray = realloc(*array, (size_t)cap * elemSize);
+	if(newArray == NULL)
+	{
+		fprintf(stderr, "IBlocks: memory err\n");
+		return 0;
+	}
+	*array = newArray;
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLHelperGrowStore
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> store to grow
+*	BLUInt need -> blocks needed
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Doubles every block array until need fits
+*************************************************************/
+static int BLHelperGrowStore(BLBlockStore* store, BLUInt need)
+{
+	//check if big enough
+	if(need <= store->cap)
+	{
+		return 1;
+	}
+
+	//get new size
+	BLUInt newCap = (store->cap > 0) ? store->cap : BL_BLOCK_STORE_START;
+	while(newCap < need)
+	{
+		newCap *= 2;
+	}
+
+	//reallocate every array
+	if(BLHelperGrowArray((void**)&store->handles,     newCap, sizeof(BLBlockHandle))   == 0 ||
+	   BLHelperGrowArray((void**)&store->dims,        newCap, sizeof(BLRecti))         == 0 ||
+	   BLHelperGrowArray((void**)&store->scales,      newCap, sizeof(float))           == 0 ||
+	   BLHelperGrowArray((void**)&store->color0,      newCap, sizeof(BLColor))         == 0 ||
+	   BLHelperGrowArray((void**)&store->color1,      newCap, sizeof(BLColor))         == 0 ||
+	   BLHelperGrowArray((void**)&store->looks,       newCap, sizeof(BLByte))          == 0 ||
+	   BLHelperGrowArray((void**)&store->borderSizes, newCap, sizeof(BLShort))         == 0 ||
+	   BLHelperGrowArray((void**)&store->textScales,  newCap, sizeof(BLShort))         == 0 ||
+	   BLHelperGrowArray((void**)&store->textures,    newCap, sizeof(BLTextureHandle)) == 0 ||
+	   BLHelperGrowArray((void**)&store->textOffsets, newCap, sizeof(BLUInt))          == 0 ||
+	   BLHelperGrowArray((void**)&store->textLengths, newCap, sizeof(BLUInt))          == 0 ||
+	   BLHelperGrowArray((void**)&store->dirty,       newCap, sizeof(BLByte))          == 0 ||
+	   BLHelperGrowArray((void**)&store->builtDims,   newCap, sizeof(BLRecti))         == 0 ||
+	   BLHelperGrowArray((void**)&store->drawnDims,   newCap, sizeof(BLRecti))         == 0 ||
+	   BLHelperGrowArray((void**)&store->boxVerts,    newCap, sizeof(BLIVertex) * BL_BLOCK_BOX_VERTS) == 0 ||
+	   BLHelperGrowArray((void**)&store->glyphOffsets, newCap, sizeof(BLUInt))         == 0 ||
+	   BLHelperGrowArray((void**)&store->glyphCounts,  newCap, sizeof(BLUInt))         == 0 ||
+	   BLHelperGrowArray((void**)&store->glyphAtlases, newCap, sizeof(BLTextureHandle)) == 0)
+	{
+		return 0;
+	}
+	store->cap = newCap;
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLHelperGetBlock
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLBlockStore* store -> store to check
+*	BLBlockHandle handle -> handle to find
+*	BLUInt* block -> set to the block index of handle
+* RETURNS:
+*	int, 1 if handle is live, 0 if not
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline int BLHelperGetBlock(const BLBlockStore* store, BLBlockHandle handle, BLUInt* block)
+{
+	const BLUInt slot = handle & BL_BLOCK_HANDLE_INDEX_MASK;
+	const BLUInt gen  = handle >> BL_BLOCK_HANDLE_INDEX_BITS;
+	if(store == NULL || slot >= store->slotCount || gen == 0 || store->slotGens[slot] != gen)
+	{
+		return 0;
+	}
+	*block = store->slotBlocks[slot];
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLHelperCompactText
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> store to compact
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Copies live text to a fresh arena in block order
+*************************************************************/
+static int BLHelperCompactText(BLBlockStore* store)
+{
+	BLByte* newText = malloc(store->textCap);
+	if(newText == NULL)
+	{
+		fprintf(stderr, "IBlocks: memory err\n");
+		return 0;
+	}
+
+	BLUInt used = 0;
+	for(BLUInt i = 0; i < store->count; i++)
+	{
+		const BLUInt length = store->textLengths[i];
+		if(length == 0)
+		{
+			continue;
+		}
+		memcpy(newText + used, store->text + store->textOffsets[i], length + 1);
+		store->textOffsets[i] = used;
+		used += length + 1;
+	}
+
+	free(store->text);
+	store->text     = newText;
+	store->textUsed = used;
+	store->textDead = 0;
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLHelperStoreText
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> store to edit
+*	BLUInt block -> block index to set the text of
+*	const BLByte* text -> text to set, NULL for none
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Overwrites in place when the new text fits, otherwise
+*	appends to the arena
+*************************************************************/
+static int BLHelperStoreText(BLBlockStore* store, BLUInt block, const BLByte* text)
+{
+	const BLUInt oldLength = store->textLengths[block];
+	const BLUInt length    = (text != NULL) ? (BLUInt)strnlen((const char*)text, BL_BLOCK_TEXT_MAX - 1) : 0;
+
+	//no text
+	if(length == 0)
+	{
+		store->textDead += (oldLength > 0) ? oldLength + 1 : 0;
+		store->textLengths[block] = 0;
+		return 1;
+	}
+
+	//fits in place
+	if(length <= oldLength)
+	{
+		BLByte* dest = store->text + store->textOffsets[block];
+		memcpy(dest, text, length);
+		dest[length] = 0;
+		store->textDead += oldLength - length;
+		store->textLengths[block] = length;
+		return 1;
+	}
+
+	//throw out old text, compact if half is dead
+	store->textDead += (oldLength > 0) ? oldLength + 1 : 0;
+	store->textLengths[block] = 0;
+	if(store->textDead > BL_BLOCK_STORE_TEXT_START && store->textDead * 2 > store->textUsed)
+	{
+		if(BLHelperCompactText(store) == 0)
+		{
+			return 0;
+		}
+	}
+
+	//grow arena
+	if(store->textUsed + length + 1 > store->textCap)
+	{
+		BLUInt newCap = (store->textCap > 0) ? store->textCap : BL_BLOCK_STORE_TEXT_START;
+		while(newCap < store->textUsed + length + 1)
+		{
+			newCap *= 2;
+		}
+		if(BLHelperGrowArray((void**)&store->text, newCap, sizeof(BLByte)) == 0)
+		{
+			return 0;
+		}
+		store->textCap = newCap;
+	}
+
+	//append
+	memcpy(store->text + store->textUsed, text, length);
+	store->text[store->textUsed + length] = 0;
+	store->textOffsets[block] = store->textUsed;
+	store->textLengths[block] = length;
+	store->textUsed += length + 1;
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLHelperMarkDirty
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> store to edit
+*	BLBlockHandle handle -> block to rebuild (stale is ignored)
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline void BLHelperMarkDirty(BLBlockStore* store, BLBlockHandle handle)
+{
+	BLUInt index;
+	if(BLHelperGetBlock(store, handle, &index))
+	{
+		store->dirty[index] = 1;
+	}
+}
+
+/*************************************************************
+* NAME: BLHelperStateRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLBlockStore* store -> store to check
+*	BLUInt index -> block index
+* RETURNS:
+*	BLRecti of the block scaled by its own scale and its hover
+*	or click state
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline BLRecti BLHelperStateRect(const BLBlockStore* store, BLUInt index)
+{
+	const BLBlockHandle handle = store->handles[index];
+	float scale = store->scales[index];
+	if(handle == store->active)
+	{
+		scale *= store->clickScale;
+	}
+	else if(handle == store->hovered)
+	{
+		scale *= store->hoverScale;
+	}
+
+	if(scale != 1.0f)
+	{
+		return BLScaleRecti(store->dims[index], scale);
+	}
+	return store->dims[index];
+}
+
+/*************************************************************
+* NAME: BLHelperCompactGlyphs
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> store to compact
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Copies live glyph verts to a fresh arena in block order
+*************************************************************/
+static int BLHelperCompactGlyphs(BLBlockStore* store)
+{
+	BLIVertex* newVerts = malloc((size_t)store->glyphCap * sizeof(BLIVertex));
+	if(newVerts == NULL)
+	{
+		fprintf(stderr, "IBlocks: memory err\n");
+		return 0;
+	}
+
+	BLUInt used = 0;
+	for(BLUInt i = 0; i < store->count; i++)
+	{
+		const BLUInt vertCount = store->glyphCounts[i];
+		if(vertCount == 0)
+		{
+			continue;
+		}
+		memcpy(newVerts + used, store->glyphVerts + store->glyphOffsets[i], vertCount * sizeof(BLIVertex));
+		store->glyphOffsets[i] = used;
+		used += vertCount;
+	}
+
+	free(store->glyphVerts);
+	store->glyphVerts = newVerts;
+	store->glyphUsed  = used;
+	store->glyphDead  = 0;
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLHelperBuildGlyphs
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> store to edit
+*	BLUInt index  -> block index to build the text of
+*	BLRecti dims  -> dims to center the text in
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Same glyphs as BLIRenderStringCentered. Writes in place
+*	when the quads fit, otherwise appends to the arena. Text
+*	that can't be built is left empty
+*************************************************************/
+static void BLHelperBuildGlyphs(BLBlockStore* store, BLUInt index, BLRecti dims)
+{
+	//throw out old glyphs
+	const BLUInt oldCount = store->glyphCounts[index];
+	store->glyphCounts[index] = 0;
+	if(store->textLengths[index] == 0)
+	{
+		store->glyphDead += oldCount;
+		return;
+	}
+
+	//layout into scratch buffer (grow if too small)
+	const BLByte* text  = store->text + store->textOffsets[index];
+	const BLUInt  scale = store->textScales[index];
+	BLUInt gCount = BLILayoutString(text, dims, scale, BL_ISTRING_LAYOUT_CENTERED, store->gBuf, store->gBufSize, NULL);
+	if(gCount > store->gBufSize)
+	{
+		if(BLHelperGrowArray((void**)&store->gBuf, gCount, sizeof(BLIGlyph)) == 0)
+		{
+			store->glyphDead += oldCount;
+			return;
+		}
+		store->gBufSize = gCount;
+		BLILayoutString(text, dims, scale, BL_ISTRING_LAYOUT_CENTERED, store->gBuf, store->gBufSize, NULL);
+	}
+
+	//count visible glyphs (empty glyphs like space need no quad)
+	BLUInt vertCount = 0;
+	BLRect uv;
+	for(BLUInt i = 0; i < gCount; i++)
+	{
+		BLIGetGlyphAtlas(store->gBuf[i].codepoint, &uv);
+		if(uv.width != 0)
+		{
+			vertCount += 4;
+		}
+	}
+
+	//reuse old space if it fits
+	BLUInt offset = store->glyphOffsets[index];
+	if(vertCount > oldCount)
+	{
+		store->glyphDead += oldCount;
+		if(store->glyphDead > BL_BLOCK_STORE_VERT_START && store->glyphDead * 2 > store->glyphUsed)
+		{
+			if(BLHelperCompactGlyphs(store) == 0)
+			{
+				return;
+			}
+		}
+
+		//grow arena
+		if(store->glyphUsed + vertCount > store->glyphCap)
+		{
+			BLUInt newCap = (store->glyphCap > 0) ? store->glyphCap : BL_BLOCK_STORE_VERT_START;
+			while(newCap < store->glyphUsed + vertCount)
+			{
+				newCap *= 2;
+			}
+			if(BLHelperGrowArray((void**)&store->glyphVerts, newCap, sizeof(BLIVertex)) == 0)
+			{
+				return;
+			}
+			store->glyphCap = newCap;
+		}
+
+		offset = store->glyphUsed;
+		store->glyphUsed += vertCount;
+	}
+	else
+	{
+		store->glyphDead += oldCount - vertCount;
+	}
+
+	//build quads
+	const BLColor sColor = BLGetFontColor(store->sType);
+	BLIVertex*    quad   = store->glyphVerts + offset;
+	for(BLUInt i = 0; i < gCount; i++)
+	{
+		const BLIGlyph glyph = store->gBuf[i];
+		store->glyphAtlases[index] = BLIGetGlyphAtlas(glyph.codepoint, &uv);
+		if(uv.width == 0)
+		{
+			continue;
+		}
+
+		//precalculate coords
+		const float bX = (float)glyph.bounds.X;
+		const float bY = (float)glyph.bounds.Y;
+		const float tX = (float)(glyph.bounds.X + glyph.bounds.W);
+		const float tY = (float)(glyph.bounds.Y + glyph.bounds.H);
+
+		quad[0] = (BLIVertex){ bX, bY, uv.X,            uv.Y,             sColor }; //bottom left
+		quad[1] = (BLIVertex){ bX, tY, uv.X,            uv.Y + uv.height, sColor }; //top left
+		quad[2] = (BLIVertex){ tX, tY, uv.X + uv.width, uv.Y + uv.height, sColor }; //top right
+		quad[3] = (BLIVertex){ tX, bY, uv.X + uv.width, uv.Y,             sColor }; //bottom right
+		quad += 4;
+	}
+	store->glyphOffsets[index] = offset;
+	store->glyphCounts[index]  = vertCount;
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLHelperBuildBlock
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> store to edit
+*	BLUInt index -> block index to rebuild
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Unused box quads are left with no area
+*************************************************************/
+static void BLHelperBuildBlock(BLBlockStore* store, BLUInt index)
+{
+	const BLRecti dims   = BLHelperStateRect(store, index);
+	const BLUInt  border = store->borderSizes[index];
+	const BLRecti inner  = BLHelperInnerRect(dims, border);
+	BLIVertex*    verts  = store->boxVerts + (size_t)index * BL_BLOCK_BOX_VERTS;
+	memset(verts, 0, sizeof(BLIVertex) * BL_BLOCK_BOX_VERTS);
+
+	//border strips around the body, so nothing is filled twice
+	BLIBuildBorder(verts, dims, border, store->color1[index]);
+
+	//body, textures are drawn on their own
+	if(inner.W > 0 && inner.H > 0)
+	{
+		switch (store->looks[index])
+		{
+		case BL_BLOCK_LOOK_SOLID:
+			BLIBuildQuad(verts + BL_IBATCH_BORDER_VERTS, inner, store->color0[index], store->color0[index]);
+			break;
+
+		case BL_BLOCK_LOOK_GRADIENT:
+			BLIBuildQuad(verts + BL_IBATCH_BORDER_VERTS, inner, store->color0[index], store->color1[index]);
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	//text
+	BLHelperBuildGlyphs(store, index, dims);
+
+	store->builtDims[index] = store->dims[index];
+	store->drawnDims[index] = dims;
+	store->dirty[index]     = 0;
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLHelperGlyphEpoch
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLGlyphCache* gCache -> glyph cache glyphs are built with
+*	(NULL for none)
+* RETURNS:
+*	BLUInt, evictions of gCache so far (0 for none)
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Built glyph uvs are only good while this doesn't change
+*************************************************************/
+static inline BLUInt BLHelperGlyphEpoch(BLGlyphCache* gCache)
+{
+	return (gCache != NULL) ? BLGetGlyphCacheStats(gCache).evictions : 0;
+}
+
+/*************************************************************
+* NAME: BLHelperBuildChanged
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> store to edit
+*	int rebuildAll -> 1 to rebuild every block
+* RETURNS:
+*	BLUInt, blocks rebuilt
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Rebuilds blocks that are dirty or whose dims were set
+*	through a view
+*************************************************************/
+static BLUInt BLHelperBuildChanged(BLBlockStore* store, int rebuildAll)
+{
+	BLUInt rebuilt = 0;
+	for(BLUInt i = 0; i < store->count; i++)
+	{
+		const BLRecti dims  = store->dims[i];
+		const BLRecti built = store->builtDims[i];
+		if(rebuildAll || store->dirty[i] || dims.X != built.X || dims.Y != built.Y || dims.W != built.W || dims.H != built.H)
+		{
+			BLHelperBuildBlock(store, i);
+			rebuilt++;
+		}
+	}
+
+	//end
+	return rebuilt;
+}
+
+/*************************************************************
+* NAME: BLICreateBlock
+* DATE: 2021 - 09 - 12
+* PARAMS:
+*	enum BL_BLOCK_LOOK bLook -> how the BLBlock will be rendered
+*	BLRecti bDims  -> dims of the BLBlock
+*	BLColor* bCols -> 2 BLColors, first being the main color,
+* second being the border color. If the block is a gradient, the
+* first is the left color, and second is the right color
+*	BLUInt bSize  -> border size (in pixels), NULL for no border
+*	BLUInt tScale -> text scale	
+*	BLByte* tBuf  -> text buffer (must be null terminated)
+* 
+* RETURNS:
+*	BLBlock create from params
+* NOTE: N/A
+*************************************************************/
+BLBlock BLICreateBlock(enum BL_BLOCK_LOOK bLook, BLRecti bDims, BLColor* bCols, BLUInt bSize, BLUInt tScale, BLByte* tBuf)
+{
+	//block to return
+	BLBlock block;
+	memset(&block, 0, sizeof(BLBlock));
+
+	block.bLook      = bLook;
+	block.bDims      = bDims;
+	block.color0     = bCols[0];
+	block.color1     = bCols[1];
+	block.hasBorder  = (bSize != 0);
+	block.borderSize = bSize;
+	block.textScale  = tScale;
+
+	//copy text (cut to fit)
+	if(tBuf != NULL && tBuf[0] != 0)
+	{
+		block.hasText = 1;
+		strncpy((char*)block.bText, (const char*)tBuf, BL_BLOCK_TEXT_MAX - 1);
+	}
+
+	//end
+	return block;
+}
+
+/*************************************************************
+* NAME: BLIRenderBlocks
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLBlock* blocks -> blocks to render
+*	BLUInt count -> amount of blocks
+*	enum BL_GFONT_TYPE sType -> type of font for block text
+* RETURNS:
+*	void
+* NOTE:
+*	Everything is put in one batch: first every border, solid
+*	and gradient look, then every texture look, then all
+*	text. Blocks in one call shouldn't overlap. The border is
+*	color1 (for gradients, also the right color)
+*************************************************************/
+void BLIRenderBlocks(const BLBlock* blocks, BLUInt count, enum BL_GFONT_TYPE sType)
+{
+	BLIBeginBatch( );
+
+	//borders, solid and gradient looks (all one texture)
+	for(BLUInt i = 0; i < count; i++)
+	{
+		const BLBlock* block = &blocks[i];
+		BLHelperRenderBlockBox(block->bDims, (BLByte)block->bLook, block->hasBorder ? block->borderSize : 0,
+			block->color0, block->color1);
+	}
+
+	//texture looks, blocks sharing a texture merge
+	for(BLUInt i = 0; i < count; i++)
+	{
+		const BLBlock* block = &blocks[i];
+		if(block->bLook == BL_BLOCK_LOOK_TEXTURE)
+		{
+			BLIRenderBoxTextured(BLHelperInnerRect(block->bDims, block->hasBorder ? block->borderSize : 0), block->tHndl);
+		}
+	}
+
+	//text
+	for(BLUInt i = 0; i < count; i++)
+	{
+		const BLBlock* block = &blocks[i];
+		if(block->hasText)
+		{
+			BLIRenderStringCentered(block->bText, block->bDims, block->textScale, sType);
+		}
+	}
+
+	BLIEndBatch( );
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLIAddButtonHits
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLIHitGrid* grid -> hit grid to add to
+*	const BLButton* buttons -> buttons to add
+*	BLUInt count -> amount of buttons
+*	BLInt z -> z order of the buttons
+*	BLUInt keyBase -> key of the first button, the rest
+*	follow in order
+* RETURNS:
+*	void
+* NOTE:
+*	Call between BLIHitGridBegin and BLIHitGridEnd
+*************************************************************/
+void BLIAddButtonHits(BLIHitGrid* grid, const BLButton* buttons, BLUInt count, BLInt z, BLUInt keyBase)
+{
+	for(BLUInt i = 0; i < count; i++)
+	{
+		BLIHitGridAdd(grid, buttons[i].dims, z, keyBase + i);
+	}
+}
+
+/*************************************************************
+* NAME: BLIRenderButtons
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLButton* buttons -> buttons to render
+*	BLUInt count -> amount of buttons
+*	enum BL_GFONT_TYPE sType -> type of font for button text
+*	const BLIHitGrid* grid -> hit grid the buttons were added
+*	to (NULL for no hover or click scaling)
+*	BLUInt keyBase -> key of the first button in grid
+* RETURNS:
+*	void
+* NOTE:
+*	Everything is put in one batch: first every border and
+*	button, then all text. Hovered buttons are scaled by
+*	hoverScale, held ones by clickScale
+*************************************************************/
+void BLIRenderButtons(const BLButton* buttons, BLUInt count, enum BL_GFONT_TYPE sType, const BLIHitGrid* grid, BLUInt keyBase)
+{
+	BLIBeginBatch( );
+
+	//borders and buttons
+	for(BLUInt i = 0; i < count; i++)
+	{
+		const BLButton* button = &buttons[i];
+		const BLRecti   dims   = BLHelperButtonRect(button, keyBase + i, grid);
+		if(button->hasBorder && button->borderSize > 0)
+		{
+			BLIRenderBoxOutlined(dims, button->fg, button->borderSize, button->bg);
+		}
+		else
+		{
+			BLIRenderBox(dims, button->fg);
+		}
+	}
+
+	//text
+	BLByte text[BL_BUTTON_TEXT_MAX];
+	for(BLUInt i = 0; i < count; i++)
+	{
+		const BLButton* button = &buttons[i];
+		if(button->hasText == 0)
+		{
+			continue;
+		}
+
+		//cut to textClamp
+		BLUInt length = (BLUInt)strnlen((const char*)button->bText, BL_BUTTON_TEXT_MAX - 1);
+		if(button->hasTextClamp && length > button->textClamp)
+		{
+			length = button->textClamp;
+		}
+		memcpy(text, button->bText, length);
+		text[length] = 0;
+
+		BLIRenderStringCentered(text, BLHelperButtonRect(button, keyBase + i, grid), button->textScale, sType);
+	}
+
+	BLIEndBatch( );
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLIRenderTextFields
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLTextField* fields -> text fields to render
+*	BLUInt count -> amount of text fields
+*	BLColor boxColor -> color behind the text
+*	BLColor cursorColor -> color of the cursor and selection
+*	BLInt focused -> index of the field showing its cursor
+*	(-1 for none)
+* RETURNS:
+*	void
+* NOTE:
+*	Everything is put in one batch: first every box, then all
+*	text, then the focused field's selection and cursor
+*************************************************************/
+void BLIRenderTextFields(const BLTextField* fields, BLUInt count, BLColor boxColor, BLColor cursorColor, BLInt focused)
+{
+	BLIBeginBatch( );
+
+	//boxes
+	for(BLUInt i = 0; i < count; i++)
+	{
+		BLIRenderBox(fields[i].dims, boxColor);
+	}
+
+	//text
+	for(BLUInt i = 0; i < count; i++)
+	{
+		if(fields[i].edit != NULL)
+		{
+			BLIRenderTextEditText(fields[i].edit, fields[i].dims, fields[i].textScale, fields[i].fType);
+		}
+	}
+
+	//selection and cursor, only the focused field has them
+	if(focused >= 0 && (BLUInt)focused < count && fields[focused].edit != NULL)
+	{
+		BLIRenderTextEditCursor(fields[focused].edit, fields[focused].dims, fields[focused].textScale, cursorColor);
+	}
+
+	BLIEndBatch( );
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLICreateBlockStore
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt capacity -> blocks to make room for, 0 for
+*	BL_BLOCK_STORE_START
+* RETURNS:
+*	BLBlockStore* created (empty), NULL for failure
+* NOTE: N/A
+*************************************************************/
+BLBlockStore* BLICreateBlockStore(BLUInt capacity)
+{
+	BLBlockStore* store = calloc(1, sizeof(BLBlockStore));
+	if(store == NULL)
+	{
+		fprintf(stderr, "IBlocks: memory err\n");
+		return NULL;
+	}
+	store->freeSlot   = BL_BLOCK_SLOT_NONE;
+	store->hoverScale = 1.0f;
+	store->clickScale = 1.0f;
+	store->hovered    = BL_BLOCK_HANDLE_NONE;
+	store->active     = BL_BLOCK_HANDLE_NONE;
+
+	//make room up front
+	if(BLHelperGrowStore(store, (capacity > 0) ? capacity : BL_BLOCK_STORE_START) == 0)
+	{
+		BLIDestroyBlockStore(store);
+		return NULL;
+	}
+
+	//end
+	return store;
+}
+
+/*************************************************************
+* NAME: BLIDestroyBlockStore
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> block store to free
+* RETURNS:
+*	void
+* NOTE:
+*	Every handle from the store becomes invalid
+*************************************************************/
+void BLIDestroyBlockStore(BLBlockStore* store)
+{
+	if(store == NULL)
+	{
+		return;
+	}
+
+	free(store->handles);
+	free(store->dims);
+	free(store->scales);
+	free(store->color0);
+	free(store->color1);
+	free(store->looks);
+	free(store->borderSizes);
+	free(store->textScales);
+	free(store->textures);
+	free(store->textOffsets);
+	free(store->textLengths);
+	free(store->dirty);
+	free(store->builtDims);
+	free(store->drawnDims);
+	free(store->boxVerts);
+	free(store->glyphOffsets);
+	free(store->glyphCounts);
+	free(store->glyphAtlases);
+	free(store->slotGens);
+	free(store->slotBlocks);
+	free(store->text);
+	free(store->glyphVerts);
+	free(store->gBuf);
+	free(store);
+}
+
+/*************************************************************
+* NAME: BLIBlockStoreAdd
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> block store to add to
+*	const BLBlock* block -> block to copy in (make with
+*	BLICreateBlock)
+* RETURNS:
+*	BLBlockHandle of the new block, BL_BLOCK_HANDLE_NONE for
+*	failure
+* NOTE: N/A
+*************************************************************/
+BLBlockHandle BLIBlockStoreAdd(BLBlockStore* store, const BLBlock* block)
+{
+	if(store == NULL || block == NULL)
+	{
+		return BL_BLOCK_HANDLE_NONE;
+	}
+
+	//get a slot (reuse dead ones first)
+	BLUInt slot = store->freeSlot;
+	if(slot == BL_BLOCK_SLOT_NONE)
+	{
+		if(store->slotCount >= BL_BLOCK_HANDLE_INDEX_MASK)
+		{
+			fprintf(stderr, "IBlocks: block store full\n");
+			return BL_BLOCK_HANDLE_NONE;
+		}
+		if(store->slotCount >= store->slotCap)
+		{
+			const BLUInt newCap = (store->slotCap > 0) ? store->slotCap * 2 : BL_BLOCK_STORE_START;
+			if(BLHelperGrowArray((void**)&store->slotGens,   newCap, sizeof(BLShort)) == 0 ||
+			   BLHelperGrowArray((void**)&store->slotBlocks, newCap, sizeof(BLUInt))  == 0)
+			{
+				return BL_BLOCK_HANDLE_NONE;
+			}
+			store->slotCap = newCap;
+		}
+		slot = store->slotCount;
+		store->slotGens[slot] = 1;
+	}
+
+	//get a block
+	if(BLHelperGrowStore(store, store->count + 1) == 0)
+	{
+		return BL_BLOCK_HANDLE_NONE;
+	}
+	const BLUInt index = store->count;
+	store->textLengths[index] = 0;
+	if(block->hasText && BLHelperStoreText(store, index, block->bText) == 0)
+	{
+		return BL_BLOCK_HANDLE_NONE;
+	}
+
+	//take the slot
+	if(slot == store->freeSlot)
+	{
+		store->freeSlot = store->slotBlocks[slot];
+	}
+	else
+	{
+		store->slotCount++;
+	}
+	store->slotBlocks[slot] = index;
+
+	//fill in block
+	const BLBlockHandle handle = ((BLUInt)store->slotGens[slot] << BL_BLOCK_HANDLE_INDEX_BITS) | slot;
+	store->handles[index]     = handle;
+	store->dims[index]        = block->bDims;
+	store->scales[index]      = 1.0f;
+	store->color0[index]      = block->color0;
+	store->color1[index]      = block->color1;
+	store->looks[index]       = (BLByte)block->bLook;
+	store->borderSizes[index] = block->hasBorder ? (BLShort)block->borderSize : 0;
+	store->textScales[index]  = (BLShort)block->textScale;
+	store->textures[index]    = block->tHndl;
+	store->glyphCounts[index] = 0;
+	store->drawnDims[index]   = BLCreateRecti(0, 0, 0, 0);
+	store->dirty[index]       = 1;
+	store->count++;
+
+	//end
+	return handle;
+}
+
+/*************************************************************
+* NAME: BLIBlockStoreRemove
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> block store to remove from
+*	BLBlockHandle handle -> block to remove
+* RETURNS:
+*	int, 1 for success, 0 for failure (stale handle)
+* NOTE:
+*	The last block is moved into the hole, so the order of
+*	the view changes. The handle and any copies of it go
+*	stale
+*************************************************************/
+int BLIBlockStoreRemove(BLBlockStore* store, BLBlockHandle handle)
+{
+	BLUInt index;
+	if(BLHelperGetBlock(store, handle, &index) == 0)
+	{
+		return 0;
+	}
+
+	//the space it covered must be redrawn
+	BLIAddDamage(store->drawnDims[index]);
+
+	//throw out text
+	store->textDead  += (store->textLengths[index] > 0) ? store->textLengths[index] + 1 : 0;
+	store->glyphDead += store->glyphCounts[index];
+
+	//move last block into the hole
+	const BLUInt last = store->count - 1;
+	if(index != last)
+	{
+		store->handles[index]     = store->handles[last];
+		store->dims[index]        = store->dims[last];
+		store->scales[index]      = store->scales[last];
+		store->color0[index]      = store->color0[last];
+		store->color1[index]      = store->color1[last];
+		store->looks[index]       = store->looks[last];
+		store->borderSizes[index] = store->borderSizes[last];
+		store->textScales[index]  = store->textScales[last];
+		store->textures[index]    = store->textures[last];
+		store->textOffsets[index] = store->textOffsets[last];
+		store->textLengths[index] = store->textLengths[last];
+		store->dirty[index]        = store->dirty[last];
+		store->builtDims[index]    = store->builtDims[last];
+		store->drawnDims[index]    = store->drawnDims[last];
+		store->glyphOffsets[index] = store->glyphOffsets[last];
+		store->glyphCounts[index]  = store->glyphCounts[last];
+		store->glyphAtlases[index] = store->glyphAtlases[last];
+		memcpy(store->boxVerts + (size_t)index * BL_BLOCK_BOX_VERTS, store->boxVerts + (size_t)last * BL_BLOCK_BOX_VERTS,
+			sizeof(BLIVertex) * BL_BLOCK_BOX_VERTS);
+		store->slotBlocks[store->handles[index] & BL_BLOCK_HANDLE_INDEX_MASK] = index;
+	}
+	store->count--;
+
+	//kill the slot, skipping generation 0 on wrap
+	const BLUInt slot = handle & BL_BLOCK_HANDLE_INDEX_MASK;
+	store->slotGens[slot] = (store->slotGens[slot] >= BL_BLOCK_HANDLE_GEN_MAX) ? 1 : store->slotGens[slot] + 1;
+	store->slotBlocks[slot] = store->freeSlot;
+	store->freeSlot = slot;
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLIBlockStoreIsValid
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLBlockStore* store -> block store to check
+*	BLBlockHandle handle -> handle to check
+* RETURNS:
+*	int, 1 if handle points to a live block, 0 if not
+* NOTE: N/A
+*************************************************************/
+int BLIBlockStoreIsValid(const BLBlockStore* store, BLBlockHandle handle)
+{
+	BLUInt index;
+	return BLHelperGetBlock(store, handle, &index);
+}
+
+/*************************************************************
+* NAME: BLIBlockStoreGet
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLBlockStore* store -> block store to read
+*	BLBlockHandle handle -> block to read
+*	BLBlock* block -> set to a copy of the block
+* RETURNS:
+*	int, 1 for success, 0 for failure (stale handle)
+* NOTE: N/A
+*************************************************************/
+int BLIBlockStoreGet(const BLBlockStore* store, BLBlockHandle handle, BLBlock* block)
+{
+	BLUInt index;
+	if(block == NULL || BLHelperGetBlock(store, handle, &index) == 0)
+	{
+		return 0;
+	}
+
+	memset(block, 0, sizeof(BLBlock));
+	block->bLook      = (enum BL_BLOCK_LOOK)store->looks[index];
+	block->bDims      = store->dims[index];
+	block->color0     = store->color0[index];
+	block->color1     = store->color1[index];
+	block->tHndl      = store->textures[index];
+	block->hasBorder  = (store->borderSizes[index] > 0);
+	block->borderSize = store->borderSizes[index];
+	block->textScale  = store->textScales[index];
+	block->hasText    = (store->textLengths[index] > 0);
+	if(block->hasText)
+	{
+		memcpy(block->bText, store->text + store->textOffsets[index], store->textLengths[index] + 1);
+	}
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLIBlockStoreSetDims
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> block store to edit
+*	BLBlockHandle handle -> block to edit
+*	BLRecti dims -> new dims
+* RETURNS:
+*	int, 1 for success, 0 for failure (stale handle)
+* NOTE: N/A
+*************************************************************/
+int BLIBlockStoreSetDims(BLBlockStore* store, BLBlockHandle handle, BLRecti dims)
+{
+	BLUInt index;
+	if(BLHelperGetBlock(store, handle, &index) == 0)
+	{
+		return 0;
+	}
+	store->dims[index]  = dims;
+	store->dirty[index] = 1;
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLIBlockStoreSetColors
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> block store to edit
+*	BLBlockHandle handle -> block to edit
+*	BLColor color0 -> new first color
+*	BLColor color1 -> new second color
+* RETURNS:
+*	int, 1 for success, 0 for failure (stale handle)
+* NOTE: N/A
+*************************************************************/
+int BLIBlockStoreSetColors(BLBlockStore* store, BLBlockHandle handle, BLColor color0, BLColor color1)
+{
+	BLUInt index;
+	if(BLHelperGetBlock(store, handle, &index) == 0)
+	{
+		return 0;
+	}
+	store->color0[index] = color0;
+	store->color1[index] = color1;
+	store->dirty[index]  = 1;
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLIBlockStoreGetColors
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLBlockStore* store -> block store to read
+*	BLBlockHandle handle -> block to read
+*	BLColor* color0 -> set to the first color
+*	BLColor* color1 -> set to the second color
+* RETURNS:
+*	int, 1 for success, 0 for failure (stale handle)
+* NOTE: N/A
+*************************************************************/
+int BLIBlockStoreGetColors(const BLBlockStore* store, BLBlockHandle handle, BLColor* color0, BLColor* color1)
+{
+	BLUInt index;
+	if(color0 == NULL || color1 == NULL || BLHelperGetBlock(store, handle, &index) == 0)
+	{
+		return 0;
+	}
+	*color0 = store->color0[index];
+	*color1 = store->color1[index];
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLIBlockStoreSetScale
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> block store to edit
+*	BLBlockHandle handle -> block to edit
+*	float scale -> scale of the block around its center
+* RETURNS:
+*	int, 1 for success, 0 for failure (stale handle)
+* NOTE:
+*	Only changes how the block is drawn, dims and hit testing
+*	are kept. Stacks with the hover and click scales
+*************************************************************/
+int BLIBlockStoreSetScale(BLBlockStore* store, BLBlockHandle handle, float scale)
+{
+	BLUInt index;
+	if(BLHelperGetBlock(store, handle, &index) == 0)
+	{
+		return 0;
+	}
+	if(store->scales[index] != scale)
+	{
+		store->scales[index] = scale;
+		store->dirty[index]  = 1;
+	}
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLIBlockStoreGetScale
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLBlockStore* store -> block store to read
+*	BLBlockHandle handle -> block to read
+* RETURNS:
+*	float scale of the block, 1 for a stale handle
+* NOTE: N/A
+*************************************************************/
+float BLIBlockStoreGetScale(const BLBlockStore* store, BLBlockHandle handle)
+{
+	BLUInt index;
+	if(BLHelperGetBlock(store, handle, &index) == 0)
+	{
+		return 1.0f;
+	}
+	return store->scales[index];
+}
+
+/*************************************************************
+* NAME: BLIBlockStoreSetText
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> block store to edit
+*	BLBlockHandle handle -> block to edit
+*	const BLByte* text -> new text (null terminated), NULL
+*	for no text
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	Text is cut to BL_BLOCK_TEXT_MAX - 1 like BLICreateBlock
+*************************************************************/
+int BLIBlockStoreSetText(BLBlockStore* store, BLBlockHandle handle, const BLByte* text)
+{
+	BLUInt index;
+	if(BLHelperGetBlock(store, handle, &index) == 0)
+	{
+		return 0;
+	}
+	store->dirty[index] = 1;
+	return BLHelperStoreText(store, index, text);
+}
+
+/*************************************************************
+* NAME: BLIBlockStoreGetText
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLBlockStore* store -> block store to read
+*	BLBlockHandle handle -> block to read
+* RETURNS:
+*	const BLByte* text of the block (null terminated), NULL
+*	for no text or a stale handle
+* NOTE:
+*	Good until the next add, remove or text change
+*************************************************************/
+const BLByte* BLIBlockStoreGetText(const BLBlockStore* store, BLBlockHandle handle)
+{
+	BLUInt index;
+	if(BLHelperGetBlock(store, handle, &index) == 0 || store->textLengths[index] == 0)
+	{
+		return NULL;
+	}
+	return store->text + store->textOffsets[index];
+}
+
+/*************************************************************
+* NAME: BLIBlockStoreGetView
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> block store to view
+* RETURNS:
+*	BLBlockStoreView of every live block
+* NOTE: N/A
+*************************************************************/
+BLBlockStoreView BLIBlockStoreGetView(BLBlockStore* store)
+{
+	BLBlockStoreView view;
+	memset(&view, 0, sizeof(BLBlockStoreView));
+	if(store == NULL)
+	{
+		return view;
+	}
+
+	view.count       = store->count;
+	view.handles     = store->handles;
+	view.dims        = store->dims;
+	view.color0      = store->color0;
+	view.color1      = store->color1;
+	view.looks       = store->looks;
+	view.borderSizes = store->borderSizes;
+
+	//end
+	return view;
+}
+
+/*************************************************************
+* NAME: BLIAddBlockStoreHits
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLIHitGrid* grid -> hit grid to add to
+*	const BLBlockStore* store -> blocks to add
+*	BLInt z -> z order of the blocks
+* RETURNS:
+*	void
+* NOTE:
+*	The key of each block is its handle. Call between
+*	BLIHitGridBegin and BLIHitGridEnd
+*************************************************************/
+void BLIAddBlockStoreHits(BLIHitGrid* grid, const BLBlockStore* store, BLInt z)
+{
+	if(store == NULL)
+	{
+		return;
+	}
+
+	const BLRecti*       dims    = store->dims;
+	const BLBlockHandle* handles = store->handles;
+	for(BLUInt i = 0; i < store->count; i++)
+	{
+		BLIHitGridAdd(grid, dims[i], z, handles[i]);
+	}
+}
+
+/*************************************************************
+* NAME: BLIBlockStoreSetStateScales
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> block store to edit
+*	float hoverScale -> scale of the hovered block
+*	float clickScale -> scale of the held block
+* RETURNS:
+*	void
+* NOTE:
+*	Both start at 1 (no scaling), same as BLButton
+*************************************************************/
+void BLIBlockStoreSetStateScales(BLBlockStore* store, float hoverScale, float clickScale)
+{
+	if(store == NULL || (store->hoverScale == hoverScale && store->clickScale == clickScale))
+	{
+		return;
+	}
+
+	store->hoverScale = hoverScale;
+	store->clickScale = clickScale;
+	BLHelperMarkDirty(store, store->hovered);
+	BLHelperMarkDirty(store, store->active);
+}
+
+/*************************************************************
+* NAME: BLIBlockStoreSetHitState
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> block store to edit
+*	const BLIHitGrid* grid -> hit grid the blocks were added to
+*	with BLIAddBlockStoreHits
+* RETURNS:
+*	void
+* NOTE:
+*	Only the blocks that gain or lose hover or click are
+*	rebuilt. Call after BLIHitGridEnd
+*************************************************************/
+void BLIBlockStoreSetHitState(BLBlockStore* store, const BLIHitGrid* grid)
+{
+	if(store == NULL || grid == NULL)
+	{
+		return;
+	}
+
+	//keys that aren't live handles count as nothing
+	BLBlockHandle hovered = BLIHitGridGetHovered(grid);
+	BLBlockHandle active  = BLIHitGridGetActive(grid);
+	if(BLIBlockStoreIsValid(store, hovered) == 0)
+	{
+		hovered = BL_BLOCK_HANDLE_NONE;
+	}
+	if(BLIBlockStoreIsValid(store, active) == 0)
+	{
+		active = BL_BLOCK_HANDLE_NONE;
+	}
+
+	//rebuild blocks that changed state
+	if(hovered != store->hovered)
+	{
+		BLHelperMarkDirty(store, store->hovered);
+		BLHelperMarkDirty(store, hovered);
+		store->hovered = hovered;
+	}
+	if(active != store->active)
+	{
+		BLHelperMarkDirty(store, store->active);
+		BLHelperMarkDirty(store, active);
+		store->active = active;
+	}
+}
+
+/*************************************************************
+* NAME: BLIBlockStoreAddDamage
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLBlockStore* store -> block store to check
+* RETURNS:
+*	void
+* NOTE:
+*	Reports the old and new rect of every block the next
+*	render rebuilds to IDamage. Call before BLIBeginDamage.
+*	Removed blocks are reported when removed
+*************************************************************/
+void BLIBlockStoreAddDamage(const BLBlockStore* store)
+{
+	if(store == NULL)
+	{
+		return;
+	}
+
+	for(BLUInt i = 0; i < store->count; i++)
+	{
+		const BLRecti dims  = store->dims[i];
+		const BLRecti built = store->builtDims[i];
+		if(store->dirty[i] || dims.X != built.X || dims.Y != built.Y || dims.W != built.W || dims.H != built.H)
+		{
+			BLIAddDamage(store->drawnDims[i]);
+			BLIAddDamage(BLHelperStateRect(store, i));
+		}
+	}
+}
+
+/*************************************************************
+* NAME: BLIRenderBlockStore
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLBlockStore* store -> blocks to render
+*	enum BL_GFONT_TYPE sType -> type of font for block text
+* RETURNS:
+*	void
+* NOTE:
+*	Same passes as BLIRenderBlocks. Each block keeps its
+*	verts, and only blocks whose dims, colors, text or hover
+*	state changed are rebuilt. Every block is rebuilt when the
+*	font, string mode, sType or glyph cache contents change.
+*	Text is drawn straight when the glyph cache can't hold
+*	every block's glyphs at once
+*************************************************************/
+void BLIRenderBlockStore(BLBlockStore* store, enum BL_GFONT_TYPE sType)
+{
+	if(store == NULL)
+	{
+		return;
+	}
+
+	//glyphs depend on the font setup
+	const enum BL_ISTRING_MODE sMode  = BLIGetStringMode( );
+	const BLBitmapFont*        font   = BLIGetBitmapFont( );
+	BLGlyphCache*              gCache = BLIGetGlyphCache( );
+	const BLUInt               gEpoch = BLHelperGlyphEpoch(gCache);
+	const int                  rebuildAll = (sMode != store->sMode || font != store->font || gCache != store->gCache ||
+		gEpoch != store->gEpoch || sType != store->sType);
+	store->sMode  = sMode;
+	store->font   = font;
+	store->gCache = gCache;
+	store->sType  = sType;
+
+	//rebuild changed blocks (dims may have been set through a view)
+	store->stats.regenerated = BLHelperBuildChanged(store, rebuildAll);
+
+	//building can evict glyphs other blocks were built with, so
+	//build everything again. If that evicts too, the atlas can't
+	//hold every block's glyphs and they are drawn straight
+	BLUInt builtEpoch  = BLHelperGlyphEpoch(gCache);
+	int    glyphsStale = 0;
+	if(builtEpoch != gEpoch)
+	{
+		const BLUInt retryEpoch = builtEpoch;
+		store->stats.regenerated = BLHelperBuildChanged(store, 1);
+		builtEpoch  = BLHelperGlyphEpoch(gCache);
+		glyphsStale = (builtEpoch != retryEpoch);
+	}
+	store->stats.reused = store->count - store->stats.regenerated;
+
+	//kept glyphs stay good until the next eviction, stale ones
+	//keep an old epoch so they are rebuilt next frame
+	store->gEpoch = glyphsStale ? gEpoch : builtEpoch;
+
+	BLIBeginBatch( );
+
+	//borders, solid and gradient looks
+	if(store->count > 0)
+	{
+		BLIBatchVerts(BLIGetShapeTexture( ), 0, store->boxVerts, store->count * BL_BLOCK_BOX_VERTS);
+	}
+
+	//texture looks
+	for(BLUInt i = 0; i < store->count; i++)
+	{
+		if(store->looks[i] == BL_BLOCK_LOOK_TEXTURE)
+		{
+			BLIRenderBoxTextured(BLHelperInnerRect(BLHelperStateRect(store, i), store->borderSizes[i]), store->textures[i]);
+		}
+	}
+
+	//text, looked up as it's drawn if the kept glyphs are stale
+	const int alphaTest = (font == NULL && sMode == BL_ISTRING_MODE_SDF);
+	for(BLUInt i = 0; i < store->count; i++)
+	{
+		if(glyphsStale && store->textLengths[i] > 0)
+		{
+			BLIRenderStringCentered(store->text + store->textOffsets[i], store->drawnDims[i], store->textScales[i], sType);
+		}
+		else if(!glyphsStale && store->glyphCounts[i] > 0)
+		{
+			BLIBatchVerts(store->glyphAtlases[i], alphaTest, store->glyphVerts + store->glyphOffsets[i], store->glyphCounts[i]);
+		}
+	}
+
+	BLIEndBatch( );
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLIGetBlockStoreStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLBlockStore* store -> block store to check
+* RETURNS:
+*	BLBlockStoreStats of the last render
+* NOTE: N/A
+*************************************************************/
+BLBlockStoreStats BLIGetBlockStoreStats(const BLBlockStore* store)
+{
+	if(store == NULL)
+	{
+		BLBlockStoreStats empty = { 0 };
+		return empty;
+	}
+
+	return store->stats;
+}
\ No newline at end of file
@@ -18,18 +18,14 @@
 *************************************************************/
 
 #include "GFont.h"
+#include "GGlyphCache.h"
 #include "WCore.h"
 
 #define BL_ICORE_NEWLINE_SCALE     1.5f
 #define BL_ICORE_SPACE_SCALE       1.15f
 
-#define BL_ICORE_WORD_BUF_SIZE     0x40
-#define BL_ICORE_STRING_WORD_COUNT 0x80
-
-#define BL_ICORE_LINE_BUF_SIZE 0x80
-#define BL_ICORE_LINE_COUNT    0x40
-
-#define BL_ICORE_CHAR_MATCH_COUNT 0x20
+#define BL_ICORE_GLYPH_ARENA_SIZE  0x400 // starting size of the glyph arena
+#define BL_ICORE_GRADIENT_STOP_MAX 0x10  // max stops in one gradient
 
 /*************************************************************
 * NAME: BL_CENTER_TYPE
@@ -44,6 +40,43 @@ enum BL_CENTER_TYPE
 	BL_CENTER_TYPE_BOTH = 2
 };
 
+/*************************************************************
+* NAME: BL_IGRADIENT_DIR
+* DATE: 2026 - 10 - 19
+* NOTE: This enum is for the BLIRenderBoxGradientStops
+* function, and specifies which way colors change
+*************************************************************/
+enum BL_IGRADIENT_DIR
+{
+	BL_IGRADIENT_DIR_HORIZONTAL = 0, // left to right
+	BL_IGRADIENT_DIR_VERTICAL   = 1  // top to bottom
+};
+
+/*************************************************************
+* NAME: BL_ISTRING_LAYOUT
+* DATE: 2026 - 10 - 19
+* NOTE: This enum is for the BLILayoutString function,
+* and specifies which string render function to lay out like
+*************************************************************/
+enum BL_ISTRING_LAYOUT
+{
+	BL_ISTRING_LAYOUT_LINE     = 0, // BLIRenderString
+	BL_ISTRING_LAYOUT_CENTERED = 1, // BLIRenderStringCentered
+	BL_ISTRING_LAYOUT_RECT     = 2  // BLIRenderStringRect
+};
+
+/*************************************************************
+* NAME: BL_ISTRING_MODE
+* DATE: 2026 - 10 - 19
+* NOTE: This enum is for the BLISetStringMode function,
+* and specifies which font atlas strings are drawn from
+*************************************************************/
+enum BL_ISTRING_MODE
+{
+	BL_ISTRING_MODE_BITMAP = 0, // 5x5 bitmaps, blocky when large
+	BL_ISTRING_MODE_SDF    = 1  // distance fields, crisp at any scale
+};
+
 /*************************************************************
 * NAME: BLRecti
 * DATE: 2021 - 09 - 2
@@ -60,6 +93,105 @@ typedef struct BLRecti
 	BLInt H;
 }BLRecti;
 
+/*************************************************************
+* NAME: BLIGlyph
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLRecti bounds   -> screenspace bounds of the glyph
+*	BLUInt codepoint -> codepoint of the glyph
+* NOTE: N/A
+*************************************************************/
+typedef struct BLIGlyph
+{
+	BLRecti bounds;
+	BLUInt  codepoint;
+}BLIGlyph;
+
+/*************************************************************
+* NAME: BLITextMetrics
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLInt width      -> width of the widest line (in pixels)
+*	BLInt height     -> height of every line (in pixels)
+*	BLUInt lineCount -> amount of lines
+*	int fits         -> 1 if the string fits its bounds, 0 if
+*	it overflows them
+*	BLInt advance    -> distance from the start of the last
+*	line to where the next glyph would go (for carets)
+* NOTE: N/A
+*************************************************************/
+typedef struct BLITextMetrics
+{
+	BLInt  width;
+	BLInt  height;
+	BLUInt lineCount;
+	int    fits;
+	BLInt  advance;
+}BLITextMetrics;
+
+/*************************************************************
+* NAME: BLIVertex
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	float X -> screenspace X position
+*	float Y -> screenspace Y position
+*	float U -> texture coord U
+*	float V -> texture coord V
+*	BLColor color -> vertex color (tints the texture)
+* NOTE:
+*	Laid out for openGL vertex arrays
+*************************************************************/
+typedef struct BLIVertex
+{
+	float   X;
+	float   Y;
+	float   U;
+	float   V;
+	BLColor color;
+}BLIVertex;
+
+/*************************************************************
+* NAME: BLIGradientStop
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	float pos     -> where the color is reached (0 to 1)
+*	BLColor color -> color at pos
+* NOTE: N/A
+*************************************************************/
+typedef struct BLIGradientStop
+{
+	float   pos;
+	BLColor color;
+}BLIGradientStop;
+
+/*************************************************************
+* NAME: BLINineSlice
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLTextureHandle atlas -> texture holding the skin
+*	BLRect uv -> region of the skin in atlas (texture coords)
+*	BLInt W -> width of the region (texels)
+*	BLInt H -> height of the region (texels)
+*	BLInt left   -> width of the left edge (texels)
+*	BLInt right  -> width of the right edge (texels)
+*	BLInt bottom -> height of the bottom edge (texels)
+*	BLInt top    -> height of the top edge (texels)
+* NOTE:
+*	Corners are drawn unscaled, edges stretch along one axis
+*	and the middle stretches along both
+*************************************************************/
+typedef struct BLINineSlice
+{
+	BLTextureHandle atlas;
+	BLRect          uv;
+	BLInt           W;
+	BLInt           H;
+	BLInt           left;
+	BLInt           right;
+	BLInt           bottom;
+	BLInt           top;
+}BLINineSlice;
+
 /*************************************************************
 * NAME: BLInitICore
 * DATE: 2021 - 09 - 2
@@ -131,7 +263,9 @@ BLRecti BLCenterRecti(BLRecti tRect, enum BL_CENTER_TYPE cType);
 *	BLColor color -> render color
 * RETURNS:
 *	void
-* NOTE: N/A
+* NOTE:
+*	Drawn through IBatch, boxes between BLIBeginBatch and
+*	BLIEndBatch merge into one draw
 *************************************************************/
 void BLIRenderBox(BLRecti bounds, BLColor color);
 
@@ -145,10 +279,92 @@ void BLIRenderBox(BLRecti bounds, BLColor color);
 *	BLColor oColor -> outline color
 * RETURNS:
 *	void
-* NOTE: N/A
+* NOTE:
+*	The outline is drawn around the inner box instead of
+*	under it, so every pixel is filled once. Both are culled
+*	and batched together
 *************************************************************/
 void BLIRenderBoxOutlined(BLRecti bounds, BLColor bColor, BLUInt oSize, BLColor oColor);
 
+/*************************************************************
+* NAME: BLIRenderBoxBorder
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLRecti bounds -> screenspace coords for rectangle
+*	BLUInt  oSize  -> outline size (in pixels)
+*	BLColor oColor -> outline color
+* RETURNS:
+*	void
+* NOTE:
+*	Only the outline, the inside is left alone
+*************************************************************/
+void BLIRenderBoxBorder(BLRecti bounds, BLUInt oSize, BLColor oColor);
+
+/*************************************************************
+* NAME: BLIRenderBoxRounded
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLRecti bounds -> screenspace coords for rectangle
+*	BLInt radius   -> corner radius (in pixels)
+*	BLColor color  -> render color
+* RETURNS:
+*	void
+* NOTE:
+*	Corners are cut from the shape texture, so rounded boxes
+*	merge with plain ones
+*************************************************************/
+void BLIRenderBoxRounded(BLRecti bounds, BLInt radius, BLColor color);
+
+/*************************************************************
+* NAME: BLIRenderBoxShadow
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLRecti bounds -> screenspace coords of the box casting
+*	the shadow
+*	BLInt blur     -> distance the shadow fades over (in
+*	pixels)
+*	BLColor color  -> shadow color
+* RETURNS:
+*	void
+* NOTE:
+*	The shadow spreads blur pixels past bounds and is half
+*	faded at the edge of bounds. Offset bounds to move it
+*************************************************************/
+void BLIRenderBoxShadow(BLRecti bounds, BLInt blur, BLColor color);
+
+/*************************************************************
+* NAME: BLICreateNineSlice
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLTextureHandle atlas -> texture holding the skin
+*	BLRect uv -> region of the skin in atlas (texture coords),
+*	(0, 0, 1, 1) for the whole texture
+*	BLInt W -> width of the region (texels)
+*	BLInt H -> height of the region (texels)
+*	BLInt inset -> size of every edge (texels)
+* RETURNS:
+*	BLINineSlice created from params
+* NOTE:
+*	Set left, right, bottom and top after for uneven edges
+*************************************************************/
+BLINineSlice BLICreateNineSlice(BLTextureHandle atlas, BLRect uv, BLInt W, BLInt H, BLInt inset);
+
+/*************************************************************
+* NAME: BLIRenderBoxNineSlice
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLRecti bounds -> screenspace coords for rectangle
+*	const BLINineSlice* slice -> skin to draw
+*	BLColor tint -> color to tint the skin
+* RETURNS:
+*	void
+* NOTE:
+*	All 9 parts go into the batch in one call, so panels
+*	sharing a skin atlas are drawn with one bind. Edges are
+*	shrunk evenly when bounds is smaller than them
+*************************************************************/
+void BLIRenderBoxNineSlice(BLRecti bounds, const BLINineSlice* slice, BLColor tint);
+
 /*************************************************************
 * NAME: BLIRenderBoxTextured
 * DATE: 2021 - 09 - 2
@@ -157,7 +373,8 @@ void BLIRenderBoxOutlined(BLRecti bounds, BLColor bColor, BLUInt oSize, BLColor
 *	BLTextureHandle tHndl -> texture to render
 * RETURNS:
 *	void
-* NOTE: N/A
+* NOTE:
+*	Drawn through IBatch, boxes with the same texture merge
 *************************************************************/
 void BLIRenderBoxTextured(BLRecti bounds, BLTextureHandle tHndl);
 
@@ -170,10 +387,69 @@ void BLIRenderBoxTextured(BLRecti bounds, BLTextureHandle tHndl);
 *	BLColor colorLeft  -> leftside color of box
 * RETURNS:
 *	void
-* NOTE: N/A
+* NOTE:
+*	Drawn through IBatch, same as BLIRenderBox
 *************************************************************/
 void BLIRenderBoxGradient(BLRecti bounds, BLColor colorRight, BLColor colorLeft);
 
+/*************************************************************
+* NAME: BLIRenderBoxGradientVertical
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLRecti bounds -> screenspace coords for rectangle
+*	BLColor colorTop    -> top color of box
+*	BLColor colorBottom -> bottom color of box
+* RETURNS:
+*	void
+* NOTE:
+*	Drawn through IBatch, same as BLIRenderBox
+*************************************************************/
+void BLIRenderBoxGradientVertical(BLRecti bounds, BLColor colorTop, BLColor colorBottom);
+
+/*************************************************************
+* NAME: BLIRenderBoxGradientStops
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLRecti bounds -> screenspace coords for rectangle
+*	enum BL_IGRADIENT_DIR dir -> which way colors change
+*	const BLIGradientStop* stops -> stops in order of pos
+*	BLUInt stopCount -> amount of stops (up to
+*	BL_ICORE_GRADIENT_STOP_MAX)
+* RETURNS:
+*	void
+* NOTE:
+*	One quad per band between stops, all put in the batch in
+*	one call. Before the first stop and after the last the
+*	color is held
+*************************************************************/
+void BLIRenderBoxGradientStops(BLRecti bounds, enum BL_IGRADIENT_DIR dir, const BLIGradientStop* stops, BLUInt stopCount);
+
+/*************************************************************
+* NAME: BLISetClipRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLRecti clipRect -> screenspace clip rect
+* RETURNS:
+*	void
+* NOTE:
+*	Draws batched quads first, then everything drawn is cut to
+*	clipRect. Boxes, lines and glyphs fully outside of it (or
+*	the viewport) are culled before they're sent to openGL
+*************************************************************/
+void BLISetClipRect(BLRecti clipRect);
+
+/*************************************************************
+* NAME: BLIClearClipRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Draws batched quads first
+*************************************************************/
+void BLIClearClipRect( );
+
 /*************************************************************
 * NAME: BLIRenderString
 * DATE: 2021 - 09 - 2
@@ -235,6 +511,155 @@ int BLIRenderStringRect(const BLByte* str, BLRecti rBounds, BLUInt scale, enum B
 *************************************************************/
 int BLIRenderStringRectBorder(const BLByte* str, BLRecti rBounds, BLUInt scale, BLUInt border, enum BL_GFONT_TYPE sType);
 
+/*************************************************************
+* NAME: BLISetStringMode
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	enum BL_ISTRING_MODE sMode -> mode to draw strings with
+* RETURNS:
+*	void
+* NOTE:
+*	Affects every BLIRenderString* function, the default is
+*	BL_ISTRING_MODE_BITMAP. Layouts are the same in both modes
+*************************************************************/
+void BLISetStringMode(enum BL_ISTRING_MODE sMode);
+
+/*************************************************************
+* NAME: BLIGetStringMode
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	enum BL_ISTRING_MODE that strings are drawn with
+* NOTE: N/A
+*************************************************************/
+enum BL_ISTRING_MODE BLIGetStringMode( );
+
+/*************************************************************
+* NAME: BLISetBitmapFont
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLBitmapFont* font -> font to draw strings with (NULL
+*	for the built in font)
+* RETURNS:
+*	void
+* NOTE:
+*	Affects every BLIRenderString* function. With a bitmap font
+*	set, scale is the height of the font's bounding box and each
+*	glyph uses the font's own size and advance. Strings are read
+*	as UTF-8. Bitmap fonts ignore BL_ISTRING_MODE_SDF. The font
+*	must outlive its use
+*************************************************************/
+void BLISetBitmapFont(const BLBitmapFont* font);
+
+/*************************************************************
+* NAME: BLIGetBitmapFont
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	const BLBitmapFont* that strings are drawn with (NULL for
+*	the built in font)
+* NOTE: N/A
+*************************************************************/
+const BLBitmapFont* BLIGetBitmapFont( );
+
+/*************************************************************
+* NAME: BLISetGlyphCache
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLGlyphCache* gCache -> glyph cache to draw glyphs through
+*	(NULL to use the font's own atlas)
+* RETURNS:
+*	void
+* NOTE:
+*	Only used while the bitmap font is the glyph cache's font.
+*	Fonts too large for their own atlas need a glyph cache.
+*	The atlas should hold more glyphs than a single string uses.
+*	Sets the glyph cache's evict hook to flush the batch
+*************************************************************/
+void BLISetGlyphCache(BLGlyphCache* gCache);
+
+/*************************************************************
+* NAME: BLIGetGlyphCache
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLGlyphCache* that glyphs are drawn through (NULL for none)
+* NOTE: N/A
+*************************************************************/
+BLGlyphCache* BLIGetGlyphCache( );
+
+/*************************************************************
+* NAME: BLIGetGlyphAtlas
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt codepoint -> codepoint of glyph
+*	BLRect* uv       -> set to the glyph's texture coords
+* RETURNS:
+*	BLTextureHandle of the atlas that the current font and
+*	string mode draw codepoint from
+* NOTE:
+*	uv has a width of 0 for glyphs with nothing to draw
+*************************************************************/
+BLTextureHandle BLIGetGlyphAtlas(BLUInt codepoint, BLRect* uv);
+
+/*************************************************************
+* NAME: BLILayoutString
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLByte* str -> string to layout
+*	BLRecti rBounds   -> bounds of the string (only X and Y are
+*	used for BL_ISTRING_LAYOUT_LINE, as the top left)
+*	BLUInt scale -> scale of each letter (in pixels)
+*	enum BL_ISTRING_LAYOUT lType -> which render function to match
+*	BLIGlyph* gBuf   -> buffer to write glyphs to (can be NULL)
+*	BLUInt gBufSize  -> size of gBuf
+*	int* fits        -> set to 0 if the string left rBounds, 1
+*	otherwise (can be NULL)
+* RETURNS:
+*	BLUInt, total amount of glyphs in the layout
+* NOTE:
+*	Produces the exact glyphs that the matching BLIRenderString*
+*	function would draw, in a single pass with no allocations.
+*	If the return value is larger than gBufSize, only the first
+*	gBufSize glyphs were written
+*************************************************************/
+BLUInt BLILayoutString(const BLByte* str, BLRecti rBounds, BLUInt scale, enum BL_ISTRING_LAYOUT lType, BLIGlyph* gBuf, BLUInt gBufSize, int* fits);
+
+/*************************************************************
+* NAME: BLIMeasureString
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLByte* str -> string to measure
+*	BLUInt scale -> scale of each letter (in pixels)
+* RETURNS:
+*	BLITextMetrics of the string as BLIRenderString or
+*	BLIRenderStringCentered would draw it
+* NOTE:
+*	Uses the same layout as rendering. O(n) and allocation
+*	free, fits is always 1
+*************************************************************/
+BLITextMetrics BLIMeasureString(const BLByte* str, BLUInt scale);
+
+/*************************************************************
+* NAME: BLIMeasureStringRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLByte* str -> string to measure
+*	BLRecti rBounds -> bounds the string wraps in
+*	BLUInt scale -> scale of each letter (in pixels)
+* RETURNS:
+*	BLITextMetrics of the string as BLIRenderStringRect would
+*	draw it
+* NOTE:
+*	Uses the same layout as rendering. O(n) and allocation
+*	free. Lines that don't fit are still measured, so height
+*	can be larger than rBounds when fits is 0
+*************************************************************/
+BLITextMetrics BLIMeasureStringRect(const BLByte* str, BLRecti rBounds, BLUInt scale);
+
 /*************************************************************
 * NAME: BLICheckMouseOverlap
 * DATE: 2021 - 09 - 3
@@ -324,7 +749,9 @@ BLByte BLIGetCharDown( );
 *	a continuous stream of chars if key is held down
 * NOTE:
 *	This function covers ALL CHARS and is intended for
-*	typing related purposes
+*	typing related purposes. Reads the key presses and repeats
+*	of the window being rendered to, one per call, NULL once
+*	this update's are used up
 *************************************************************/
 BLByte BLIGetChar( );
 
@@ -14,62 +14,48 @@
 *************************************************************/
 
 #include <stdio.h>   // I/O
+#include <stdlib.h>  // For the glyph arena
+#include <string.h>  // For string length
 #include <Windows.h> // OpenGL dependancy
-#include <WinUser.h> // Mouse input
 #include <gl/GL.h>   // For rendering
-#include <gl/GLU.h>  // For projection related functions
+#include <glfw3.h>   // For key codes
 
 #include "ICore.h"   // Header
+#include "IBatch.h"  // For batching boxes and glyphs
 
 /*************************************************************
-* NAME: BLHelperSetupProjectionMatrix
-* DATE: 2021 - 09 - 2
+* NAME: BLHelperCheckOutside
+* DATE: 2026 - 10 - 19
 * PARAMS:
-*	none
+*	BLRecti bounds -> screenspace bounds to check
+*	BLRect visible -> visible rect from BLGetVisibleRect
 * RETURNS:
-*	void
+*	int, 1 if bounds are fully outside of visible, 0 if not
 * NOTE:
 *	FILE SPECIFIC FUNCTION
-*	This function sets up the projection matrix based on the
-*	viewport dimensions
 *************************************************************/
-static inline void BLHelperSetupProjectionMatrix( )
+static inline int BLHelperCheckOutside(BLRecti bounds, BLRect visible)
 {
-	//var to get viewport dimensions
-	//0 -> X, 1 -> Y, 2 -> width, 3 -> height
-	int viewPortDimensions[4];
-	glGetIntegerv(GL_VIEWPORT, viewPortDimensions);
-
-	//set matrix mode and clear
-	glMatrixMode(GL_PROJECTION);
-	glLoadIdentity( );
-
-	//set so that modelspace maps to screenspace
-	gluOrtho2D(0, viewPortDimensions[2], 0, viewPortDimensions[3]);
-
-	//end
-	return;
+	return (float)(bounds.X + bounds.W) <= visible.X || (float)bounds.X >= visible.X + visible.width ||
+		(float)(bounds.Y + bounds.H) <= visible.Y || (float)bounds.Y >= visible.Y + visible.height;
 }
 
 /*************************************************************
-* NAME: BLHelperSetupTexEnv
-* DATE: 2021 - 09 - 2
+* NAME: BLHelperCullBox
+* DATE: 2026 - 10 - 19
 * PARAMS:
-*	BLTextureHandle texHandle -> texture handle to setup
+*	BLRecti bounds -> screenspace bounds of box
 * RETURNS:
-*	void
+*	int, 1 if the box can't be seen, 0 if it can
 * NOTE:
 *	FILE SPECIFIC FUNCTION
-*	Call this function before a render pass to set up the
-*	texture environment
+*	Counts the result in the cull stats
 *************************************************************/
-static inline void BLHelperSetupTexEnv(BLTextureHandle texHandle)
+static int BLHelperCullBox(BLRecti bounds)
 {
-	glShadeModel(GL_FLAT);
-	glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_REPLACE);
-	glBindTexture(GL_TEXTURE_2D, (GLuint)texHandle);
-	glEnable(GL_TEXTURE_2D);
-	return;
+	const int culled = BLHelperCheckOutside(bounds, BLGetVisibleRect( ));
+	BLAddCullStats(culled == 0, culled != 0, 0);
+	return culled;
 }
 
 /*************************************************************
@@ -113,12 +99,7 @@ BLRecti BLScaleRecti(BLRecti tRect, float scale)
 
 	//move x and y by half of difference
 	float newX = (float)tRect.X - (wDiff / 2.0f);
-	float newY = (float)tRect.Y - (wDiff / 2.0f);
-
-	//get viewport dimensions for clamping
-	//0 -> X, 1 -> Y, 2 -> width, 3 -> height
-	int viewPortDimensions[4];
-	glGetIntegerv(GL_VIEWPORT, viewPortDimensions);
+	float newY = (float)tRect.Y - (hDiff / 2.0f);
 
 	//end
 	return BLCreateRecti((BLInt)newX, (BLInt)newY, (BLInt)scaledW, (BLInt)scaledH);
@@ -178,6 +159,18 @@ BLRecti BLCenterRecti(BLRecti tRect, enum BL_CENTER_TYPE cType)
 	return tRect;
 }
 
+/*************************************************************
+* NAME: layoutArena (object)
+* DATE: 2026 - 10 - 19
+* USE:
+*	Glyph buffer that the BLIRenderString* functions lay out
+*	into before drawing. Grows to fit the longest string seen,
+*	after that laying out strings allocates nothing
+* NOTE: N/A
+*************************************************************/
+static BLIGlyph* layoutArena     = NULL;
+static BLUInt    layoutArenaSize = 0;
+
 /*************************************************************
 * NAME: BLInitICore
 * DATE: 2021 - 09 - 2
@@ -204,6 +197,11 @@ int BLInitICore( )
 void BLTerminateICore( )
 {
 	BLTerminateGFont( );
+
+	//free glyph arena
+	free(layoutArena);
+	layoutArena     = NULL;
+	layoutArenaSize = 0;
 }
 
 /*************************************************************
@@ -214,48 +212,21 @@ void BLTerminateICore( )
 *	BLColor color -> render color
 * RETURNS:
 *	void
-* NOTE: N/A
+* NOTE:
+*	Drawn through IBatch, boxes between BLIBeginBatch and
+*	BLIEndBatch merge into one draw
 *************************************************************/
 void BLIRenderBox(BLRecti bounds, BLColor color)
 {
-	//set up projection matrix to match up with screenspace
-	BLHelperSetupProjectionMatrix( );
-
-	//load modelview and reset matrix
-	glMatrixMode(GL_MODELVIEW);
-	glLoadIdentity( );
-
-	//normailze each color
-	const GLfloat rNorm = (GLfloat)color.R / 255.0;
-	const GLfloat gNorm = (GLfloat)color.G / 255.0;
-	const GLfloat bNorm = (GLfloat)color.B / 255.0;
-	const GLfloat aNorm = (GLfloat)color.A / 255.0;
-
-	//set draw color
-	glColor4f(rNorm, gNorm, bNorm, aNorm);
-
-	//precalculate box coords
-	const GLfloat bX = (GLfloat)bounds.X; //bottom x
-	const GLfloat bY = (GLfloat)bounds.Y; //bottom y
-	const GLfloat tX = (GLfloat)(bounds.X + bounds.W); //top x
-	const GLfloat tY = (GLfloat)(bounds.Y + bounds.H); //top y
-
-	//render (disable textures)
-	glDisable(GL_TEXTURE_2D);
-
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-	glBegin(GL_QUADS);
-
-	glVertex2f(bX, bY); //bottom left
-	glVertex2f(bX, tY); //top left
-	glVertex2f(tX, tY); //top right
-	glVertex2f(tX, bY); //bottom right
-
-	glEnd( );
+	//skip boxes that can't be seen
+	if(BLHelperCullBox(bounds))
+	{
+		return;
+	}
 
-	glDisable(GL_BLEND);
+	//batch with the shape texture, so every kind of box merges
+	BLIBatchQuad(BLIGetShapeTexture( ), 0, bounds, BLCreateRect(BL_IBATCH_SOLID_U, BL_IBATCH_SOLID_V, 0.0f, 0.0f), color);
+	BLISubmitBatch( );
 
 	//end
 	return;
@@ -271,72 +242,207 @@ void BLIRenderBox(BLRecti bounds, BLColor color)
 *	BLColor oColor -> outline color
 * RETURNS:
 *	void
-* NOTE: N/A
+* NOTE:
+*	The outline is drawn around the inner box instead of
+*	under it, so every pixel is filled once. Both are culled
+*	and batched together
 *************************************************************/
 void BLIRenderBoxOutlined(BLRecti bounds, BLColor bColor, BLUInt oSize, BLColor oColor)
 {
+	//skip boxes that can't be seen
+	if(BLHelperCullBox(bounds))
+	{
+		return;
+	}
+
 	//create inner box
 	BLRecti boxInner = { bounds.X + oSize, bounds.Y + oSize, bounds.W - (oSize * 2), bounds.H - (oSize * 2) };
 
-	//render outer box
-	BLIRenderBox(bounds, oColor);
+	//outline, then inner box right after it
+	BLIVertex verts[BL_IBATCH_BORDER_VERTS + 4];
+	BLUInt    vertCount = BLIBuildBorder(verts, bounds, oSize, oColor);
+	if(boxInner.W > 0 && boxInner.H > 0)
+	{
+		vertCount += BLIBuildQuad(verts + vertCount, boxInner, bColor, bColor);
+	}
 
-	//render inner box
-	BLIRenderBox(boxInner, bColor);
+	BLIBatchVerts(BLIGetShapeTexture( ), 0, verts, vertCount);
+	BLISubmitBatch( );
 
 	//end
 	return;
 }
 
 /*************************************************************
-* NAME: BLIRenderBoxTextured
-* DATE: 2021 - 09 - 2
+* NAME: BLIRenderBoxBorder
+* DATE: 2026 - 10 - 19
 * PARAMS:
-*	BLRect bounds -> screenspace coords for rectangle
-*	BLTextureHandle tHndl -> texture to render
+*	BLRecti bounds -> screenspace coords for rectangle
+*	BLUInt  oSize  -> outline size (in pixels)
+*	BLColor oColor -> outline color
 * RETURNS:
 *	void
-* NOTE: N/A
+* NOTE:
+*	Only the outline, the inside is left alone
 *************************************************************/
-void BLIRenderBoxTextured(BLRecti bounds, BLTextureHandle tHndl)
+void BLIRenderBoxBorder(BLRecti bounds, BLUInt oSize, BLColor oColor)
 {
-	//set up projection matrix to match up with screenspace
-	BLHelperSetupProjectionMatrix( );
+	//skip boxes that can't be seen
+	if(oSize == 0 || BLHelperCullBox(bounds))
+	{
+		return;
+	}
+
+	BLIVertex    verts[BL_IBATCH_BORDER_VERTS];
+	const BLUInt vertCount = BLIBuildBorder(verts, bounds, oSize, oColor);
+	BLIBatchVerts(BLIGetShapeTexture( ), 0, verts, vertCount);
+	BLISubmitBatch( );
+
+	//end
+	return;
+}
 
-	//bind texture
-	BLHelperSetupTexEnv(tHndl);
+/*************************************************************
+* NAME: BLIRenderBoxRounded
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLRecti bounds -> screenspace coords for rectangle
+*	BLInt radius   -> corner radius (in pixels)
+*	BLColor color  -> render color
+* RETURNS:
+*	void
+* NOTE:
+*	Corners are cut from the shape texture, so rounded boxes
+*	merge with plain ones
+*************************************************************/
+void BLIRenderBoxRounded(BLRecti bounds, BLInt radius, BLColor color)
+{
+	//skip boxes that can't be seen
+	if(BLHelperCullBox(bounds))
+	{
+		return;
+	}
 
-	//load modelview and reset matrix
-	glMatrixMode(GL_MODELVIEW);
-	glLoadIdentity();
+	BLIVertex verts[BL_IBATCH_NINE_VERTS];
+	BLIBuildRounded(verts, bounds, radius, BL_IBATCH_SHAPE_ROUND, color);
+	BLIBatchVerts(BLIGetShapeTexture( ), 0, verts, BL_IBATCH_NINE_VERTS);
+	BLISubmitBatch( );
 
-	//precalculate box coords
-	const GLfloat bX = (GLfloat)bounds.X; //bottom x
-	const GLfloat bY = (GLfloat)bounds.Y; //bottom y
-	const GLfloat tX = (GLfloat)(bounds.X + bounds.W); //top x
-	const GLfloat tY = (GLfloat)(bounds.Y + bounds.H); //top y
+	//end
+	return;
+}
 
-	//render (with texture)
-	glEnable(GL_TEXTURE_2D);
+/*************************************************************
+* NAME: BLIRenderBoxShadow
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLRecti bounds -> screenspace coords of the box casting
+*	the shadow
+*	BLInt blur     -> distance the shadow fades over (in
+*	pixels)
+*	BLColor color  -> shadow color
+* RETURNS:
+*	void
+* NOTE:
+*	The shadow spreads blur pixels past bounds and is half
+*	faded at the edge of bounds. Offset bounds to move it
+*************************************************************/
+void BLIRenderBoxShadow(BLRecti bounds, BLInt blur, BLColor color)
+{
+	//shadow covers bounds grown by blur
+	const BLRecti outer = BLCreateRecti(bounds.X - blur, bounds.Y - blur, bounds.W + (blur * 2), bounds.H + (blur * 2));
+	if(BLHelperCullBox(outer))
+	{
+		return;
+	}
 
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	BLIVertex verts[BL_IBATCH_NINE_VERTS];
+	BLIBuildRounded(verts, outer, blur * 2, BL_IBATCH_SHAPE_SOFT, color);
+	BLIBatchVerts(BLIGetShapeTexture( ), 0, verts, BL_IBATCH_NINE_VERTS);
+	BLISubmitBatch( );
 
-	glBegin(GL_QUADS);
+	//end
+	return;
+}
 
-	glTexCoord2f(0.0, 0.0); glVertex2f(bX, bY);
-	glTexCoord2f(0.0, 1.0); glVertex2f(bX, tY);
-	glTexCoord2f(1.0, 1.0); glVertex2f(tX, tY);
-	glTexCoord2f(1.0, 0.0); glVertex2f(tX, bY);
+/*************************************************************
+* NAME: BLICreateNineSlice
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLTextureHandle atlas -> texture holding the skin
+*	BLRect uv -> region of the skin in atlas (texture coords),
+*	(0, 0, 1, 1) for the whole texture
+*	BLInt W -> width of the region (texels)
+*	BLInt H -> height of the region (texels)
+*	BLInt inset -> size of every edge (texels)
+* RETURNS:
+*	BLINineSlice created from params
+* NOTE:
+*	Set left, right, bottom and top after for uneven edges
+*************************************************************/
+BLINineSlice BLICreateNineSlice(BLTextureHandle atlas, BLRect uv, BLInt W, BLInt H, BLInt inset)
+{
+	BLINineSlice slice = { atlas, uv, W, H, inset, inset, inset, inset };
+	return slice;
+}
 
-	glEnd();
+/*************************************************************
+* NAME: BLIRenderBoxNineSlice
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLRecti bounds -> screenspace coords for rectangle
+*	const BLINineSlice* slice -> skin to draw
+*	BLColor tint -> color to tint the skin
+* RETURNS:
+*	void
+* NOTE:
+*	All 9 parts go into the batch in one call, so panels
+*	sharing a skin atlas are drawn with one bind. Edges are
+*	shrunk evenly when bounds is smaller than them
+*************************************************************/
+void BLIRenderBoxNineSlice(BLRecti bounds, const BLINineSlice* slice, BLColor tint)
+{
+	//skip boxes that can't be seen
+	if(slice == NULL || BLHelperCullBox(bounds))
+	{
+		return;
+	}
 
-	glDisable(GL_BLEND);
-	glDisable(GL_TEXTURE_2D);
+	BLIVertex verts[BL_IBATCH_NINE_VERTS];
+	BLIBuildNineSlice(verts, bounds, slice, tint);
+	BLIBatchVerts(slice->atlas, 0, verts, BL_IBATCH_NINE_VERTS);
+	BLISubmitBatch( );
 
 	//end
 	return;
+}
+
+/*************************************************************
+* NAME: BLIRenderBoxTextured
+* DATE: 2021 - 09 - 2
+* PARAMS:
+*	BLRect bounds -> screenspace coords for rectangle
+*	BLTextureHandle tHndl -> texture to render
+* RETURNS:
+*	void
+* NOTE:
+*	Drawn through IBatch, boxes with the same texture merge
+*************************************************************/
+void BLIRenderBoxTextured(BLRecti bounds, BLTextureHandle tHndl)
+{
+	//skip boxes that can't be seen
+	if(BLHelperCullBox(bounds))
+	{
+		return;
+	}
 
+	//batch untinted, boxes with the same texture merge
+	const BLColor white = { 0xff, 0xff, 0xff, 0xff };
+	BLIBatchQuad(tHndl, 0, bounds, BLCreateRect(0.0f, 0.0f, 1.0f, 1.0f), white);
+	BLISubmitBatch( );
+
+	//end
+	return;
 }
 
 /*************************************************************
@@ -348,317 +454,1080 @@ void BLIRenderBoxTextured(BLRecti bounds, BLTextureHandle tHndl)
 *	BLColor colorLeft  -> leftside color of box
 * RETURNS:
 *	void
-* NOTE: N/A
+* NOTE:
+*	Drawn through IBatch, same as BLIRenderBox
 *************************************************************/
 void BLIRenderBoxGradient(BLRecti bounds, BLColor colorRight, BLColor colorLeft)
 {
-	//set up projection matrix to match up with screenspace
-	BLHelperSetupProjectionMatrix( );
-
-	//load modelview and reset matrix
-	glMatrixMode(GL_MODELVIEW);
-	glLoadIdentity();
-
-	//normailze each color (right side)
-	const GLfloat rrNorm = (GLfloat)colorRight.R / 255.0;
-	const GLfloat rgNorm = (GLfloat)colorRight.G / 255.0;
-	const GLfloat rbNorm = (GLfloat)colorRight.B / 255.0;
-	const GLfloat raNorm = (GLfloat)colorRight.A / 255.0;
-
-	//normailze each color (left side)
-	const GLfloat lrNorm = (GLfloat)colorLeft.R / 255.0;
-	const GLfloat lgNorm = (GLfloat)colorLeft.G / 255.0;
-	const GLfloat lbNorm = (GLfloat)colorLeft.B / 255.0;
-	const GLfloat laNorm = (GLfloat)colorLeft.A / 255.0;
-
-	//precalculate box coords
-	const GLfloat bX = (GLfloat)bounds.X; //bottom x
-	const GLfloat bY = (GLfloat)bounds.Y; //bottom y
-	const GLfloat tX = (GLfloat)(bounds.X + bounds.W); //top x
-	const GLfloat tY = (GLfloat)(bounds.Y + bounds.H); //top y
-
-	//render (disable textures)
-	glDisable(GL_TEXTURE_2D);
-
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-	glBegin(GL_QUADS);
-
-	glColor4f(lrNorm, lgNorm, lbNorm, laNorm); glVertex2f(bX, bY); //bottom left     color left
-	glColor4f(lrNorm, lgNorm, lbNorm, laNorm); glVertex2f(bX, tY); //top left        color left
-	glColor4f(rrNorm, rgNorm, rbNorm, raNorm); glVertex2f(tX, tY); //top right       color right
-	glColor4f(rrNorm, rgNorm, rbNorm, raNorm); glVertex2f(tX, bY); //bottom right    color right
+	//skip boxes that can't be seen
+	if(BLHelperCullBox(bounds))
+	{
+		return;
+	}
 
-	glEnd();
+	//colors are blended across by the vertex colors
+	BLIVertex quad[4];
+	BLIBuildQuad(quad, bounds, colorLeft, colorRight);
 
-	glDisable(GL_BLEND);
+	//batch with the shape texture
+	BLIBatchVerts(BLIGetShapeTexture( ), 0, quad, 4);
+	BLISubmitBatch( );
 
 	//end
 	return;
 }
 
 /*************************************************************
-* NAME: BLIRenderString
-* DATE: 2021 - 09 - 2
+* NAME: BLIRenderBoxGradientVertical
+* DATE: 2026 - 10 - 19
 * PARAMS:
-*	const BLByte* str -> string to render
-*	BLUInt tX -> top left X position
-*	BLUInt tY -> top left Y position
-*	BLUInt scale -> scale of each letter (in pixels)
-*	enum BL_GFONT_TYPE sType -> type of font to render
+*	BLRecti bounds -> screenspace coords for rectangle
+*	BLColor colorTop    -> top color of box
+*	BLColor colorBottom -> bottom color of box
 * RETURNS:
 *	void
-* NOTE: N/A
+* NOTE:
+*	Drawn through IBatch, same as BLIRenderBox
 *************************************************************/
-void BLIRenderString(const BLByte* str, BLUInt tX, BLUInt tY, BLUInt scale, enum BL_GFONT_TYPE sType)
+void BLIRenderBoxGradientVertical(BLRecti bounds, BLColor colorTop, BLColor colorBottom)
 {
-	//get length
-	const int sLen = strlen(str);
-
-	//rect dims for drawing
-	BLRecti drawRect = BLCreateRecti(tX - scale, tY - scale, scale, scale);
+	const BLIGradientStop stops[2] = { { 0.0f, colorTop }, { 1.0f, colorBottom } };
+	BLIRenderBoxGradientStops(bounds, BL_IGRADIENT_DIR_VERTICAL, stops, 2);
 
-	//tex handle
-	BLTextureHandle cHndl;
+	//end
+	return;
+}
 
-	//render loop
-	for(int i = 0; i < sLen; i++)
+/*************************************************************
+* NAME: BLIRenderBoxGradientStops
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLRecti bounds -> screenspace coords for rectangle
+*	enum BL_IGRADIENT_DIR dir -> which way colors change
+*	const BLIGradientStop* stops -> stops in order of pos
+*	BLUInt stopCount -> amount of stops (up to
+*	BL_ICORE_GRADIENT_STOP_MAX)
+* RETURNS:
+*	void
+* NOTE:
+*	One quad per band between stops, all put in the batch in
+*	one call. Before the first stop and after the last the
+*	color is held
+*************************************************************/
+void BLIRenderBoxGradientStops(BLRecti bounds, enum BL_IGRADIENT_DIR dir, const BLIGradientStop* stops, BLUInt stopCount)
+{
+	//skip boxes that can't be seen
+	if(BLHelperCullBox(bounds))
 	{
-		//check for newline
-		if(str[i] == '\n')
-		{
-			//reset x and increment Y
-			drawRect.X = tX - scale;
-			drawRect.Y = drawRect.Y - (BLUInt)((float)scale * BL_ICORE_NEWLINE_SCALE);
-		}
-		else
-		{
-			//draw rect
-			cHndl = BLGetFontTextureHandle(str[i], sType);
-			BLIRenderBoxTextured(drawRect, cHndl);
-
-			//increment x
-			drawRect.X = drawRect.X + (BLUInt)((float)scale * BL_ICORE_SPACE_SCALE);
-		}
+		return;
 	}
 
+	//batch with the shape texture, so gradients merge with every box
+	BLIVertex    verts[BL_IBATCH_GRADIENT_VERTS];
+	const BLUInt vertCount = BLIBuildGradient(verts, bounds, dir, stops, stopCount);
+	BLIBatchVerts(BLIGetShapeTexture( ), 0, verts, vertCount);
+	BLISubmitBatch( );
+
 	//end
 	return;
 }
 
 /*************************************************************
-* NAME: BLIRenderStringCentered
-* DATE: 2021 - 09 - 2
+* NAME: BLISetClipRect
+* DATE: 2026 - 10 - 19
 * PARAMS:
-*	const BLByte* str -> string to render
-*	BLRecti rBounds   -> bounds of string
-*	BLUInt scale -> scale of each letter (in pixels)
-*	enum BL_GFONT_TYPE sType -> type of font to render
+*	BLRecti clipRect -> screenspace clip rect
 * RETURNS:
 *	void
 * NOTE:
-*	If not newlined properly, string will write outside of bounds
-*	it is expected that the string has been newlined correctly to
-*	fit the bounds
+*	Draws batched quads first, then everything drawn is cut to
+*	clipRect. Boxes, lines and glyphs fully outside of it (or
+*	the viewport) are culled before they're sent to openGL
 *************************************************************/
-void BLIRenderStringCentered(const BLByte* str, BLRecti rBounds, BLUInt scale, enum BL_GFONT_TYPE sType)
+void BLISetClipRect(BLRecti clipRect)
 {
-	//get center of rBounds
-	BLInt centerX = rBounds.X + (rBounds.W / 2);
-	BLInt centerY = rBounds.Y + (rBounds.H / 2);
+	//pending quads were made for the old clip
+	BLIFlushBatch( );
+	BLSetClipRect(BLCreateRect((float)clipRect.X, (float)clipRect.Y, (float)clipRect.W, (float)clipRect.H));
+	return;
+}
 
-	//get string length
-	int sLen = strlen(str);
+/*************************************************************
+* NAME: BLIClearClipRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Draws batched quads first
+*************************************************************/
+void BLIClearClipRect( )
+{
+	BLIFlushBatch( );
+	BLClearClipRect( );
+	return;
+}
 
-	//create newline buffer
-	BLByte nlBuff[BL_ICORE_LINE_COUNT][BL_ICORE_LINE_BUF_SIZE];
+/*************************************************************
+* NAME: stringMode (object)
+* DATE: 2026 - 10 - 19
+* USE:
+*	Mode that every BLIRenderString* function draws with
+* NOTE: N/A
+*************************************************************/
+static enum BL_ISTRING_MODE stringMode = BL_ISTRING_MODE_BITMAP;
 
-	//empty buffer
-	for(int i = 0; i < BL_ICORE_LINE_COUNT; i++)
-	{
-		for(int j = 0; j < BL_ICORE_LINE_BUF_SIZE; j++)
-		{
-			nlBuff[i][j] = (BLByte)NULL;
-		}
-	}
+/*************************************************************
+* NAME: bitmapFont (object)
+* DATE: 2026 - 10 - 19
+* USE:
+*	Font that every BLIRenderString* function draws with (NULL
+*	for the built in font)
+* NOTE: N/A
+*************************************************************/
+static const BLBitmapFont* bitmapFont = NULL;
 
-	//break str into newline
-	int lineCount = 0;
-	int lineIndex = 0;
+/*************************************************************
+* NAME: glyphCache (object)
+* DATE: 2026 - 10 - 19
+* USE:
+*	Glyph cache that bitmap font glyphs are drawn through
+*	(NULL for the font's own atlas)
+* NOTE: N/A
+*************************************************************/
+static BLGlyphCache* glyphCache = NULL;
 
-	for(int i = 0; i < sLen; i++)
+/*************************************************************
+* NAME: BLHelperGlyphAdvance
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt codepoint -> codepoint of glyph
+*	BLUInt scale     -> scale of each letter (in pixels)
+* RETURNS:
+*	BLInt, pixels to move right after the glyph
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline BLInt BLHelperGlyphAdvance(BLUInt codepoint, BLUInt scale)
+{
+	//built in font is monospaced
+	if(bitmapFont == NULL)
 	{
-		//check if newline
-		if(str[i] == '\n')
-		{
-			//increment count and reset
-			//line index
-			lineCount++;
-			lineIndex = 0;
-		}
-		else
-		{
-			//write to nlBuf
-			nlBuff[lineCount][lineIndex] = str[i];
-
-			//increment line index
-			lineIndex++;
-		}
+		return (BLUInt)((float)scale * BL_ICORE_SPACE_SCALE);
 	}
 
-	//setup draw position vars
-	BLInt drawX = 0;
-	BLInt drawY = 0;
-
-	//set draw Y
-	drawY = centerY + ((lineCount * (scale * BL_ICORE_NEWLINE_SCALE)) / 2);
+	//scale font pixels so the bounding box is scale tall
+	const BLBitmapGlyph* glyph = BLGetBitmapGlyph(bitmapFont, codepoint);
+	return (BLInt)(((float)glyph->advance * (float)scale / (float)bitmapFont->boxH) + 0.5f);
+}
 
-	//render each line
-	for(int i = 0; i < lineCount + 1; i++)
+/*************************************************************
+* NAME: BLHelperGlyphBounds
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt codepoint -> codepoint of glyph
+*	BLRecti cell     -> layout cell of glyph (scale x scale)
+* RETURNS:
+*	BLRecti, screenspace bounds of glyph
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	The bottom of the cell is the bottom of the font's
+*	bounding box
+*************************************************************/
+static inline BLRecti BLHelperGlyphBounds(BLUInt codepoint, BLRecti cell)
+{
+	//built in glyphs fill the cell
+	if(bitmapFont == NULL)
 	{
-		//first, get char count
-		int lineCharCount = strlen(nlBuff[i]) - 1;
-		
-		//get size
-		int lineSize = scale * 1.5;
-		for(int j = 0; j < lineCharCount; j++)
-		{
-			//check if space char
-			if(nlBuff[i][j] == ' ')
-			{
-				lineSize += scale * BL_ICORE_SPACE_SCALE;
-			}
-			else
-			{
-				lineSize += scale;
-			}
-		}
-
-		//calculate starting position (drawX)
-		drawX = centerX - (lineSize / 2);
+		return cell;
+	}
 
-		//draw string
-		//remember: BLIRenderString renders from the top left, which i need to eliminate
-		BLIRenderString(nlBuff[i], drawX, drawY + (scale / 2), scale, sType);
+	//place glyph relative to the baseline
+	const BLBitmapGlyph* glyph = BLGetBitmapGlyph(bitmapFont, codepoint);
+	const float fScale = (float)cell.H / (float)bitmapFont->boxH;
 
-		//newline
-		drawY -= scale * BL_ICORE_NEWLINE_SCALE;
-	}
+	return BLCreateRecti(cell.X + (BLInt)((float)glyph->offX * fScale),
+		cell.Y + (BLInt)((float)(glyph->offY - bitmapFont->boxOffY) * fScale),
+		(BLInt)((float)glyph->width * fScale + 0.5f), (BLInt)((float)glyph->height * fScale + 0.5f));
 }
 
 /*************************************************************
-* NAME: BLIRenderStringRect
-* DATE: 2021 - 09 - 2
+* NAME: BLHelperLayout
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLRecti rBounds  -> bounds of the string
+*	BLUInt scale     -> scale of each letter (in pixels)
+*	enum BL_ISTRING_LAYOUT lType -> how lines are placed
+*	BLIGlyph* gBuf   -> buffer to write glyphs to (can be NULL)
+*	BLUInt gBufSize  -> size of gBuf
+*	BLUInt gCount    -> glyphs laid out so far
+*	BLUInt lineCount -> lines laid out so far
+*	BLInt width      -> width of the widest line
+*	int fits         -> 0 once a line left rBounds (RECT only)
+*	BLInt lineStep   -> pixels between lines
+*	BLInt originX    -> left of every line
+*	BLInt penX       -> left of the next glyph cell
+*	BLInt penY       -> bottom of the current line
+*	BLInt lineRight  -> right edge of the current line
+*	BLUInt lineFirst -> first glyph of the current line
+*	BLUInt wordFirst -> first glyph of the current word
+*	BLInt wordX      -> penX at the start of the current word
+*	BLInt wordLineRight -> lineRight at the start of the word
+*	int cull         -> 1 to skip lines outside of cullMinY and
+*	cullMaxY
+*	BLInt cullMinY   -> bottom of the visible rect
+*	BLInt cullMaxY   -> top of the visible rect
+*	int lineVisible  -> 0 if the current line is culled
+*	BLUInt culledLines -> lines culled so far
+* NOTE:
+*	File specific struct, holds the state of a single pass
+*	through a string. Glyphs past the end of gBuf are counted
+*	but not stored, glyphs after the string leaves rBounds or
+*	on culled lines are neither (lines are still measured)
+*************************************************************/
+typedef struct BLHelperLayout
+{
+	BLRecti                rBounds;
+	BLUInt                 scale;
+	enum BL_ISTRING_LAYOUT lType;
+	BLIGlyph*              gBuf;
+	BLUInt                 gBufSize;
+	BLUInt                 gCount;
+	BLUInt                 lineCount;
+	BLInt                  width;
+	int                    fits;
+	BLInt                  lineStep;
+	BLInt                  originX;
+	BLInt                  penX;
+	BLInt                  penY;
+	BLInt                  lineRight;
+	BLUInt                 lineFirst;
+	BLUInt                 wordFirst;
+	BLInt                  wordX;
+	BLInt                  wordLineRight;
+	int                    cull;
+	BLInt                  cullMinY;
+	BLInt                  cullMaxY;
+	int                    lineVisible;
+	BLUInt                 culledLines;
+}BLHelperLayout;
+
+/*************************************************************
+* NAME: BLHelperNextCodepoint
+* DATE: 2026 - 10 - 19
 * PARAMS:
-*	const BLByte* str -> string to render
-*	BLRecti rBounds -> bounds of the string to render
-*	BLUInt scale -> scale of each letter (in pixels)
-*	enum BL_GFONT_TYPE sType -> type of font to render
+*	const BLByte** str -> string position (moved past the
+*	codepoint)
 * RETURNS:
-*	int, 1 for success, 0 for string out of rect bounds
-* NOTE: N/A
+*	BLUInt, next codepoint of the string
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Bitmap font strings are UTF-8, the built in font has a
+*	glyph per byte. Broken sequences are read a byte at a time
 *************************************************************/
-int BLIRenderStringRect(const BLByte* str, BLRecti rBounds, BLUInt scale, enum BL_GFONT_TYPE sType)
+static inline BLUInt BLHelperNextCodepoint(const BLByte** str)
 {
-	//get string length
-	const int sLen = strlen(str);
+	const BLByte* seq = *str;
 
-	//create buffer for word seperation
-	char wBuf[BL_ICORE_STRING_WORD_COUNT][BL_ICORE_WORD_BUF_SIZE];
-
-	//zero memory
-	for(int i = 0; i < BL_ICORE_STRING_WORD_COUNT; i++)
+	//single byte
+	if(bitmapFont == NULL || seq[0] < 0xC0)
 	{
-		for(int j = 0; j < BL_ICORE_WORD_BUF_SIZE; j++)
-		{
-			wBuf[i][j] = (char)NULL;
-		}
+		*str = seq + 1;
+		return seq[0];
 	}
 
-	//word counter and index
-	int wCount = 0;
-	int wIndex = 0;
+	//get sequence length
+	const int seqLen = (seq[0] >= 0xF0) ? 4 : (seq[0] >= 0xE0) ? 3 : 2;
+	BLUInt codepoint = seq[0] & (0x7F >> seqLen);
 
-	//break string into words
-	for(int i = 0; i < sLen; i++)
+	//read continuation bytes (stops at the null terminator)
+	for(int i = 1; i < seqLen; i++)
 	{
-		if(str[i] == ' ')
-		{
-			//keep space
-			wBuf[wCount][wIndex] = ' ';
-
-			//increment and reset
-			wCount++;
-			wIndex = 0;
-		}
-		else
+		if((seq[i] & 0xC0) != 0x80)
 		{
-			wBuf[wCount][wIndex] = str[i];
-			wIndex++;
+			*str = seq + 1;
+			return seq[0];
 		}
+		codepoint = (codepoint << 6) | (seq[i] & 0x3F);
 	}
 
-	//increment word count
-	wCount++;
+	//end
+	*str = seq + seqLen;
+	return codepoint;
+}
 
-	//create rect for drawing
-	BLRecti drawrect = BLCreateRecti(rBounds.X, rBounds.Y + rBounds.H - scale, scale, scale);
+/*************************************************************
+* NAME: BLHelperMoveGlyphs
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLHelperLayout* layout -> layout to change
+*	BLUInt first -> first glyph to move
+*	BLInt moveX  -> pixels to move right
+*	BLInt moveY  -> pixels to move up
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Moves glyphs from first to the end of the layout
+*************************************************************/
+static inline void BLHelperMoveGlyphs(BLHelperLayout* layout, BLUInt first, BLInt moveX, BLInt moveY)
+{
+	//check for buffer
+	if(layout->gBuf == NULL)
+	{
+		return;
+	}
 
-	//loop through every word
-	for(int i = 0; i < wCount; i++)
+	//move every stored glyph
+	const BLUInt last = (layout->gCount < layout->gBufSize) ? layout->gCount : layout->gBufSize;
+	for(BLUInt i = first; i < last; i++)
 	{
-		//check if word is too big
-		if(drawrect.X + (strlen(wBuf[i]) * scale) > rBounds.X + rBounds.W)
-		{
-			//newline
-			drawrect.Y -= scale * BL_ICORE_NEWLINE_SCALE;
+		layout->gBuf[i].bounds.X += moveX;
+		layout->gBuf[i].bounds.Y += moveY;
+	}
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLHelperCheckLineVisible
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLHelperLayout* layout -> layout to check
+* RETURNS:
+*	int, 1 if the current line can be seen, 0 if not
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Centered blocks are moved after layout, so never cull.
+*	Lines count as a line taller, a wrapped word can move down
+*	onto the next line
+*************************************************************/
+static inline int BLHelperCheckLineVisible(const BLHelperLayout* layout)
+{
+	if(layout->cull == 0 || layout->lType == BL_ISTRING_LAYOUT_CENTERED)
+	{
+		return 1;
+	}
+
+	return layout->penY - layout->lineStep < layout->cullMaxY && layout->penY + (BLInt)layout->scale > layout->cullMinY;
+}
+
+/*************************************************************
+* NAME: BLHelperEndLine
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLHelperLayout* layout -> layout to change
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Measures the current line, centered lines are moved into
+*	place now that their width is known
+*************************************************************/
+static void BLHelperEndLine(BLHelperLayout* layout)
+{
+	//count culled line
+	if(layout->lineVisible == 0)
+	{
+		layout->culledLines++;
+	}
+
+	//measure line
+	const BLInt lineWidth = layout->lineRight - layout->originX;
+	if(lineWidth > layout->width)
+	{
+		layout->width = lineWidth;
+	}
+
+	//center line
+	if(layout->lType == BL_ISTRING_LAYOUT_CENTERED)
+	{
+		const BLInt centerX = layout->rBounds.X + (layout->rBounds.W / 2);
+		BLHelperMoveGlyphs(layout, layout->lineFirst, centerX - (lineWidth / 2) - layout->originX, 0);
+	}
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLHelperNewLine
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLHelperLayout* layout -> layout to change
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static void BLHelperNewLine(BLHelperLayout* layout)
+{
+	//move pen
+	layout->penX = layout->originX;
+	layout->penY -= layout->lineStep;
+	layout->lineCount++;
+
+	//reset line and word
+	layout->lineRight     = layout->originX;
+	layout->lineFirst     = layout->gCount;
+	layout->wordFirst     = layout->gCount;
+	layout->wordX         = layout->originX;
+	layout->wordLineRight = layout->originX;
+
+	//check if newline is too far
+	if(layout->lType == BL_ISTRING_LAYOUT_RECT && layout->penY < layout->rBounds.Y)
+	{
+		layout->fits = 0;
+	}
+
+	//check if newline can be seen
+	layout->lineVisible = BLHelperCheckLineVisible(layout);
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLHelperWrapWord
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLHelperLayout* layout -> layout to change
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Ends the line before the current word and moves the
+*	word's glyphs down to the start of a new line
+*************************************************************/
+static void BLHelperWrapWord(BLHelperLayout* layout)
+{
+	//line ends before the word
+	const BLInt lineRight = layout->lineRight;
+	layout->lineRight = layout->wordLineRight;
+	BLHelperEndLine(layout);
+
+	//move word down
+	const BLInt  moveX     = layout->originX - layout->wordX;
+	const BLUInt wordFirst = layout->wordFirst;
+	const BLInt  penX      = layout->penX + moveX;
+	BLHelperMoveGlyphs(layout, wordFirst, moveX, -layout->lineStep);
+
+	//start new line with the word on it
+	const BLUInt gCount = layout->gCount;
+	layout->gCount = wordFirst;
+	BLHelperNewLine(layout);
+	layout->penX      = penX;
+	layout->lineRight = (lineRight > layout->wordX + moveX) ? lineRight + moveX : layout->originX;
+	layout->wordX     = layout->originX;
+
+	//keep word if it still fits
+	if(layout->fits)
+	{
+		layout->gCount = gCount;
+	}
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLHelperRunLayout
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLHelperLayout* layout -> layout with params set
+*	const BLByte* str -> string to layout
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Lays out str in a single pass. Words only wrap in RECT
+*	layouts, centered lines and blocks are moved into place
+*	once they are measured
+*************************************************************/
+static void BLHelperRunLayout(BLHelperLayout* layout, const BLByte* str)
+{
+	const BLInt scale = (BLInt)layout->scale;
+
+	//get first line
+	switch (layout->lType)
+	{
+	case BL_ISTRING_LAYOUT_RECT:
+
+		layout->originX = layout->rBounds.X;
+		layout->penY    = layout->rBounds.Y + layout->rBounds.H - scale;
+		break;
+
+	case BL_ISTRING_LAYOUT_CENTERED:
+
+		//block is moved into place at the end
+		layout->originX = 0;
+		layout->penY    = -scale;
+		break;
 
-			//reset X
-			drawrect.X = rBounds.X;
+	default:
+
+		//rBounds X and Y are the top left
+		layout->originX = layout->rBounds.X - scale;
+		layout->penY    = layout->rBounds.Y - scale;
+		break;
+	}
 
-			//check if newline is too far
-			if(drawrect.Y < rBounds.Y)
+	//reset state
+	layout->gCount        = 0;
+	layout->lineCount     = 1;
+	layout->width         = 0;
+	layout->fits          = 1;
+	layout->lineStep      = (BLInt)((float)scale * BL_ICORE_NEWLINE_SCALE);
+	layout->penX          = layout->originX;
+	layout->lineRight     = layout->originX;
+	layout->lineFirst     = 0;
+	layout->wordFirst     = 0;
+	layout->wordX         = layout->originX;
+	layout->wordLineRight = layout->originX;
+	layout->culledLines   = 0;
+	layout->lineVisible   = BLHelperCheckLineVisible(layout);
+
+	//layout loop
+	while(*str != 0)
+	{
+		//culled lines that can't wrap are skipped whole
+		if(layout->lineVisible == 0 && layout->lType == BL_ISTRING_LAYOUT_LINE)
+		{
+			str = (const BLByte*)strchr((const char*)str, '\n');
+			if(str == NULL)
 			{
-				//end
-				return 0;
+				break;
 			}
 		}
-		
-		//create tex handle
-		BLTextureHandle cHndl;
 
-		//render loop
-		for (int j = 0; j < strlen(wBuf[i]); j++)
+		const BLUInt codepoint = BLHelperNextCodepoint(&str);
+
+		//check for newline
+		if(codepoint == '\n')
 		{
+			BLHelperEndLine(layout);
+			BLHelperNewLine(layout);
+			continue;
+		}
+
+		//get glyph size
+		const BLInt advance = BLHelperGlyphAdvance(codepoint, layout->scale);
+		const BLInt extent  = (bitmapFont == NULL) ? scale : advance;
+
+		//wrap word if it leaves the bounds
+		if(layout->lType == BL_ISTRING_LAYOUT_RECT && codepoint != ' ' && layout->wordX > layout->originX &&
+			layout->penX + extent > layout->rBounds.X + layout->rBounds.W)
+		{
+			BLHelperWrapWord(layout);
+		}
 
-			//check for newline
-			if (wBuf[i][j] == '\n')
+		//store glyph
+		if(layout->fits && layout->lineVisible)
+		{
+			if(layout->gBuf != NULL && layout->gCount < layout->gBufSize)
 			{
-				//reset x and increment Y
-				drawrect.X = rBounds.X;
-				drawrect.Y = drawrect.Y - (BLUInt)((float)scale * BL_ICORE_NEWLINE_SCALE);
-
-				//check if newline is too far
-				if (drawrect.Y < rBounds.Y)
-				{
-					//end
-					return 0;
-				}
+				BLIGlyph* glyph = &layout->gBuf[layout->gCount];
+				glyph->bounds    = BLHelperGlyphBounds(codepoint, BLCreateRecti(layout->penX, layout->penY, scale, scale));
+				glyph->codepoint = codepoint;
 			}
-			else
-			{
-				//draw rect
-				cHndl = BLGetFontTextureHandle(wBuf[i][j], sType);
-				BLIRenderBoxTextured(drawrect, cHndl);
+			layout->gCount++;
+		}
 
-				//increment x
-				drawrect.X = drawrect.X + (BLUInt)((float)scale * BL_ICORE_SPACE_SCALE);
-			}
+		//increment x
+		if(layout->penX + extent > layout->lineRight)
+		{
+			layout->lineRight = layout->penX + extent;
+		}
+		layout->penX += advance;
+
+		//words end after spaces
+		if(codepoint == ' ')
+		{
+			layout->wordFirst     = layout->gCount;
+			layout->wordX         = layout->penX;
+			layout->wordLineRight = layout->lineRight;
+		}
+	}
+
+	//end last line
+	BLHelperEndLine(layout);
+
+	//center block
+	if(layout->lType == BL_ISTRING_LAYOUT_CENTERED)
+	{
+		const BLInt height  = ((BLInt)(layout->lineCount - 1) * layout->lineStep) + scale;
+		const BLInt centerY = layout->rBounds.Y + (layout->rBounds.H / 2);
+		BLHelperMoveGlyphs(layout, 0, 0, centerY + (height / 2));
+	}
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLHelperLayoutToArena
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLByte* str -> string to layout
+*	BLRecti rBounds   -> bounds of the string
+*	BLUInt scale -> scale of each letter (in pixels)
+*	enum BL_ISTRING_LAYOUT lType -> how lines are placed
+*	BLRect visible -> lines outside of this are culled
+*	int* fits    -> set to the fits flag of the layout
+*	BLUInt* culledLines -> set to the amount of culled lines
+* RETURNS:
+*	BLUInt, amount of glyphs in layoutArena
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	The arena only grows when a string is longer than any
+*	before it, so this is normally allocation free
+*************************************************************/
+static BLUInt BLHelperLayoutToArena(const BLByte* str, BLRecti rBounds, BLUInt scale, enum BL_ISTRING_LAYOUT lType, BLRect visible, int* fits, BLUInt* culledLines)
+{
+	//layout
+	BLHelperLayout layout = { .rBounds = rBounds, .scale = scale, .lType = lType,
+	                          .gBuf = layoutArena, .gBufSize = layoutArenaSize };
+	layout.cull     = 1;
+	layout.cullMinY = (BLInt)visible.Y;
+	layout.cullMaxY = (BLInt)(visible.Y + visible.height);
+	BLHelperRunLayout(&layout, str);
+
+	//grow arena and layout again if too small
+	if(layout.gCount > layoutArenaSize)
+	{
+		BLUInt newSize = (layoutArenaSize == 0) ? BL_ICORE_GLYPH_ARENA_SIZE : layoutArenaSize;
+		while(newSize < layout.gCount)
+		{
+			newSize *= 2;
+		}
+
+		BLIGlyph* newArena = realloc(layoutArena, newSize * sizeof(BLIGlyph));
+		if(newArena == NULL)
+		{
+			fprintf(stderr, "ICore: glyph arena memory err\n");
+			*fits        = layout.fits;
+			*culledLines = layout.culledLines;
+			return layoutArenaSize;
+		}
+
+		layoutArena     = newArena;
+		layoutArenaSize = newSize;
+		layout.gBuf     = layoutArena;
+		layout.gBufSize = layoutArenaSize;
+		BLHelperRunLayout(&layout, str);
+	}
+
+	//end
+	*fits        = layout.fits;
+	*culledLines = layout.culledLines;
+	return layout.gCount;
+}
+
+/*************************************************************
+* NAME: BLHelperDrawGlyphs
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLIGlyph* glyphs -> glyphs to draw
+*	BLUInt gCount -> amount of glyphs
+*	enum BL_GFONT_TYPE sType -> type of font to draw
+*	BLRect visible -> glyphs outside of this are culled
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Glyphs that share an atlas are drawn in a single call
+*************************************************************/
+static void BLHelperDrawGlyphs(const BLIGlyph* glyphs, BLUInt gCount, enum BL_GFONT_TYPE sType, BLRect visible)
+{
+	//distance fields are cut at the glyph's edge
+	const BLColor sColor    = BLGetFontColor(sType);
+	const int     alphaTest = (bitmapFont == NULL && stringMode == BL_ISTRING_MODE_SDF);
+
+	//batch every visible glyph
+	BLUInt drawn  = 0;
+	BLUInt culled = 0;
+	for(BLUInt i = 0; i < gCount; i++)
+	{
+		//cull before looking up the atlas
+		if(BLHelperCheckOutside(glyphs[i].bounds, visible))
+		{
+			culled++;
+			continue;
+		}
+
+		BLRect uv;
+		BLTextureHandle atlas = BLIGetGlyphAtlas(glyphs[i].codepoint, &uv);
+		if(uv.width != 0)
+		{
+			BLIBatchQuad(atlas, alphaTest, glyphs[i].bounds, uv, sColor);
+			drawn++;
 		}
 	}
+	BLAddCullStats(drawn, culled, 0);
+
+	//one draw per string
+	BLISubmitBatch( );
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLHelperRenderLayout
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLByte* str -> string to render
+*	BLRecti rBounds   -> bounds of the string
+*	BLUInt scale -> scale of each letter (in pixels)
+*	enum BL_ISTRING_LAYOUT lType -> how lines are placed
+*	enum BL_GFONT_TYPE sType -> type of font to draw
+* RETURNS:
+*	int, fits flag of the layout
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Lines and glyphs that can't be seen are culled
+*************************************************************/
+static int BLHelperRenderLayout(const BLByte* str, BLRecti rBounds, BLUInt scale, enum BL_ISTRING_LAYOUT lType, enum BL_GFONT_TYPE sType)
+{
+	//layout then draw
+	const BLRect visible = BLGetVisibleRect( );
+	int    fits;
+	BLUInt culledLines;
+	BLUInt gCount = BLHelperLayoutToArena(str, rBounds, scale, lType, visible, &fits, &culledLines);
+	BLHelperDrawGlyphs(layoutArena, gCount, sType, visible);
+	BLAddCullStats(0, 0, culledLines);
+
+	//end
+	return fits;
+}
+
+/*************************************************************
+* NAME: BLIRenderString
+* DATE: 2021 - 09 - 2
+* PARAMS:
+*	const BLByte* str -> string to render
+*	BLUInt tX -> top left X position
+*	BLUInt tY -> top left Y position
+*	BLUInt scale -> scale of each letter (in pixels)
+*	enum BL_GFONT_TYPE sType -> type of font to render
+* RETURNS:
+*	void
+* NOTE: N/A
+*************************************************************/
+void BLIRenderString(const BLByte* str, BLUInt tX, BLUInt tY, BLUInt scale, enum BL_GFONT_TYPE sType)
+{
+	//layout then draw
+	BLHelperRenderLayout(str, BLCreateRecti(tX, tY, 0, 0), scale, BL_ISTRING_LAYOUT_LINE, sType);
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLIRenderStringCentered
+* DATE: 2021 - 09 - 2
+* PARAMS:
+*	const BLByte* str -> string to render
+*	BLRecti rBounds   -> bounds of string
+*	BLUInt scale -> scale of each letter (in pixels)
+*	enum BL_GFONT_TYPE sType -> type of font to render
+* RETURNS:
+*	void
+* NOTE:
+*	If not newlined properly, string will write outside of bounds
+*	it is expected that the string has been newlined correctly to
+*	fit the bounds
+*************************************************************/
+void BLIRenderStringCentered(const BLByte* str, BLRecti rBounds, BLUInt scale, enum BL_GFONT_TYPE sType)
+{
+	//layout then draw
+	BLHelperRenderLayout(str, rBounds, scale, BL_ISTRING_LAYOUT_CENTERED, sType);
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLIRenderStringRect
+* DATE: 2021 - 09 - 2
+* PARAMS:
+*	const BLByte* str -> string to render
+*	BLRecti rBounds -> bounds of the string to render
+*	BLUInt scale -> scale of each letter (in pixels)
+*	enum BL_GFONT_TYPE sType -> type of font to render
+* RETURNS:
+*	int, 1 for success, 0 for string out of rect bounds
+* NOTE: N/A
+*************************************************************/
+int BLIRenderStringRect(const BLByte* str, BLRecti rBounds, BLUInt scale, enum BL_GFONT_TYPE sType)
+{
+	//layout then draw the lines that fit
+	return BLHelperRenderLayout(str, rBounds, scale, BL_ISTRING_LAYOUT_RECT, sType);
+}
+
+/*************************************************************
+* NAME: BLISetStringMode
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	enum BL_ISTRING_MODE sMode -> mode to draw strings with
+* RETURNS:
+*	void
+* NOTE:
+*	Affects every BLIRenderString* function, the default is
+*	BL_ISTRING_MODE_BITMAP. Layouts are the same in both modes
+*************************************************************/
+void BLISetStringMode(enum BL_ISTRING_MODE sMode)
+{
+	stringMode = sMode;
+	return;
+}
+
+/*************************************************************
+* NAME: BLIGetStringMode
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	enum BL_ISTRING_MODE that strings are drawn with
+* NOTE: N/A
+*************************************************************/
+enum BL_ISTRING_MODE BLIGetStringMode( )
+{
+	return stringMode;
+}
+
+/*************************************************************
+* NAME: BLISetBitmapFont
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLBitmapFont* font -> font to draw strings with (NULL
+*	for the built in font)
+* RETURNS:
+*	void
+* NOTE:
+*	Affects every BLIRenderString* function. With a bitmap font
+*	set, scale is the height of the font's bounding box and each
+*	glyph uses the font's own size and advance. Strings are read
+*	as UTF-8. Bitmap fonts ignore BL_ISTRING_MODE_SDF. The font
+*	must outlive its use
+*************************************************************/
+void BLISetBitmapFont(const BLBitmapFont* font)
+{
+	bitmapFont = font;
+	return;
+}
+
+/*************************************************************
+* NAME: BLIGetBitmapFont
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	const BLBitmapFont* that strings are drawn with (NULL for
+*	the built in font)
+* NOTE: N/A
+*************************************************************/
+const BLBitmapFont* BLIGetBitmapFont( )
+{
+	return bitmapFont;
+}
+
+/*************************************************************
+* NAME: BLISetGlyphCache
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLGlyphCache* gCache -> glyph cache to draw glyphs through
+*	(NULL to use the font's own atlas)
+* RETURNS:
+*	void
+* NOTE:
+*	Only used while the bitmap font is the glyph cache's font.
+*	Fonts too large for their own atlas need a glyph cache.
+*	The atlas should hold more glyphs than a single string uses.
+*	Sets the glyph cache's evict hook to flush the batch
+*************************************************************/
+void BLISetGlyphCache(BLGlyphCache* gCache)
+{
+	//stop flushing for the old cache
+	if(glyphCache != NULL && glyphCache != gCache)
+	{
+		BLSetGlyphCacheEvictHook(glyphCache, NULL);
+	}
+
+	//queued glyph quads must be drawn before their slot is reused
+	glyphCache = gCache;
+	if(glyphCache != NULL)
+	{
+		BLSetGlyphCacheEvictHook(glyphCache, BLIFlushBatch);
+	}
+	return;
+}
+
+/*************************************************************
+* NAME: BLIGetGlyphCache
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLGlyphCache* that glyphs are drawn through (NULL for none)
+* NOTE: N/A
+*************************************************************/
+BLGlyphCache* BLIGetGlyphCache( )
+{
+	return glyphCache;
+}
+
+/*************************************************************
+* NAME: BLIGetGlyphAtlas
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt codepoint -> codepoint of glyph
+*	BLRect* uv       -> set to the glyph's texture coords
+* RETURNS:
+*	BLTextureHandle of the atlas that the current font and
+*	string mode draw codepoint from
+* NOTE:
+*	uv has a width of 0 for glyphs with nothing to draw
+*************************************************************/
+BLTextureHandle BLIGetGlyphAtlas(BLUInt codepoint, BLRect* uv)
+{
+	//bitmap font through glyph cache
+	if(bitmapFont != NULL && glyphCache != NULL && BLGetGlyphCacheFont(glyphCache) == bitmapFont)
+	{
+		return BLGetCachedGlyph(glyphCache, codepoint, uv);
+	}
+
+	//bitmap font
+	if(bitmapFont != NULL)
+	{
+		*uv = BLGetBitmapGlyph(bitmapFont, codepoint)->uv;
+		return bitmapFont->atlas;
+	}
+
+	//built in font
+	const BLByte character = (BLByte)codepoint;
+	if(BLGetGlyphMask(character) == 0)
+	{
+		*uv = BLCreateRect(0, 0, 0, 0);
+	}
+	else
+	{
+		*uv = (stringMode == BL_ISTRING_MODE_SDF) ? BLGetFontSDFRect(character) : BLGetFontAtlasRect(character);
+	}
+
+	//end
+	return (stringMode == BL_ISTRING_MODE_SDF) ? BLGetFontSDFHandle( ) : BLGetFontAtlasHandle( );
+}
+
+/*************************************************************
+* NAME: BLILayoutString
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLByte* str -> string to layout
+*	BLRecti rBounds   -> bounds of the string (only X and Y are
+*	used for BL_ISTRING_LAYOUT_LINE, as the top left)
+*	BLUInt scale -> scale of each letter (in pixels)
+*	enum BL_ISTRING_LAYOUT lType -> which render function to match
+*	BLIGlyph* gBuf   -> buffer to write glyphs to (can be NULL)
+*	BLUInt gBufSize  -> size of gBuf
+*	int* fits        -> set to 0 if the string left rBounds, 1
+*	otherwise (can be NULL)
+* RETURNS:
+*	BLUInt, total amount of glyphs in the layout
+* NOTE:
+*	Produces the exact glyphs that the matching BLIRenderString*
+*	function would draw, in a single pass with no allocations.
+*	If the return value is larger than gBufSize, only the first
+*	gBufSize glyphs were written
+*************************************************************/
+BLUInt BLILayoutString(const BLByte* str, BLRecti rBounds, BLUInt scale, enum BL_ISTRING_LAYOUT lType, BLIGlyph* gBuf, BLUInt gBufSize, int* fits)
+{
+	//layout into the caller's buffer
+	BLHelperLayout layout = { .rBounds = rBounds, .scale = scale, .lType = lType,
+	                          .gBuf = gBuf, .gBufSize = gBufSize };
+	BLHelperRunLayout(&layout, str);
+
+	//write fits
+	if(fits != NULL)
+	{
+		*fits = layout.fits;
+	}
+
+	//end
+	return layout.gCount;
+}
+
+/*************************************************************
+* NAME: BLHelperMeasureLayout
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLByte* str -> string to measure
+*	BLRecti rBounds   -> bounds of the string
+*	BLUInt scale -> scale of each letter (in pixels)
+*	enum BL_ISTRING_LAYOUT lType -> how lines are placed
+* RETURNS:
+*	BLITextMetrics of the layout
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Runs the layout without storing any glyphs
+*************************************************************/
+static BLITextMetrics BLHelperMeasureLayout(const BLByte* str, BLRecti rBounds, BLUInt scale, enum BL_ISTRING_LAYOUT lType)
+{
+	//layout without a buffer
+	BLHelperLayout layout = { .rBounds = rBounds, .scale = scale, .lType = lType,
+	                          .gBuf = NULL, .gBufSize = 0 };
+	BLHelperRunLayout(&layout, str);
+
+	//get metrics
+	BLITextMetrics metrics;
+	metrics.width     = layout.width;
+	metrics.height    = ((BLInt)(layout.lineCount - 1) * layout.lineStep) + (BLInt)scale;
+	metrics.lineCount = layout.lineCount;
+	metrics.fits      = layout.fits;
+	metrics.advance   = layout.penX - layout.originX;
+
+	//end
+	return metrics;
+}
 
-	return 1;
+/*************************************************************
+* NAME: BLIMeasureString
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLByte* str -> string to measure
+*	BLUInt scale -> scale of each letter (in pixels)
+* RETURNS:
+*	BLITextMetrics of the string as BLIRenderString or
+*	BLIRenderStringCentered would draw it
+* NOTE:
+*	Uses the same layout as rendering. O(n) and allocation
+*	free, fits is always 1
+*************************************************************/
+BLITextMetrics BLIMeasureString(const BLByte* str, BLUInt scale)
+{
+	return BLHelperMeasureLayout(str, BLCreateRecti(0, 0, 0, 0), scale, BL_ISTRING_LAYOUT_LINE);
+}
+
+/*************************************************************
+* NAME: BLIMeasureStringRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLByte* str -> string to measure
+*	BLRecti rBounds -> bounds the string wraps in
+*	BLUInt scale -> scale of each letter (in pixels)
+* RETURNS:
+*	BLITextMetrics of the string as BLIRenderStringRect would
+*	draw it
+* NOTE:
+*	Uses the same layout as rendering. O(n) and allocation
+*	free. Lines that don't fit are still measured, so height
+*	can be larger than rBounds when fits is 0
+*************************************************************/
+BLITextMetrics BLIMeasureStringRect(const BLByte* str, BLRecti rBounds, BLUInt scale)
+{
+	return BLHelperMeasureLayout(str, rBounds, scale, BL_ISTRING_LAYOUT_RECT);
 }
 
 /*************************************************************
@@ -686,6 +1555,80 @@ int BLIRenderStringRectBorder(const BLByte* str, BLRecti rBounds, BLUInt scale,
 	return rVal;
 }
 
+/*************************************************************
+* NAME: BLHelperGetInput
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	const BLInputFrame* input snapshot of the window being
+*	rendered to
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline const BLInputFrame* BLHelperGetInput( )
+{
+	return BLWindowGetInput(BLRenderGetWindowContext( ));
+}
+
+/*************************************************************
+* NAME: BLHelperKeyToChar
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLInt key -> GLFW key
+*	int shifted -> 1 if shift is held
+* RETURNS:
+*	char typed by key, NULL if none
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	GLFW codes for printable keys are their unshifted ASCII
+*	(letters uppercase)
+*************************************************************/
+static BLByte BLHelperKeyToChar(BLInt key, int shifted)
+{
+	static const char numShifted[]  = ")!@#$%^&*(";
+	static const char specChars[]   = "',-./;=[\\]`";
+	static const char specShifted[] = "\"<_>?:+{|}~";
+
+	//letters
+	if(key >= 'A' && key <= 'Z')
+	{
+		return (BLByte)key;
+	}
+
+	//numbers
+	if(key >= '0' && key <= '9')
+	{
+		return shifted ? (BLByte)numShifted[key - '0'] : (BLByte)key;
+	}
+
+	//special characters
+	const char* spec = (key > 0 && key < 0x80) ? strchr(specChars, key) : NULL;
+	if(spec != NULL)
+	{
+		return shifted ? (BLByte)specShifted[spec - specChars] : (BLByte)key;
+	}
+
+	//other characters
+	switch (key)
+	{
+	case GLFW_KEY_ENTER:
+		return '\n';
+
+	case GLFW_KEY_SPACE:
+		return ' ';
+
+	case GLFW_KEY_BACKSPACE:
+		return (BLByte)8;
+
+	default:
+		break;
+	}
+
+	//no char
+	return NULL;
+}
+
 /*************************************************************
 * NAME: BLICheckMouseOverlap
 * DATE: 2021 - 09 - 3
@@ -694,12 +1637,13 @@ int BLIRenderStringRectBorder(const BLByte* str, BLRecti rBounds, BLUInt scale,
 *	BLRecti rBounds      -> bounds to check
 * RETURNS:
 *	int, 1 for in bounds, 0 for out of bounds
-* NOTE: N/A
+* NOTE:
+*	Uses the cursor position from the window's input snapshot
 *************************************************************/
 int BLICheckMouseOverlap(BLWindowHandle wHndl, BLRecti rBounds)
 {
 	//get mouse position
-	BLVert2f mousePos = BLWindowGetMousePosition(wHndl);
+	BLVert2f mousePos = BLWindowGetInput(wHndl)->mousePos;
 
 	//inverse Y
 	int viewPortDimensions[4]; //index 3 is height
@@ -742,12 +1686,7 @@ int BLICheckMouseOverlap(BLWindowHandle wHndl, BLRecti rBounds)
 *************************************************************/
 int BLICheckMouseLeftDown( )
 {
-	if(GetKeyState(VK_LBUTTON) < 0)
-	{
-		return 1;
-	}
-
-	return 0;
+	return BLHelperGetInput( )->buttonDown[GLFW_MOUSE_BUTTON_LEFT] != 0;
 }
 
 /*************************************************************
@@ -762,12 +1701,7 @@ int BLICheckMouseLeftDown( )
 *************************************************************/
 int BLICheckMouseRightDown( )
 {
-	if (GetKeyState(VK_RBUTTON) < 0)
-	{
-		return 1;
-	}
-
-	return 0;
+	return BLHelperGetInput( )->buttonDown[GLFW_MOUSE_BUTTON_RIGHT] != 0;
 }
 
 /*************************************************************
@@ -785,38 +1719,18 @@ int BLICheckMouseRightDown( )
 *************************************************************/
 BLByte BLICheckKeyDownAlphaNumeric( )
 {
-	//check all letters
-	//65 - 90 map to A-Z in VK_BUTTONS
-	for(int i = 65; i < 91; i++)
-	{
-		if(GetKeyState(i) < 0)
-		{
-			return (BLByte)i;
-		}
-	}
+	const BLInputFrame* input = BLHelperGetInput( );
 
-	//check all numbers
-	//48 - 57 map to 0 - 9 in VK_BUTTONS
-	for(int i = 48; i < 57; i++)
+	//check held keys, latest first
+	for(BLUInt i = input->keysDownCount; i > 0; i--)
 	{
-		if(GetKeyState(i) < 0)
+		const BLByte key = BLHelperKeyToChar(input->keysDown[i - 1], 0);
+		if((key >= 'A' && key <= 'Z') || (key >= '0' && key <= '9') || key == '\n' || key == ' ')
 		{
-			return (BLByte)i;
+			return key;
 		}
 	}
 
-	//check enter key
-	if(GetKeyState(VK_RETURN) < 0)
-	{
-		return (BLByte)'\n';
-	}
-
-	//check space key
-	if(GetKeyState(VK_SPACE) < 0)
-	{
-		return (BLByte)' ';
-	}
-
 	//no key, end
 	return NULL;
 }
@@ -862,190 +1776,26 @@ BLByte BLICheckKeyPushedAlphaNumeric( )
 *	char, mapping to which key is pushed down (UPPERCASE)
 * NOTE:
 *	This function covers ALL CHARS, however, it is not recommended
-*	for typing related purposes, rather, input purposes
+*	for typing related purposes, rather, input purposes. With
+*	several keys held, the latest pressed wins
 *************************************************************/
 BLByte BLIGetCharDown()
 {
-	//check all letters
-	//65 - 90 map to A-Z in VK_BUTTONS
-	for (int i = 65; i < 91; i++)
-	{
-		if (GetKeyState(i) < 0)
-		{
-			return (BLByte)i;
-		}
-	}
-
-	//check all numbers
-	//48 - 57 map to 0 - 9 in VK_BUTTONS
-	BLByte cNum = NULL;
-	for (int i = 48; i < 58; i++)
-	{
-		if (GetKeyState(i) < 0)
-		{
-			cNum = (BLByte)i;
-		}
-	}
+	const BLInputFrame* input = BLHelperGetInput( );
 
 	//check if shifted
-	int isShifted = GetKeyState(VK_SHIFT) < 0;
-
-	//check all number special characters
-	if(isShifted && cNum != NULL)
-	{
-		switch (cNum)
-		{
-		case '1':
-			return '!';
-
-		case '2':
-			return '@';
-
-		case '3':
-			return '#';
-
-		case '4':
-			return '$';
-
-		case '5':
-			return '%';
-
-		case '6':
-			return '^';
-
-		case '7':
-			return '&';
-
-		case '8':
-			return '*';
-
-		case '9':
-			return '(';
-
-		case '0':
-			return ')';
-
-		default:
-			break;
-		}
-	}
+	const int isShifted = input->keyDown[GLFW_KEY_LEFT_SHIFT] || input->keyDown[GLFW_KEY_RIGHT_SHIFT];
 
-	//if number
-	if(cNum != NULL)
+	//check held keys, latest first
+	for(BLUInt i = input->keysDownCount; i > 0; i--)
 	{
-		return cNum;
-	}
-
-	//other special characters
-	BLByte specChar = NULL;
-	if(GetKeyState(VK_OEM_PLUS) < 0)
-	{
-		specChar = '=';
-	}
-	if(GetKeyState(VK_OEM_MINUS) < 0)
-	{
-		specChar = '-';
-	}
-	if (GetKeyState(VK_OEM_COMMA) < 0)
-	{
-		specChar = ',';
-	}
-	if (GetKeyState(VK_OEM_PERIOD) < 0)
-	{
-		specChar = '.';
-	}
-	if (GetKeyState(VK_OEM_2) < 0)
-	{
-		specChar = '/';
-	}
-	if (GetKeyState(VK_OEM_3) < 0)
-	{
-		specChar = '`';
-	}
-	if (GetKeyState(VK_OEM_4) < 0)
-	{
-		specChar = '[';
-	}
-	if (GetKeyState(VK_OEM_5) < 0)
-	{
-		specChar = '\\';
-	}
-	if (GetKeyState(VK_OEM_6) < 0)
-	{
-		specChar = ']';
-	}
-	if (GetKeyState(VK_OEM_7) < 0)
-	{
-		specChar = '\'';
-	}
-	if (GetKeyState(VK_OEM_1) < 0)
-	{
-		specChar = ';';
-	}
-
-	//if shifted
-	if(isShifted && specChar != NULL)
-	{
-		switch (specChar)
+		const BLByte key = BLHelperKeyToChar(input->keysDown[i - 1], isShifted);
+		if(key != NULL)
 		{
-		case '=':
-			return '+';
-
-		case '-':
-			return '_';
-
-		case ',':
-			return '<';
-
-		case '.':
-			return '>';
-
-		case '/':
-			return '?';
-
-		case '`':
-			return '~';
-
-		case '[':
-			return '{';
-
-		case '\\':
-			return '|';
-
-		case ']':
-			return '}';
-
-		case '\'':
-			return '"';
-
-		case ';':
-			return ':';
-
-		default:
-			break;
+			return key;
 		}
 	}
 
-	//special character
-	if(specChar != NULL)
-	{
-		return specChar;
-	}
-
-	//other characters
-	if(GetKeyState(VK_RETURN) < 0)
-	{
-		return '\n';
-	}
-	if(GetKeyState(VK_SPACE) < 0)
-	{
-		return ' ';
-	}
-	if(GetKeyState(VK_BACK) < 0)
-	{
-		return (BLByte)8;
-	}
-
 	//no key down
 	return NULL;
 }
@@ -1060,52 +1810,42 @@ BLByte BLIGetCharDown()
 *	a continuous stream of chars if key is held down
 * NOTE:
 *	This function covers ALL CHARS and is intended for
-*	typing related purposes
+*	typing related purposes. Reads the key presses and repeats
+*	of the window being rendered to, one per call, NULL once
+*	this update's are used up
 *************************************************************/
-static BLByte gc_lastDown    = NULL;
-static BLInt  gc_matchCount = NULL;
+static BLUInt gc_readUpdate[BL_WINDOW_COUNT_MAX] = { 0 };
+static BLUInt gc_readEvent[BL_WINDOW_COUNT_MAX]  = { 0 };
 BLByte BLIGetChar( )
 {
-	//get latest key down
-	BLByte currentlyDown = BLIGetCharDown( );
-
-	//check if NULL
-	if(currentlyDown == NULL)
+	//get input
+	const BLWindowHandle wHndl = BLRenderGetWindowContext( );
+	if(wHndl < 0 || wHndl >= BL_WINDOW_COUNT_MAX)
 	{
-		//reset all, return NULL
-		gc_lastDown   = NULL;
-		gc_matchCount = NULL;
 		return NULL;
 	}
+	const BLInputFrame* input = BLWindowGetInput(wHndl);
 
-	//check if matching to last down
-	if(currentlyDown == gc_lastDown)
+	//new update, read from the start
+	if(gc_readUpdate[wHndl] != input->updateCount)
 	{
-		gc_matchCount++;
+		gc_readUpdate[wHndl] = input->updateCount;
+		gc_readEvent[wHndl]  = 0;
+	}
 
-		//check if key is being held down
-		if(gc_matchCount > BL_ICORE_CHAR_MATCH_COUNT)
-		{
-			return currentlyDown;
-		}
-		else
+	//find next key that types
+	while(gc_readEvent[wHndl] < input->eventCount)
+	{
+		const BLInputEvent* event = &input->events[gc_readEvent[wHndl]++];
+		if(event->type == BL_INPUT_EVENT_KEY && event->action != BL_INPUT_ACTION_RELEASE)
 		{
-			//else, return NULL
-			return NULL;
+			const BLByte typed = BLHelperKeyToChar(event->code, (event->mods & GLFW_MOD_SHIFT) != 0);
+			if(typed != NULL)
+			{
+				return typed;
+			}
 		}
 	}
-	else
-	{
-		//if new key down, return the new down
-		//update lastDown
-		gc_lastDown = currentlyDown;
-
-		//reset count
-		gc_matchCount = NULL;
-
-		//end
-		return currentlyDown;
-	}
 
 	//end
 	return NULL;
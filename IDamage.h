@@ -0,0 +1,211 @@
+#ifndef __IDAMAGE_INCLUDE__
+#define __IDAMAGE_INCLUDE__
+
+
+/*************************************************************
+* FILE: IDamage.h
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Damage tracking, so only the changed parts of the screen
+*	are redrawn
+* CONTENTS:
+*	- Includes
+*	- Defs
+*	- Structs
+*	- Functions
+*
+*************************************************************/
+
+#include "ICore.h"
+
+#define BL_IDAMAGE_RECT_MAX   0x40 // rects held per frame before the whole screen is redrawn
+#define BL_IDAMAGE_REGION_MAX 0x8  // max regions redrawn per frame
+#define BL_IDAMAGE_AGE_MAX    0x4  // max buffer age
+#define BL_IDAMAGE_AGE        2    // default buffer age (swaps exchange buffers)
+
+/*************************************************************
+* NAME: BLIDamageStats
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLUInt frames     -> frames started with BLIBeginDamage
+*	BLUInt idleFrames -> frames with nothing to redraw
+*	BLUInt regions    -> regions redrawn
+*	unsigned long long pixels     -> pixels redrawn
+*	unsigned long long fullPixels -> pixels a full redraw
+*	would have cost
+* NOTE:
+*	The pixel counts are 64 bit, a 4k screen passes 32 bits
+*	of fullPixels in about 500 frames
+*************************************************************/
+typedef struct BLIDamageStats
+{
+	BLUInt             frames;
+	BLUInt             idleFrames;
+	BLUInt             regions;
+	unsigned long long pixels;
+	unsigned long long fullPixels;
+}BLIDamageStats;
+
+/*************************************************************
+* NAME: BLInitIDamage
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	The first frame redraws the whole screen
+*************************************************************/
+int BLInitIDamage( );
+
+/*************************************************************
+* NAME: BLTerminateIDamage
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE: N/A
+*************************************************************/
+void BLTerminateIDamage( );
+
+/*************************************************************
+* NAME: BLISetDamageBufferAge
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt age -> frames since the back buffer was last drawn
+*	when it is shown again. 1 if swaps copy, 2 if they
+*	exchange, 0 if the back buffer can't be kept
+* RETURNS:
+*	void
+* NOTE:
+*	Damage from the last age frames is redrawn. With 0, every
+*	frame with damage is a full redraw. Defaults to
+*	BL_IDAMAGE_AGE
+*************************************************************/
+void BLISetDamageBufferAge(BLUInt age);
+
+/*************************************************************
+* NAME: BLIAddDamage
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLRecti rect -> screenspace rect that changed
+* RETURNS:
+*	void
+* NOTE:
+*	Report both the old and new rect of a widget that moved.
+*	Does nothing if IDamage isn't init
+*************************************************************/
+void BLIAddDamage(BLRecti rect);
+
+/*************************************************************
+* NAME: BLIDamageAll
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Redraws the whole screen next frame. Done on its own when
+*	the viewport changes size
+*************************************************************/
+void BLIDamageAll( );
+
+/*************************************************************
+* NAME: BLIBeginDamage
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLUInt amount of regions to redraw, 0 if nothing changed
+*	(skip drawing and swapping)
+* NOTE:
+*	Merges every rect reported since the last frame. Use like:
+*		BLUInt count = BLIBeginDamage( );
+*		for(BLUInt i = 0; i < count; i++)
+*		{
+*			BLIBeginDamageRegion(i, R, G, B, A);
+*			draw everything (outside is culled);
+*			BLIEndDamageRegion( );
+*		}
+*		BLIEndDamage( );
+*************************************************************/
+BLUInt BLIBeginDamage( );
+
+/*************************************************************
+* NAME: BLIGetDamageRegion
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt index -> region to get
+* RETURNS:
+*	BLRecti of the region, empty if index is out of range
+* NOTE: N/A
+*************************************************************/
+BLRecti BLIGetDamageRegion(BLUInt index);
+
+/*************************************************************
+* NAME: BLIBeginDamageRegion
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt index -> region to redraw
+*	BLByte R -> clear color R
+*	BLByte G -> clear color G
+*	BLByte B -> clear color B
+*	BLByte A -> clear color A
+* RETURNS:
+*	void
+* NOTE:
+*	Clips to the region and clears it. Replaces
+*	BLClearBuffers
+*************************************************************/
+void BLIBeginDamageRegion(BLUInt index, BLByte R, BLByte G, BLByte B, BLByte A);
+
+/*************************************************************
+* NAME: BLIEndDamageRegion
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Draws batched quads and removes the clip
+*************************************************************/
+void BLIEndDamageRegion( );
+
+/*************************************************************
+* NAME: BLIEndDamage
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Starts collecting damage for the next frame
+*************************************************************/
+void BLIEndDamage( );
+
+/*************************************************************
+* NAME: BLIGetDamageStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLIDamageStats of the tracker
+* NOTE: N/A
+*************************************************************/
+BLIDamageStats BLIGetDamageStats( );
+
+/*************************************************************
+* NAME: BLIResetDamageStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE: N/A
+*************************************************************/
+void BLIResetDamageStats( );
+
+
+#endif
@@ -0,0 +1,517 @@
+/*************************************************************
+* FILE: IDamageSource.c
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Source file for damage tracking
+* CONTENTS:
+*	- Includes
+*	- Backend struct defs
+*	- Backend objects
+*	- File-Specifc functions
+*	- Functions
+*
+*************************************************************/
+
+#include <stdio.h>   // I/O
+#include <stdlib.h>  // For memory management
+#include <string.h>  // For rect copies
+#include <Windows.h> // OpenGL dependancy
+#include <gl/GL.h>   // For the viewport
+
+#include "IDamage.h" // Header
+
+/*************************************************************
+* NAME: BLDamage
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLRecti rects[]  -> rects reported since the last frame
+*	BLUInt rectCount -> amount of rects
+*	int full         -> 1 to redraw the whole screen
+*	BLRecti history[][] -> merged damage of past frames, newest
+*	first
+*	BLUInt historyCounts[] -> amount of rects in each history
+*	entry
+*	BLUInt bufferAge -> frames of damage to redraw
+*	BLInt viewW      -> viewport width last frame
+*	BLInt viewH      -> viewport height last frame
+*	BLRecti regions[] -> regions to redraw this frame
+*	BLUInt regionCount -> amount of regions
+*	BLIDamageStats stats -> counters
+* NOTE: File specific struct, there should only be one
+* instance of this struct at ALL times
+*************************************************************/
+typedef struct BLDamage
+{
+	BLRecti        rects[BL_IDAMAGE_RECT_MAX];
+	BLUInt         rectCount;
+	int            full;
+	BLRecti        history[BL_IDAMAGE_AGE_MAX][BL_IDAMAGE_REGION_MAX];
+	BLUInt         historyCounts[BL_IDAMAGE_AGE_MAX];
+	BLUInt         bufferAge;
+	BLInt          viewW;
+	BLInt          viewH;
+	BLRecti        regions[BL_IDAMAGE_REGION_MAX * BL_IDAMAGE_AGE_MAX];
+	BLUInt         regionCount;
+	BLIDamageStats stats;
+}BLDamage;
+
+/*************************************************************
+* NAME: damage (object)
+* DATE: 2026 - 10 - 19
+* USE:
+*	This is an instance of the BLDamage struct used to hold
+*	every damaged rect
+* NOTE: N/A
+*************************************************************/
+static BLDamage* damage = NULL;
+
+/*************************************************************
+* NAME: BLHelperUnionRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLRecti a -> first rect
+*	BLRecti b -> second rect
+* RETURNS:
+*	BLRecti bounding both rects
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline BLRecti BLHelperUnionRect(BLRecti a, BLRecti b)
+{
+	const BLInt minX = (a.X < b.X) ? a.X : b.X;
+	const BLInt minY = (a.Y < b.Y) ? a.Y : b.Y;
+	const BLInt maxX = (a.X + a.W > b.X + b.W) ? a.X + a.W : b.X + b.W;
+	const BLInt maxY = (a.Y + a.H > b.Y + b.H) ? a.Y + a.H : b.Y + b.H;
+	return BLCreateRecti(minX, minY, maxX - minX, maxY - minY);
+}
+
+/*************************************************************
+* NAME: BLHelperMergeRects
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLRecti* rects -> rects to merge (edited in place)
+*	BLUInt count   -> amount of rects
+*	BLUInt maxCount -> max rects to leave
+* RETURNS:
+*	BLUInt amount of rects left
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Overlapping or touching rects are joined first, then the
+*	pair that adds the least area is joined until maxCount
+*	are left
+*************************************************************/
+static BLUInt BLHelperMergeRects(BLRecti* rects, BLUInt count, BLUInt maxCount)
+{
+	//join overlapping or touching rects
+	for(BLUInt i = 0; i < count; i++)
+	{
+		for(BLUInt j = i + 1; j < count; j++)
+		{
+			const BLRecti a = rects[i];
+			const BLRecti b = rects[j];
+			if(a.X <= b.X + b.W && b.X <= a.X + a.W && a.Y <= b.Y + b.H && b.Y <= a.Y + a.H)
+			{
+				rects[i] = BLHelperUnionRect(a, b);
+				rects[j] = rects[--count];
+
+				//the grown rect may touch earlier ones, start over
+				j = i;
+			}
+		}
+	}
+
+	//join the cheapest pair until few enough
+	while(count > maxCount)
+	{
+		BLUInt   bestI = 0;
+		BLUInt   bestJ = 1;
+		long long bestCost = -1;
+		for(BLUInt i = 0; i < count; i++)
+		{
+			for(BLUInt j = i + 1; j < count; j++)
+			{
+				const BLRecti   joined = BLHelperUnionRect(rects[i], rects[j]);
+				const long long cost   = (long long)joined.W * joined.H -
+					(long long)rects[i].W * rects[i].H - (long long)rects[j].W * rects[j].H;
+				if(bestCost < 0 || cost < bestCost)
+				{
+					bestCost = cost;
+					bestI    = i;
+					bestJ    = j;
+				}
+			}
+		}
+		rects[bestI] = BLHelperUnionRect(rects[bestI], rects[bestJ]);
+		rects[bestJ] = rects[--count];
+	}
+
+	//end
+	return count;
+}
+
+/*************************************************************
+* NAME: BLInitIDamage
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	The first frame redraws the whole screen
+*************************************************************/
+int BLInitIDamage( )
+{
+	//see if already init
+	if(damage != NULL)
+	{
+		fprintf(stderr, "IDamage already init!\n");
+		return 0;
+	}
+
+	//init damage
+	damage = calloc(1, sizeof(BLDamage));
+
+	//check if null
+	if(damage == NULL)
+	{
+		fprintf(stderr, "Cannot Init IDamage: memory err\n");
+		return 0;
+	}
+
+	damage->full      = 1;
+	damage->bufferAge = BL_IDAMAGE_AGE;
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLTerminateIDamage
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE: N/A
+*************************************************************/
+void BLTerminateIDamage( )
+{
+	//check if init
+	if(damage == NULL)
+	{
+		return;
+	}
+
+	free(damage);
+	damage = NULL;
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLISetDamageBufferAge
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt age -> frames since the back buffer was last drawn
+*	when it is shown again. 1 if swaps copy, 2 if they
+*	exchange, 0 if the back buffer can't be kept
+* RETURNS:
+*	void
+* NOTE:
+*	Damage from the last age frames is redrawn. With 0, every
+*	frame with damage is a full redraw. Defaults to
+*	BL_IDAMAGE_AGE
+*************************************************************/
+void BLISetDamageBufferAge(BLUInt age)
+{
+	if(damage == NULL)
+	{
+		return;
+	}
+
+	damage->bufferAge = (age > BL_IDAMAGE_AGE_MAX) ? BL_IDAMAGE_AGE_MAX : age;
+	damage->full      = 1;
+}
+
+/*************************************************************
+* NAME: BLIAddDamage
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLRecti rect -> screenspace rect that changed
+* RETURNS:
+*	void
+* NOTE:
+*	Report both the old and new rect of a widget that moved.
+*	Does nothing if IDamage isn't init
+*************************************************************/
+void BLIAddDamage(BLRecti rect)
+{
+	if(damage == NULL || damage->full || rect.W <= 0 || rect.H <= 0)
+	{
+		return;
+	}
+
+	//too many, redraw everything
+	if(damage->rectCount >= BL_IDAMAGE_RECT_MAX)
+	{
+		damage->full = 1;
+		return;
+	}
+
+	damage->rects[damage->rectCount++] = rect;
+}
+
+/*************************************************************
+* NAME: BLIDamageAll
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Redraws the whole screen next frame. Done on its own when
+*	the viewport changes size
+*************************************************************/
+void BLIDamageAll( )
+{
+	if(damage != NULL)
+	{
+		damage->full = 1;
+	}
+}
+
+/*************************************************************
+* NAME: BLIBeginDamage
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLUInt amount of regions to redraw, 0 if nothing changed
+*	(skip drawing and swapping)
+* NOTE:
+*	Merges every rect reported since the last frame. Use like:
+*		BLUInt count = BLIBeginDamage( );
+*		for(BLUInt i = 0; i < count; i++)
+*		{
+*			BLIBeginDamageRegion(i, R, G, B, A);
+*			draw everything (outside is culled);
+*			BLIEndDamageRegion( );
+*		}
+*		BLIEndDamage( );
+*************************************************************/
+BLUInt BLIBeginDamage( )
+{
+	//check if init
+	if(damage == NULL)
+	{
+		return 0;
+	}
+
+	//var to get viewport dimensions
+	//0 -> X, 1 -> Y, 2 -> width, 3 -> height
+	int viewPortDimensions[4];
+	glGetIntegerv(GL_VIEWPORT, viewPortDimensions);
+	const BLRecti view = BLCreateRecti(0, 0, viewPortDimensions[2], viewPortDimensions[3]);
+
+	//the back buffer is no good after a resize
+	if(view.W != damage->viewW || view.H != damage->viewH)
+	{
+		damage->full  = 1;
+		damage->viewW = view.W;
+		damage->viewH = view.H;
+	}
+	if(damage->bufferAge == 0 && damage->rectCount > 0)
+	{
+		damage->full = 1;
+	}
+
+	//cut this frame's rects to the viewport
+	BLRecti frame[BL_IDAMAGE_RECT_MAX];
+	BLUInt  frameCount = 0;
+	if(damage->full)
+	{
+		frame[frameCount++] = view;
+	}
+	else
+	{
+		for(BLUInt i = 0; i < damage->rectCount; i++)
+		{
+			const BLRecti rect = damage->rects[i];
+			const BLInt   minX = (rect.X > 0) ? rect.X : 0;
+			const BLInt   minY = (rect.Y > 0) ? rect.Y : 0;
+			const BLInt   maxX = (rect.X + rect.W < view.W) ? rect.X + rect.W : view.W;
+			const BLInt   maxY = (rect.Y + rect.H < view.H) ? rect.Y + rect.H : view.H;
+			if(maxX > minX && maxY > minY)
+			{
+				frame[frameCount++] = BLCreateRecti(minX, minY, maxX - minX, maxY - minY);
+			}
+		}
+		frameCount = BLHelperMergeRects(frame, frameCount, BL_IDAMAGE_REGION_MAX);
+	}
+	damage->rectCount = 0;
+	damage->full      = 0;
+
+	//add damage the back buffer missed in earlier frames
+	BLUInt count = 0;
+	memcpy(damage->regions, frame, frameCount * sizeof(BLRecti));
+	count += frameCount;
+	for(BLUInt age = 1; age < damage->bufferAge; age++)
+	{
+		memcpy(&damage->regions[count], damage->history[age - 1], damage->historyCounts[age - 1] * sizeof(BLRecti));
+		count += damage->historyCounts[age - 1];
+	}
+	damage->regionCount = BLHelperMergeRects(damage->regions, count, BL_IDAMAGE_REGION_MAX);
+
+	//push this frame into the history, idle frames aren't
+	//swapped so the back buffer doesn't age
+	if(damage->regionCount > 0)
+	{
+		for(BLUInt age = BL_IDAMAGE_AGE_MAX - 1; age > 0; age--)
+		{
+			memcpy(damage->history[age], damage->history[age - 1], sizeof(damage->history[age]));
+			damage->historyCounts[age] = damage->historyCounts[age - 1];
+		}
+		memcpy(damage->history[0], frame, frameCount * sizeof(BLRecti));
+		damage->historyCounts[0] = frameCount;
+	}
+
+	//count
+	damage->stats.frames++;
+	damage->stats.fullPixels += (unsigned long long)view.W * (unsigned long long)view.H;
+	damage->stats.regions    += damage->regionCount;
+	if(damage->regionCount == 0)
+	{
+		damage->stats.idleFrames++;
+	}
+	for(BLUInt i = 0; i < damage->regionCount; i++)
+	{
+		damage->stats.pixels += (unsigned long long)damage->regions[i].W * (unsigned long long)damage->regions[i].H;
+	}
+
+	//end
+	return damage->regionCount;
+}
+
+/*************************************************************
+* NAME: BLIGetDamageRegion
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt index -> region to get
+* RETURNS:
+*	BLRecti of the region, empty if index is out of range
+* NOTE: N/A
+*************************************************************/
+BLRecti BLIGetDamageRegion(BLUInt index)
+{
+	if(damage == NULL || index >= damage->regionCount)
+	{
+		return BLCreateRecti(0, 0, 0, 0);
+	}
+	return damage->regions[index];
+}
+
+/*************************************************************
+* NAME: BLIBeginDamageRegion
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt index -> region to redraw
+*	BLByte R -> clear color R
+*	BLByte G -> clear color G
+*	BLByte B -> clear color B
+*	BLByte A -> clear color A
+* RETURNS:
+*	void
+* NOTE:
+*	Clips to the region and clears it. Replaces
+*	BLClearBuffers
+*************************************************************/
+void BLIBeginDamageRegion(BLUInt index, BLByte R, BLByte G, BLByte B, BLByte A)
+{
+	if(damage == NULL || index >= damage->regionCount)
+	{
+		return;
+	}
+
+	//clip, then clear (clears are cut by the clip)
+	BLISetClipRect(damage->regions[index]);
+	BLClearBuffers(R, G, B, A);
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLIEndDamageRegion
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Draws batched quads and removes the clip
+*************************************************************/
+void BLIEndDamageRegion( )
+{
+	BLIClearClipRect( );
+	return;
+}
+
+/*************************************************************
+* NAME: BLIEndDamage
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Starts collecting damage for the next frame
+*************************************************************/
+void BLIEndDamage( )
+{
+	if(damage != NULL)
+	{
+		damage->regionCount = 0;
+	}
+	return;
+}
+
+/*************************************************************
+* NAME: BLIGetDamageStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLIDamageStats of the tracker
+* NOTE: N/A
+*************************************************************/
+BLIDamageStats BLIGetDamageStats( )
+{
+	//check if init
+	if(damage == NULL)
+	{
+		BLIDamageStats empty = { 0 };
+		return empty;
+	}
+
+	return damage->stats;
+}
+
+/*************************************************************
+* NAME: BLIResetDamageStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE: N/A
+*************************************************************/
+void BLIResetDamageStats( )
+{
+	if(damage != NULL)
+	{
+		memset(&damage->stats, 0, sizeof(BLIDamageStats));
+	}
+	return;
+}
\ No newline at end of file
@@ -0,0 +1,167 @@
+#ifndef __IHITGRID_INCLUDE__
+#define __IHITGRID_INCLUDE__
+
+
+/*************************************************************
+* FILE: IHitGrid.h
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Uniform grid for finding which widget is under the mouse
+* CONTENTS:
+*	- Includes
+*	- Defs
+*	- Structs
+*	- Functions
+*
+*************************************************************/
+
+#include "ICore.h"
+
+#define BL_IHITGRID_CELL_SIZE  0x20       // default cell size (in pixels)
+#define BL_IHITGRID_ITEM_START 0x100      // starting item buffer size
+#define BL_IHITGRID_NONE       0xFFFFFFFF // key for no widget
+
+/*************************************************************
+* NAME: BLIHitGrid
+* DATE: 2026 - 10 - 19
+* NOTE:
+*	Members are private to IHitGridSource.c. Create with
+*	BLICreateHitGrid, free with BLIDestroyHitGrid
+*************************************************************/
+typedef struct BLIHitGrid BLIHitGrid;
+
+/*************************************************************
+* NAME: BLICreateHitGrid
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt cellSize -> size of each cell (in pixels), 0 for
+*	BL_IHITGRID_CELL_SIZE
+* RETURNS:
+*	BLIHitGrid* created (empty), NULL for failure
+* NOTE: N/A
+*************************************************************/
+BLIHitGrid* BLICreateHitGrid(BLUInt cellSize);
+
+/*************************************************************
+* NAME: BLIDestroyHitGrid
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLIHitGrid* grid -> hit grid to free
+* RETURNS:
+*	void
+* NOTE: N/A
+*************************************************************/
+void BLIDestroyHitGrid(BLIHitGrid* grid);
+
+/*************************************************************
+* NAME: BLIHitGridBegin
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLIHitGrid* grid -> hit grid to start filling
+* RETURNS:
+*	void
+* NOTE:
+*	Throws out last frame's widgets. Which widget is held
+*	down is kept
+*************************************************************/
+void BLIHitGridBegin(BLIHitGrid* grid);
+
+/*************************************************************
+* NAME: BLIHitGridAdd
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLIHitGrid* grid -> hit grid to add to
+*	BLRecti bounds -> bounds of the widget
+*	BLInt z    -> z order, higher is on top
+*	BLUInt key -> caller's id for the widget, should stay the
+*	same from frame to frame
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	With equal z, widgets added later are on top
+*************************************************************/
+int BLIHitGridAdd(BLIHitGrid* grid, BLRecti bounds, BLInt z, BLUInt key);
+
+/*************************************************************
+* NAME: BLIHitGridEnd
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLIHitGrid* grid -> hit grid to finish
+* RETURNS:
+*	void
+* NOTE:
+*	Sorts the widgets into cells over the viewport, then
+*	routes this update's mouse events from the input snapshot
+*	of the window being rendered to. Every button press and
+*	release goes to the widget under the cursor at that
+*	event, not just at the end of the update
+*************************************************************/
+void BLIHitGridEnd(BLIHitGrid* grid);
+
+/*************************************************************
+* NAME: BLIHitGridQuery
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLIHitGrid* grid -> hit grid to check
+*	BLInt X -> X position (in pixels, from the left)
+*	BLInt Y -> Y position (in pixels, from the bottom)
+* RETURNS:
+*	BLUInt, key of the top widget at X, Y, BL_IHITGRID_NONE
+*	for none
+* NOTE:
+*	Only checks the widgets in one cell. Points outside the
+*	viewport hit nothing. Only valid after BLIHitGridEnd
+*************************************************************/
+BLUInt BLIHitGridQuery(const BLIHitGrid* grid, BLInt X, BLInt Y);
+
+/*************************************************************
+* NAME: BLIHitGridGetHovered
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLIHitGrid* grid -> hit grid to check
+* RETURNS:
+*	BLUInt, key of the top widget under the cursor,
+*	BL_IHITGRID_NONE for none
+* NOTE: N/A
+*************************************************************/
+BLUInt BLIHitGridGetHovered(const BLIHitGrid* grid);
+
+/*************************************************************
+* NAME: BLIHitGridGetActive
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLIHitGrid* grid -> hit grid to check
+* RETURNS:
+*	BLUInt, key of the widget the left button was pressed on
+*	and is still held, BL_IHITGRID_NONE for none
+* NOTE: N/A
+*************************************************************/
+BLUInt BLIHitGridGetActive(const BLIHitGrid* grid);
+
+/*************************************************************
+* NAME: BLIHitGridGetPressed
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLIHitGrid* grid -> hit grid to check
+* RETURNS:
+*	BLUInt, key of the widget the left button was pressed on
+*	this update, BL_IHITGRID_NONE for none
+* NOTE: N/A
+*************************************************************/
+BLUInt BLIHitGridGetPressed(const BLIHitGrid* grid);
+
+/*************************************************************
+* NAME: BLIHitGridGetClicked
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLIHitGrid* grid -> hit grid to check
+* RETURNS:
+*	BLUInt, key of the widget clicked this update (left
+*	button pressed and released on it), BL_IHITGRID_NONE for
+*	none
+* NOTE: N/A
+*************************************************************/
+BLUInt BLIHitGridGetClicked(const BLIHitGrid* grid);
+
+#endif
@@ -0,0 +1,499 @@
+/*************************************************************
+* FILE: IHitGridSource.c
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Source file for the hit test grid
+* CONTENTS:
+*	- Includes
+*	- Backend struct defs
+*	- File-Specifc functions
+*	- Functions
+*
+*************************************************************/
+
+#include <stdio.h>   // I/O
+#include <stdlib.h>  // For memory management
+#include <string.h>  // For memset
+#include <Windows.h> // OpenGL dependancy
+#include <gl/GL.h>   // For the viewport
+#include <glfw3.h>   // For mouse button codes
+
+#include "IHitGrid.h" // Header
+
+/*************************************************************
+* NAME: BLHitItem
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLRecti bounds -> bounds of the widget
+*	BLInt z        -> z order
+*	BLUInt key     -> caller's id
+* NOTE: File specific struct
+*************************************************************/
+typedef struct BLHitItem
+{
+	BLRecti bounds;
+	BLInt   z;
+	BLUInt  key;
+}BLHitItem;
+
+/*************************************************************
+* NAME: BLIHitGrid
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLUInt cellSize  -> size of each cell (in pixels)
+*	BLHitItem* items -> widgets added this frame
+*	BLUInt itemCount -> amount of items
+*	BLUInt itemCap   -> size of items
+*	BLUInt cols      -> cells across
+*	BLUInt rows      -> cells up
+*	BLUInt* cellStart -> first entry of each cell in cellItems
+*	(cols * rows + 1 used)
+*	BLUInt cellCap   -> size of cellStart
+*	BLUInt* cellItems -> item indices, grouped by cell
+*	BLUInt cellItemCap -> size of cellItems
+*	BLInt viewW      -> viewport width at BLIHitGridEnd
+*	BLInt viewH      -> viewport height at BLIHitGridEnd
+*	BLVert2f lastMouse -> cursor at the last BLIHitGridEnd
+*	BLUInt hovered   -> widget under the cursor
+*	BLUInt active    -> widget held down
+*	BLUInt pressed   -> widget pressed this update
+*	BLUInt clicked   -> widget clicked this update
+* NOTE:
+*	Cells are stored flat (counting sort), so building is two
+*	passes over the items and no allocation once warmed up
+*************************************************************/
+struct BLIHitGrid
+{
+	BLUInt     cellSize;
+	BLHitItem* items;
+	BLUInt     itemCount;
+	BLUInt     itemCap;
+	BLUInt     cols;
+	BLUInt     rows;
+	BLUInt*    cellStart;
+	BLUInt     cellCap;
+	BLUInt*    cellItems;
+	BLUInt     cellItemCap;
+	BLInt      viewW;
+	BLInt      viewH;
+	BLVert2f   lastMouse;
+	BLUInt     hovered;
+	BLUInt     active;
+	BLUInt     pressed;
+	BLUInt     clicked;
+};
+
+/*************************************************************
+* NAME: BLHelperGrowBuffer
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	void** buffer   -> buffer to grow
+*	BLUInt* cap     -> capacity of buffer (in elements)
+*	BLUInt need     -> capacity needed (in elements)
+*	BLUInt elemSize -> size of each element
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Doubles the capacity until need fits
+*************************************************************/
+static int BLHelperGrowBuffer(void** buffer, BLUInt* cap, BLUInt need, BLUInt elemSize)
+{
+	//check if big enough
+	if(need <= *cap)
+	{
+		return 1;
+	}
+
+	//get new size
+	BLUInt newCap = (*cap > 0) ? *cap : BL_IHITGRID_ITEM_START;
+	while(newCap < need)
+	{
+		newCap *= 2;
+	}
+
+	//reallocate
+	void* newBuffer = realloc(*buffer, (size_t)newCap * elemSize);
+	if(newBuffer == NULL)
+	{
+		fprintf(stderr, "IHitGrid: memory err\n");
+		return 0;
+	}
+
+	*buffer = newBuffer;
+	*cap    = newCap;
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLHelperCellRange
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLIHitGrid* grid -> grid to check
+*	BLRecti bounds -> bounds to find cells of
+*	BLUInt* range  -> set to first col, first row, last col,
+*	last row
+* RETURNS:
+*	int, 1 if bounds touch the viewport, 0 if not
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline int BLHelperCellRange(const BLIHitGrid* grid, BLRecti bounds, BLUInt* range)
+{
+	//check if off screen (or empty)
+	if(bounds.W <= 0 || bounds.H <= 0 || bounds.X + bounds.W <= 0 || bounds.Y + bounds.H <= 0 ||
+		bounds.X >= grid->viewW || bounds.Y >= grid->viewH)
+	{
+		return 0;
+	}
+
+	//clamp to grid
+	const BLInt cellSize = (BLInt)grid->cellSize;
+	const BLInt right    = bounds.X + bounds.W - 1;
+	const BLInt top      = bounds.Y + bounds.H - 1;
+	range[0] = (bounds.X > 0) ? (BLUInt)(bounds.X / cellSize) : 0;
+	range[1] = (bounds.Y > 0) ? (BLUInt)(bounds.Y / cellSize) : 0;
+	range[2] = (right < grid->viewW) ? (BLUInt)(right / cellSize) : grid->cols - 1;
+	range[3] = (top   < grid->viewH) ? (BLUInt)(top   / cellSize) : grid->rows - 1;
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLHelperQueryMouse
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLIHitGrid* grid -> grid to check
+*	BLVert2f mousePos -> cursor in window space
+* RETURNS:
+*	BLUInt, key of the top widget under the cursor
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Flips Y the same way as BLICheckMouseOverlap
+*************************************************************/
+static inline BLUInt BLHelperQueryMouse(const BLIHitGrid* grid, BLVert2f mousePos)
+{
+	return BLIHitGridQuery(grid, (BLInt)mousePos.X, grid->viewH - (BLInt)mousePos.Y);
+}
+
+/*************************************************************
+* NAME: BLICreateHitGrid
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt cellSize -> size of each cell (in pixels), 0 for
+*	BL_IHITGRID_CELL_SIZE
+* RETURNS:
+*	BLIHitGrid* created (empty), NULL for failure
+* NOTE: N/A
+*************************************************************/
+BLIHitGrid* BLICreateHitGrid(BLUInt cellSize)
+{
+	//allocate
+	BLIHitGrid* grid = calloc(1, sizeof(BLIHitGrid));
+	if(grid == NULL)
+	{
+		fprintf(stderr, "Cannot create hit grid: memory err\n");
+		return NULL;
+	}
+
+	grid->cellSize = (cellSize > 0) ? cellSize : BL_IHITGRID_CELL_SIZE;
+	grid->hovered  = BL_IHITGRID_NONE;
+	grid->active   = BL_IHITGRID_NONE;
+	grid->pressed  = BL_IHITGRID_NONE;
+	grid->clicked  = BL_IHITGRID_NONE;
+
+	//end
+	return grid;
+}
+
+/*************************************************************
+* NAME: BLIDestroyHitGrid
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLIHitGrid* grid -> hit grid to free
+* RETURNS:
+*	void
+* NOTE: N/A
+*************************************************************/
+void BLIDestroyHitGrid(BLIHitGrid* grid)
+{
+	if(grid == NULL)
+	{
+		return;
+	}
+
+	free(grid->items);
+	free(grid->cellStart);
+	free(grid->cellItems);
+	free(grid);
+}
+
+/*************************************************************
+* NAME: BLIHitGridBegin
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLIHitGrid* grid -> hit grid to start filling
+* RETURNS:
+*	void
+* NOTE:
+*	Throws out last frame's widgets. Which widget is held
+*	down is kept
+*************************************************************/
+void BLIHitGridBegin(BLIHitGrid* grid)
+{
+	grid->itemCount = 0;
+	grid->cols      = 0;
+	grid->rows      = 0;
+}
+
+/*************************************************************
+* NAME: BLIHitGridAdd
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLIHitGrid* grid -> hit grid to add to
+*	BLRecti bounds -> bounds of the widget
+*	BLInt z    -> z order, higher is on top
+*	BLUInt key -> caller's id for the widget, should stay the
+*	same from frame to frame
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	With equal z, widgets added later are on top
+*************************************************************/
+int BLIHitGridAdd(BLIHitGrid* grid, BLRecti bounds, BLInt z, BLUInt key)
+{
+	if(BLHelperGrowBuffer((void**)&grid->items, &grid->itemCap, grid->itemCount + 1, sizeof(BLHitItem)) == 0)
+	{
+		return 0;
+	}
+
+	BLHitItem* item = &grid->items[grid->itemCount++];
+	item->bounds = bounds;
+	item->z      = z;
+	item->key    = key;
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLIHitGridEnd
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLIHitGrid* grid -> hit grid to finish
+* RETURNS:
+*	void
+* NOTE:
+*	Sorts the widgets into cells over the viewport, then
+*	routes this update's mouse events from the input snapshot
+*	of the window being rendered to. Every button press and
+*	release goes to the widget under the cursor at that
+*	event, not just at the end of the update
+*************************************************************/
+void BLIHitGridEnd(BLIHitGrid* grid)
+{
+	//get viewport, once for every widget
+	int viewPortDimensions[4];
+	glGetIntegerv(GL_VIEWPORT, viewPortDimensions);
+	grid->viewW = (viewPortDimensions[2] > 0) ? viewPortDimensions[2] : 0;
+	grid->viewH = (viewPortDimensions[3] > 0) ? viewPortDimensions[3] : 0;
+	grid->cols  = ((BLUInt)grid->viewW + grid->cellSize - 1) / grid->cellSize;
+	grid->rows  = ((BLUInt)grid->viewH + grid->cellSize - 1) / grid->cellSize;
+
+	//count items per cell
+	const BLUInt cellCount = grid->cols * grid->rows;
+	if(BLHelperGrowBuffer((void**)&grid->cellStart, &grid->cellCap, cellCount + 1, sizeof(BLUInt)) == 0)
+	{
+		grid->cols = 0;
+		grid->rows = 0;
+		return;
+	}
+	memset(grid->cellStart, 0, (cellCount + 1) * sizeof(BLUInt));
+
+	BLUInt range[4];
+	for(BLUInt i = 0; i < grid->itemCount; i++)
+	{
+		if(BLHelperCellRange(grid, grid->items[i].bounds, range))
+		{
+			for(BLUInt row = range[1]; row <= range[3]; row++)
+			{
+				for(BLUInt col = range[0]; col <= range[2]; col++)
+				{
+					grid->cellStart[row * grid->cols + col + 1]++;
+				}
+			}
+		}
+	}
+
+	//turn counts into starts
+	for(BLUInt i = 0; i < cellCount; i++)
+	{
+		grid->cellStart[i + 1] += grid->cellStart[i];
+	}
+
+	//fill cells, using each start as a write cursor then shifting back
+	if(BLHelperGrowBuffer((void**)&grid->cellItems, &grid->cellItemCap, grid->cellStart[cellCount] + 1, sizeof(BLUInt)) == 0)
+	{
+		grid->cols = 0;
+		grid->rows = 0;
+		return;
+	}
+	for(BLUInt i = 0; i < grid->itemCount; i++)
+	{
+		if(BLHelperCellRange(grid, grid->items[i].bounds, range))
+		{
+			for(BLUInt row = range[1]; row <= range[3]; row++)
+			{
+				for(BLUInt col = range[0]; col <= range[2]; col++)
+				{
+					grid->cellItems[grid->cellStart[row * grid->cols + col]++] = i;
+				}
+			}
+		}
+	}
+	for(BLUInt i = cellCount; i > 0; i--)
+	{
+		grid->cellStart[i] = grid->cellStart[i - 1];
+	}
+	grid->cellStart[0] = 0;
+
+	//route mouse events in order
+	const BLInputFrame* input = BLWindowGetInput(BLRenderGetWindowContext( ));
+	BLVert2f mousePos = grid->lastMouse;
+	grid->pressed = BL_IHITGRID_NONE;
+	grid->clicked = BL_IHITGRID_NONE;
+	for(BLUInt i = 0; i < input->eventCount; i++)
+	{
+		const BLInputEvent* event = &input->events[i];
+		if(event->type == BL_INPUT_EVENT_CURSOR)
+		{
+			mousePos = event->pos;
+		}
+		else if(event->type == BL_INPUT_EVENT_BUTTON && event->code == GLFW_MOUSE_BUTTON_LEFT)
+		{
+			const BLUInt under = BLHelperQueryMouse(grid, mousePos);
+			if(event->action == BL_INPUT_ACTION_PRESS)
+			{
+				grid->pressed = under;
+				grid->active  = under;
+			}
+			else if(event->action == BL_INPUT_ACTION_RELEASE)
+			{
+				if(grid->active != BL_IHITGRID_NONE && grid->active == under)
+				{
+					grid->clicked = under;
+				}
+				grid->active = BL_IHITGRID_NONE;
+			}
+		}
+	}
+
+	//hover at the end of the update
+	grid->lastMouse = input->mousePos;
+	grid->hovered = BLHelperQueryMouse(grid, input->mousePos);
+}
+
+/*************************************************************
+* NAME: BLIHitGridQuery
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLIHitGrid* grid -> hit grid to check
+*	BLInt X -> X position (in pixels, from the left)
+*	BLInt Y -> Y position (in pixels, from the bottom)
+* RETURNS:
+*	BLUInt, key of the top widget at X, Y, BL_IHITGRID_NONE
+*	for none
+* NOTE:
+*	Only checks the widgets in one cell. Points outside the
+*	viewport hit nothing. Only valid after BLIHitGridEnd
+*************************************************************/
+BLUInt BLIHitGridQuery(const BLIHitGrid* grid, BLInt X, BLInt Y)
+{
+	//check if outside grid
+	if(X < 0 || Y < 0 || X >= grid->viewW || Y >= grid->viewH || grid->cols == 0)
+	{
+		return BL_IHITGRID_NONE;
+	}
+
+	//check every widget in the cell, same bounds rule as BLICheckMouseOverlap
+	const BLUInt cell  = (BLUInt)(Y / (BLInt)grid->cellSize) * grid->cols + (BLUInt)(X / (BLInt)grid->cellSize);
+	const BLHitItem* top = NULL;
+	for(BLUInt i = grid->cellStart[cell]; i < grid->cellStart[cell + 1]; i++)
+	{
+		const BLHitItem* item = &grid->items[grid->cellItems[i]];
+		if(X > item->bounds.X && X < item->bounds.X + item->bounds.W &&
+			Y > item->bounds.Y && Y < item->bounds.Y + item->bounds.H &&
+			(top == NULL || item->z >= top->z))
+		{
+			top = item;
+		}
+	}
+
+	//end
+	return (top != NULL) ? top->key : BL_IHITGRID_NONE;
+}
+
+/*************************************************************
+* NAME: BLIHitGridGetHovered
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLIHitGrid* grid -> hit grid to check
+* RETURNS:
+*	BLUInt, key of the top widget under the cursor,
+*	BL_IHITGRID_NONE for none
+* NOTE: N/A
+*************************************************************/
+BLUInt BLIHitGridGetHovered(const BLIHitGrid* grid)
+{
+	return grid->hovered;
+}
+
+/*************************************************************
+* NAME: BLIHitGridGetActive
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLIHitGrid* grid -> hit grid to check
+* RETURNS:
+*	BLUInt, key of the widget the left button was pressed on
+*	and is still held, BL_IHITGRID_NONE for none
+* NOTE: N/A
+*************************************************************/
+BLUInt BLIHitGridGetActive(const BLIHitGrid* grid)
+{
+	return grid->active;
+}
+
+/*************************************************************
+* NAME: BLIHitGridGetPressed
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLIHitGrid* grid -> hit grid to check
+* RETURNS:
+*	BLUInt, key of the widget the left button was pressed on
+*	this update, BL_IHITGRID_NONE for none
+* NOTE: N/A
+*************************************************************/
+BLUInt BLIHitGridGetPressed(const BLIHitGrid* grid)
+{
+	return grid->pressed;
+}
+
+/*************************************************************
+* NAME: BLIHitGridGetClicked
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLIHitGrid* grid -> hit grid to check
+* RETURNS:
+*	BLUInt, key of the widget clicked this update (left
+*	button pressed and released on it), BL_IHITGRID_NONE for
+*	none
+* NOTE: N/A
+*************************************************************/
+BLUInt BLIHitGridGetClicked(const BLIHitGrid* grid)
+{
+	return grid->clicked;
+}
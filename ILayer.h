@@ -0,0 +1,196 @@
+#ifndef __ILAYER_INCLUDE__
+#define __ILAYER_INCLUDE__
+
+
+/*************************************************************
+* FILE: ILayer.h
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Offscreen layers for caching static UI panels
+* CONTENTS:
+*	- Includes
+*	- Defs
+*	- Structs
+*	- Functions
+*
+*************************************************************/
+
+#include "ICore.h"
+
+#define BL_ILAYER_MAX         0x20      // max amount of layers
+#define BL_ILAYER_DEFAULT_CAP 0x2000000 // default memory cap (32MB)
+#define BL_ILAYER_ERRHANDLE   -1        // handle for no layer
+
+typedef BLInt BLILayerHandle;
+
+/*************************************************************
+* NAME: BLILayerStats
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLUInt renders    -> times a layer's contents were drawn
+*	into its texture
+*	BLUInt composites -> times a layer was drawn from its
+*	texture
+*	BLUInt evictions  -> textures thrown out to make space
+*	BLUInt memUsed    -> bytes used by layer textures
+*	BLUInt memCap     -> max bytes layer textures can use
+* NOTE: N/A
+*************************************************************/
+typedef struct BLILayerStats
+{
+	BLUInt renders;
+	BLUInt composites;
+	BLUInt evictions;
+	BLUInt memUsed;
+	BLUInt memCap;
+}BLILayerStats;
+
+/*************************************************************
+* NAME: BLInitILayer
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt memCap -> max bytes layer textures can use
+*	(0 for BL_ILAYER_DEFAULT_CAP)
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	Needs a current openGL context. Without framebuffer
+*	object or separate blend support, layers are drawn
+*	directly every frame
+*************************************************************/
+int BLInitILayer(BLUInt memCap);
+
+/*************************************************************
+* NAME: BLTerminateILayer
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Destroys every layer
+*************************************************************/
+void BLTerminateILayer( );
+
+/*************************************************************
+* NAME: BLICreateLayer
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLRecti bounds -> screenspace bounds of the panel
+* RETURNS:
+*	BLILayerHandle of the layer, BL_ILAYER_ERRHANDLE for
+*	failure
+* NOTE:
+*	No texture is made until the layer is first drawn
+*************************************************************/
+BLILayerHandle BLICreateLayer(BLRecti bounds);
+
+/*************************************************************
+* NAME: BLIDestroyLayer
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayerHandle lHndl -> layer to destroy
+* RETURNS:
+*	void
+* NOTE: N/A
+*************************************************************/
+void BLIDestroyLayer(BLILayerHandle lHndl);
+
+/*************************************************************
+* NAME: BLISetLayerBounds
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayerHandle lHndl -> layer to move
+*	BLRecti bounds -> new screenspace bounds of the panel
+* RETURNS:
+*	void
+* NOTE:
+*	Invalidates the layer if bounds changed, the old and new
+*	bounds are reported to IDamage
+*************************************************************/
+void BLISetLayerBounds(BLILayerHandle lHndl, BLRecti bounds);
+
+/*************************************************************
+* NAME: BLIInvalidateLayer
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayerHandle lHndl -> layer whose contents changed
+* RETURNS:
+*	void
+* NOTE:
+*	The next BLIBeginLayer returns 1. The bounds are reported
+*	to IDamage
+*************************************************************/
+void BLIInvalidateLayer(BLILayerHandle lHndl);
+
+/*************************************************************
+* NAME: BLIBeginLayer
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayerHandle lHndl -> layer to draw
+* RETURNS:
+*	int, 1 if the contents must be drawn (then call
+*	BLIEndLayer), 0 if the kept texture is good
+* NOTE:
+*	Contents are drawn in screenspace as usual and cut to the
+*	layer bounds. The layer is also redrawn after the viewport
+*	changes size. When the layer can't get a texture (no
+*	support, over the memory cap, or inside another layer),
+*	the contents go straight to the screen. Use like:
+*		if(BLIBeginLayer(l)) { draw panel; BLIEndLayer(l); }
+*		BLIRenderLayer(l);
+*************************************************************/
+int BLIBeginLayer(BLILayerHandle lHndl);
+
+/*************************************************************
+* NAME: BLIEndLayer
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayerHandle lHndl -> layer being drawn
+* RETURNS:
+*	void
+* NOTE:
+*	Restores the screen as the render target
+*************************************************************/
+void BLIEndLayer(BLILayerHandle lHndl);
+
+/*************************************************************
+* NAME: BLIRenderLayer
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayerHandle lHndl -> layer to draw
+* RETURNS:
+*	void
+* NOTE:
+*	Draws the layer as a single textured quad (batched).
+*	The texture holds premultiplied colors, so see-through
+*	panels look the same as when drawn straight to the screen
+*************************************************************/
+void BLIRenderLayer(BLILayerHandle lHndl);
+
+/*************************************************************
+* NAME: BLIGetLayerStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLILayerStats of the layers
+* NOTE: N/A
+*************************************************************/
+BLILayerStats BLIGetLayerStats( );
+
+/*************************************************************
+* NAME: BLIResetLayerStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Zeros renders, composites and evictions
+*************************************************************/
+void BLIResetLayerStats( );
+
+
+#endif
@@ -0,0 +1,706 @@
+/*************************************************************
+* FILE: ILayerSource.c
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Source file for offscreen layers
+* CONTENTS:
+*	- Includes
+*	- Defs
+*	- Backend struct defs
+*	- Backend objects
+*	- File-Specifc functions
+*	- Functions
+*
+*************************************************************/
+
+#include <stdio.h>   // I/O
+#include <stdlib.h>  // For memory management
+#include <string.h>  // For memset
+#include <Windows.h> // OpenGL dependancy
+#include <gl/GL.h>   // For textures and the viewport
+#include <glfw3.h>   // For loading framebuffer functions
+
+#include "ILayer.h"  // Header
+#include "IBatch.h"  // For drawing layers
+#include "IDamage.h" // For reporting changed layers
+
+//framebuffer object enums (not in the 1.1 headers)
+#define BL_GL_FRAMEBUFFER          0x8D40
+#define BL_GL_FRAMEBUFFER_BINDING  0x8CA6
+#define BL_GL_FRAMEBUFFER_COMPLETE 0x8CD5
+#define BL_GL_COLOR_ATTACHMENT0    0x8CE0
+
+typedef void   (APIENTRY *BLGLGenFramebuffers)(GLsizei n, GLuint* framebuffers);
+typedef void   (APIENTRY *BLGLDeleteFramebuffers)(GLsizei n, const GLuint* framebuffers);
+typedef void   (APIENTRY *BLGLBindFramebuffer)(GLenum target, GLuint framebuffer);
+typedef void   (APIENTRY *BLGLFramebufferTexture2D)(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
+typedef GLenum (APIENTRY *BLGLCheckFramebufferStatus)(GLenum target);
+typedef void   (APIENTRY *BLGLBlendFuncSeparate)(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha);
+
+/*************************************************************
+* NAME: BLLayer
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	int inUse      -> 1 if layer is created
+*	BLRecti bounds -> screenspace bounds of the panel
+*	GLuint texture -> texture holding the contents, 0 for none
+*	GLuint fbo     -> framebuffer drawing into texture
+*	BLInt texW     -> width of texture
+*	BLInt texH     -> height of texture
+*	BLInt viewW    -> viewport width the contents were drawn at
+*	BLInt viewH    -> viewport height the contents were drawn at
+*	int valid      -> 1 if texture holds the current contents
+*	BLUInt lastUse -> tick of the last use (for eviction)
+* NOTE: File specific struct
+*************************************************************/
+typedef struct BLLayer
+{
+	int     inUse;
+	BLRecti bounds;
+	GLuint  texture;
+	GLuint  fbo;
+	BLInt   texW;
+	BLInt   texH;
+	BLInt   viewW;
+	BLInt   viewH;
+	int     valid;
+	BLUInt  lastUse;
+}BLLayer;
+
+/*************************************************************
+* NAME: BLLayerList
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLLayer layers[] -> every layer
+*	BLILayerHandle active -> layer being drawn into, 
+*	BL_ILAYER_ERRHANDLE for none
+*	BLUInt tick      -> use counter
+*	BLILayerStats stats -> counters
+*	GLint prevFbo    -> framebuffer bound before the active layer
+*	GLint prevView[] -> viewport before the active layer
+*	GLfloat prevClear[] -> clear color before the active layer
+*	int prevHasClip  -> 1 if a clip rect was set before
+*	BLRect prevClip  -> clip rect before the active layer
+*	gen..blendFuncSeparate -> framebuffer and blend
+*	functions, NULL if not supported
+* NOTE: File specific struct, there should only be one
+* instance of this struct at ALL times
+*************************************************************/
+typedef struct BLLayerList
+{
+	BLLayer                    layers[BL_ILAYER_MAX];
+	BLILayerHandle             active;
+	BLUInt                     tick;
+	BLILayerStats              stats;
+	GLint                      prevFbo;
+	GLint                      prevView[4];
+	GLfloat                    prevClear[4];
+	int                        prevHasClip;
+	BLRect                     prevClip;
+	BLGLGenFramebuffers        genFramebuffers;
+	BLGLDeleteFramebuffers     deleteFramebuffers;
+	BLGLBindFramebuffer        bindFramebuffer;
+	BLGLFramebufferTexture2D   framebufferTexture2D;
+	BLGLCheckFramebufferStatus checkStatus;
+	BLGLBlendFuncSeparate      blendFuncSeparate;
+}BLLayerList;
+
+/*************************************************************
+* NAME: layerList (object)
+* DATE: 2026 - 10 - 19
+* USE:
+*	This is an instance of the BLLayerList struct used to hold
+*	every layer
+* NOTE: N/A
+*************************************************************/
+static BLLayerList* layerList = NULL;
+
+/*************************************************************
+* NAME: BLHelperLoadProc
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const char* name -> core name of the function
+*	const char* extName -> extension name of the function
+* RETURNS:
+*	void* function, NULL if not supported
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static void* BLHelperLoadProc(const char* name, const char* extName)
+{
+	void* proc = (void*)glfwGetProcAddress(name);
+	if(proc == NULL)
+	{
+		proc = (void*)glfwGetProcAddress(extName);
+	}
+	return proc;
+}
+
+/*************************************************************
+* NAME: BLHelperLayerBlend
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Blend hook while a layer is drawn. Colors blend as usual,
+*	alpha adds up as coverage, so the texture ends up holding
+*	premultiplied colors
+*************************************************************/
+static void BLHelperLayerBlend( )
+{
+	layerList->blendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+	return;
+}
+
+/*************************************************************
+* NAME: BLHelperCompositeBlend
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Blend hook while a layer texture is drawn, its colors are
+*	already multiplied by its alpha
+*************************************************************/
+static void BLHelperCompositeBlend( )
+{
+	glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+	return;
+}
+
+/*************************************************************
+* NAME: BLHelperGetLayer
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayerHandle lHndl -> handle to check
+* RETURNS:
+*	BLLayer* of the handle, NULL if not a layer
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline BLLayer* BLHelperGetLayer(BLILayerHandle lHndl)
+{
+	if(layerList == NULL || lHndl < 0 || lHndl >= BL_ILAYER_MAX || layerList->layers[lHndl].inUse == 0)
+	{
+		return NULL;
+	}
+	return &layerList->layers[lHndl];
+}
+
+/*************************************************************
+* NAME: BLHelperFreeTexture
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLLayer* layer -> layer to free the texture of
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static void BLHelperFreeTexture(BLLayer* layer)
+{
+	if(layer->texture == 0)
+	{
+		return;
+	}
+
+	layerList->deleteFramebuffers(1, &layer->fbo);
+	glDeleteTextures(1, &layer->texture);
+	layerList->stats.memUsed -= (BLUInt)(layer->texW * layer->texH * 4);
+
+	layer->texture = 0;
+	layer->fbo     = 0;
+	layer->texW    = 0;
+	layer->texH    = 0;
+	layer->valid   = 0;
+}
+
+/*************************************************************
+* NAME: BLHelperMakeTexture
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLLayer* layer -> layer to make a texture for
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Evicts the least recently used textures until it fits
+*	under the memory cap
+*************************************************************/
+static int BLHelperMakeTexture(BLLayer* layer)
+{
+	//keep if same size
+	const BLInt  texW    = layer->bounds.W;
+	const BLInt  texH    = layer->bounds.H;
+	if(layer->texture != 0 && layer->texW == texW && layer->texH == texH)
+	{
+		return 1;
+	}
+	BLHelperFreeTexture(layer);
+
+	//check size
+	const BLUInt memSize = (BLUInt)(texW * texH * 4);
+	if(texW <= 0 || texH <= 0 || memSize > layerList->stats.memCap)
+	{
+		return 0;
+	}
+
+	//evict until it fits
+	while(layerList->stats.memUsed + memSize > layerList->stats.memCap)
+	{
+		BLLayer* oldest = NULL;
+		for(BLInt i = 0; i < BL_ILAYER_MAX; i++)
+		{
+			BLLayer* other = &layerList->layers[i];
+			if(other->inUse && other->texture != 0 && (oldest == NULL || other->lastUse < oldest->lastUse))
+			{
+				oldest = other;
+			}
+		}
+		if(oldest == NULL)
+		{
+			return 0;
+		}
+		BLHelperFreeTexture(oldest);
+		layerList->stats.evictions++;
+	}
+
+	//make texture
+	GLint prevTexture;
+	glGetIntegerv(GL_TEXTURE_BINDING_2D, &prevTexture);
+	glGenTextures(1, &layer->texture);
+	glBindTexture(GL_TEXTURE_2D, layer->texture);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, texW, texH, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+	glBindTexture(GL_TEXTURE_2D, (GLuint)prevTexture);
+
+	//attach to a framebuffer
+	layerList->genFramebuffers(1, &layer->fbo);
+	layerList->bindFramebuffer(BL_GL_FRAMEBUFFER, layer->fbo);
+	layerList->framebufferTexture2D(BL_GL_FRAMEBUFFER, BL_GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, layer->texture, 0);
+	const GLenum status = layerList->checkStatus(BL_GL_FRAMEBUFFER);
+	layerList->bindFramebuffer(BL_GL_FRAMEBUFFER, (GLuint)layerList->prevFbo);
+
+	layer->texW = texW;
+	layer->texH = texH;
+	layerList->stats.memUsed += memSize;
+
+	//check framebuffer
+	if(status != BL_GL_FRAMEBUFFER_COMPLETE)
+	{
+		fprintf(stderr, "ILayer: framebuffer incomplete\n");
+		BLHelperFreeTexture(layer);
+		return 0;
+	}
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLInitILayer
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt memCap -> max bytes layer textures can use
+*	(0 for BL_ILAYER_DEFAULT_CAP)
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	Needs a current openGL context. Without framebuffer
+*	object or separate blend support, layers are drawn
+*	directly every frame
+*************************************************************/
+int BLInitILayer(BLUInt memCap)
+{
+	//see if already init
+	if(layerList != NULL)
+	{
+		fprintf(stderr, "ILayer already init!\n");
+		return 0;
+	}
+
+	//init layerList
+	layerList = calloc(1, sizeof(BLLayerList));
+
+	//check if null
+	if(layerList == NULL)
+	{
+		fprintf(stderr, "Cannot Init ILayer: memory err\n");
+		return 0;
+	}
+
+	layerList->active       = BL_ILAYER_ERRHANDLE;
+	layerList->stats.memCap = (memCap == 0) ? BL_ILAYER_DEFAULT_CAP : memCap;
+
+	//load framebuffer and blend functions (core, then extension)
+	layerList->genFramebuffers      = (BLGLGenFramebuffers)       BLHelperLoadProc("glGenFramebuffers",        "glGenFramebuffersEXT");
+	layerList->deleteFramebuffers   = (BLGLDeleteFramebuffers)    BLHelperLoadProc("glDeleteFramebuffers",     "glDeleteFramebuffersEXT");
+	layerList->bindFramebuffer      = (BLGLBindFramebuffer)       BLHelperLoadProc("glBindFramebuffer",        "glBindFramebufferEXT");
+	layerList->framebufferTexture2D = (BLGLFramebufferTexture2D)  BLHelperLoadProc("glFramebufferTexture2D",   "glFramebufferTexture2DEXT");
+	layerList->checkStatus          = (BLGLCheckFramebufferStatus)BLHelperLoadProc("glCheckFramebufferStatus", "glCheckFramebufferStatusEXT");
+	layerList->blendFuncSeparate    = (BLGLBlendFuncSeparate)     BLHelperLoadProc("glBlendFuncSeparate",      "glBlendFuncSeparateEXT");
+	if(layerList->genFramebuffers == NULL || layerList->deleteFramebuffers == NULL || layerList->bindFramebuffer == NULL ||
+		layerList->framebufferTexture2D == NULL || layerList->checkStatus == NULL || layerList->blendFuncSeparate == NULL)
+	{
+		fprintf(stderr, "ILayer: no framebuffer objects, layers are drawn directly\n");
+		layerList->genFramebuffers = NULL;
+	}
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLTerminateILayer
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Destroys every layer
+*************************************************************/
+void BLTerminateILayer( )
+{
+	//check if init
+	if(layerList == NULL)
+	{
+		return;
+	}
+
+	//free layers
+	for(BLILayerHandle i = 0; i < BL_ILAYER_MAX; i++)
+	{
+		BLIDestroyLayer(i);
+	}
+
+	//free layerList
+	free(layerList);
+	layerList = NULL;
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLICreateLayer
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLRecti bounds -> screenspace bounds of the panel
+* RETURNS:
+*	BLILayerHandle of the layer, BL_ILAYER_ERRHANDLE for
+*	failure
+* NOTE:
+*	No texture is made until the layer is first drawn
+*************************************************************/
+BLILayerHandle BLICreateLayer(BLRecti bounds)
+{
+	//check if init
+	if(layerList == NULL)
+	{
+		fprintf(stderr, "ILayer not init!\n");
+		return BL_ILAYER_ERRHANDLE;
+	}
+
+	//find free layer
+	for(BLILayerHandle i = 0; i < BL_ILAYER_MAX; i++)
+	{
+		BLLayer* layer = &layerList->layers[i];
+		if(layer->inUse == 0)
+		{
+			memset(layer, 0, sizeof(BLLayer));
+			layer->inUse  = 1;
+			layer->bounds = bounds;
+			return i;
+		}
+	}
+
+	//no free layers
+	fprintf(stderr, "ILayer: too many layers\n");
+	return BL_ILAYER_ERRHANDLE;
+}
+
+/*************************************************************
+* NAME: BLIDestroyLayer
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayerHandle lHndl -> layer to destroy
+* RETURNS:
+*	void
+* NOTE: N/A
+*************************************************************/
+void BLIDestroyLayer(BLILayerHandle lHndl)
+{
+	BLLayer* layer = BLHelperGetLayer(lHndl);
+	if(layer == NULL)
+	{
+		return;
+	}
+
+	//can't destroy while drawing into it
+	if(layerList->active == lHndl)
+	{
+		BLIEndLayer(lHndl);
+	}
+
+	BLHelperFreeTexture(layer);
+	layer->inUse = 0;
+}
+
+/*************************************************************
+* NAME: BLISetLayerBounds
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayerHandle lHndl -> layer to move
+*	BLRecti bounds -> new screenspace bounds of the panel
+* RETURNS:
+*	void
+* NOTE:
+*	Invalidates the layer if bounds changed, the old and new
+*	bounds are reported to IDamage
+*************************************************************/
+void BLISetLayerBounds(BLILayerHandle lHndl, BLRecti bounds)
+{
+	BLLayer* layer = BLHelperGetLayer(lHndl);
+	if(layer == NULL)
+	{
+		return;
+	}
+
+	if(layer->bounds.X != bounds.X || layer->bounds.Y != bounds.Y ||
+		layer->bounds.W != bounds.W || layer->bounds.H != bounds.H)
+	{
+		BLIAddDamage(layer->bounds);
+		BLIAddDamage(bounds);
+		layer->bounds = bounds;
+		layer->valid  = 0;
+	}
+}
+
+/*************************************************************
+* NAME: BLIInvalidateLayer
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayerHandle lHndl -> layer whose contents changed
+* RETURNS:
+*	void
+* NOTE:
+*	The next BLIBeginLayer returns 1. The bounds are reported
+*	to IDamage
+*************************************************************/
+void BLIInvalidateLayer(BLILayerHandle lHndl)
+{
+	BLLayer* layer = BLHelperGetLayer(lHndl);
+	if(layer != NULL)
+	{
+		BLIAddDamage(layer->bounds);
+		layer->valid = 0;
+	}
+}
+
+/*************************************************************
+* NAME: BLIBeginLayer
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayerHandle lHndl -> layer to draw
+* RETURNS:
+*	int, 1 if the contents must be drawn (then call
+*	BLIEndLayer), 0 if the kept texture is good
+* NOTE:
+*	Contents are drawn in screenspace as usual and cut to the
+*	layer bounds. The layer is also redrawn after the viewport
+*	changes size. When the layer can't get a texture (no
+*	support, over the memory cap, or inside another layer),
+*	the contents go straight to the screen. Use like:
+*		if(BLIBeginLayer(l)) { draw panel; BLIEndLayer(l); }
+*		BLIRenderLayer(l);
+*************************************************************/
+int BLIBeginLayer(BLILayerHandle lHndl)
+{
+	BLLayer* layer = BLHelperGetLayer(lHndl);
+	if(layer == NULL || layerList->genFramebuffers == NULL || layerList->active != BL_ILAYER_ERRHANDLE)
+	{
+		if(layer != NULL)
+		{
+			layer->valid = 0;
+		}
+		return 1;
+	}
+	layer->lastUse = ++layerList->tick;
+
+	//redraw when the viewport changes size
+	GLint view[4];
+	glGetIntegerv(GL_VIEWPORT, view);
+	if(view[2] != layer->viewW || view[3] != layer->viewH)
+	{
+		layer->valid = 0;
+	}
+
+	//kept texture is good
+	if(layer->valid && layer->texture != 0)
+	{
+		return 0;
+	}
+
+	//get a texture, otherwise draw straight to the screen
+	glGetIntegerv(BL_GL_FRAMEBUFFER_BINDING, &layerList->prevFbo);
+	if(BLHelperMakeTexture(layer) == 0)
+	{
+		layer->valid = 0;
+		return 1;
+	}
+
+	//keep draw order, then save state
+	BLIFlushBatch( );
+	layerList->prevView[0] = view[0];
+	layerList->prevView[1] = view[1];
+	layerList->prevView[2] = view[2];
+	layerList->prevView[3] = view[3];
+	glGetFloatv(GL_COLOR_CLEAR_VALUE, layerList->prevClear);
+	layerList->prevHasClip = BLGetClipRect(&layerList->prevClip);
+	if(layerList->prevHasClip)
+	{
+		BLClearClipRect( );
+	}
+
+	//draw into the texture, shifted so the bounds land at 0, 0
+	layerList->bindFramebuffer(BL_GL_FRAMEBUFFER, layer->fbo);
+	glViewport(-layer->bounds.X, -layer->bounds.Y, view[2], view[3]);
+	glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+	glClear(GL_COLOR_BUFFER_BIT);
+	BLSetBlendHook(BLHelperLayerBlend);
+
+	layer->viewW       = view[2];
+	layer->viewH       = view[3];
+	layerList->active  = lHndl;
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLIEndLayer
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayerHandle lHndl -> layer being drawn
+* RETURNS:
+*	void
+* NOTE:
+*	Restores the screen as the render target
+*************************************************************/
+void BLIEndLayer(BLILayerHandle lHndl)
+{
+	//drawn straight to the screen
+	BLLayer* layer = BLHelperGetLayer(lHndl);
+	if(layer == NULL || layerList->active != lHndl)
+	{
+		return;
+	}
+
+	//finish drawing into the texture
+	BLIFlushBatch( );
+
+	//restore state
+	BLSetBlendHook(NULL);
+	layerList->bindFramebuffer(BL_GL_FRAMEBUFFER, (GLuint)layerList->prevFbo);
+	glViewport(layerList->prevView[0], layerList->prevView[1], layerList->prevView[2], layerList->prevView[3]);
+	glClearColor(layerList->prevClear[0], layerList->prevClear[1], layerList->prevClear[2], layerList->prevClear[3]);
+	if(layerList->prevHasClip)
+	{
+		BLSetClipRect(layerList->prevClip);
+	}
+
+	layer->valid      = 1;
+	layerList->active = BL_ILAYER_ERRHANDLE;
+	layerList->stats.renders++;
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLIRenderLayer
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayerHandle lHndl -> layer to draw
+* RETURNS:
+*	void
+* NOTE:
+*	Draws the layer as a single textured quad (batched).
+*	The texture holds premultiplied colors, so see-through
+*	panels look the same as when drawn straight to the screen
+*************************************************************/
+void BLIRenderLayer(BLILayerHandle lHndl)
+{
+	//nothing kept (contents went straight to the screen)
+	BLLayer* layer = BLHelperGetLayer(lHndl);
+	if(layer == NULL || layer->valid == 0 || layer->texture == 0 || layerList->active == lHndl)
+	{
+		return;
+	}
+
+	//texture rows start at the bottom, same as screenspace
+	//drawn on its own, only this quad uses the premultiplied blend
+	BLIFlushBatch( );
+	BLSetBlendHook(BLHelperCompositeBlend);
+	BLIBatchQuad((BLTextureHandle)layer->texture, 0, layer->bounds, BLCreateRect(0.0f, 0.0f, 1.0f, 1.0f), BLCreateColor(0xff, 0xff, 0xff, 0xff));
+	BLIFlushBatch( );
+	BLSetBlendHook((layerList->active != BL_ILAYER_ERRHANDLE) ? BLHelperLayerBlend : NULL);
+
+	layer->lastUse = ++layerList->tick;
+	layerList->stats.composites++;
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLIGetLayerStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLILayerStats of the layers
+* NOTE: N/A
+*************************************************************/
+BLILayerStats BLIGetLayerStats( )
+{
+	//check if init
+	if(layerList == NULL)
+	{
+		BLILayerStats empty = { 0 };
+		return empty;
+	}
+
+	return layerList->stats;
+}
+
+/*************************************************************
+* NAME: BLIResetLayerStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Zeros renders, composites and evictions
+*************************************************************/
+void BLIResetLayerStats( )
+{
+	if(layerList != NULL)
+	{
+		layerList->stats.renders    = 0;
+		layerList->stats.composites = 0;
+		layerList->stats.evictions  = 0;
+	}
+	return;
+}
\ No newline at end of file
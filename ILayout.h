@@ -0,0 +1,269 @@
+#ifndef __ILAYOUT_INCLUDE__
+#define __ILAYOUT_INCLUDE__
+
+
+/*************************************************************
+* FILE: ILayout.h
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Row and column layout tree for IBlocks widgets
+* CONTENTS:
+*	- Includes
+*	- Defs
+*	- Enums
+*	- Structs
+*	- Functions
+*
+*************************************************************/
+
+#include "ICore.h"
+#include "IBlocks.h" // For placing blocks
+
+#define BL_ILAYOUT_NODE_START 0x100      // starting node buffer size
+#define BL_ILAYOUT_NONE       0xFFFFFFFF // index for no node
+
+/*************************************************************
+* NAME: BL_ILAYOUT_DIR
+* DATE: 2026 - 10 - 19
+* NOTE: This enum is for which way a node's children are
+* placed
+*************************************************************/
+enum BL_ILAYOUT_DIR
+{
+	BL_ILAYOUT_DIR_ROW    = 0, // left to right
+	BL_ILAYOUT_DIR_COLUMN = 1  // top to bottom
+};
+
+/*************************************************************
+* NAME: BL_ILAYOUT_ALIGN
+* DATE: 2026 - 10 - 19
+* NOTE: This enum is for where children sit along an axis.
+* STRETCH is only for the cross axis, SPACE_BETWEEN only for
+* the main axis
+*************************************************************/
+enum BL_ILAYOUT_ALIGN
+{
+	BL_ILAYOUT_ALIGN_START         = 0,
+	BL_ILAYOUT_ALIGN_CENTER        = 1,
+	BL_ILAYOUT_ALIGN_END           = 2,
+	BL_ILAYOUT_ALIGN_STRETCH       = 3,
+	BL_ILAYOUT_ALIGN_SPACE_BETWEEN = 4
+};
+
+/*************************************************************
+* NAME: BLILayoutStyle
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	enum BL_ILAYOUT_DIR dir -> which way children are placed
+*	enum BL_ILAYOUT_ALIGN justify -> children along dir
+*	enum BL_ILAYOUT_ALIGN align   -> children across dir
+*	BLInt padding -> space inside the node's edges (pixels)
+*	BLInt gap     -> space between children (pixels)
+*	BLInt W       -> width before growing or shrinking
+*	BLInt H       -> height before growing or shrinking
+*	float grow    -> share of the parent's leftover space
+*	float shrink  -> share of the parent's overflow to give up
+*	(weighted by size)
+* NOTE: N/A
+*************************************************************/
+typedef struct BLILayoutStyle
+{
+	enum BL_ILAYOUT_DIR   dir;
+	enum BL_ILAYOUT_ALIGN justify;
+	enum BL_ILAYOUT_ALIGN align;
+	BLInt                 padding;
+	BLInt                 gap;
+	BLInt                 W;
+	BLInt                 H;
+	float                 grow;
+	float                 shrink;
+}BLILayoutStyle;
+
+/*************************************************************
+* NAME: BLILayout
+* DATE: 2026 - 10 - 19
+* NOTE:
+*	Members are private to ILayoutSource.c. Create with
+*	BLICreateLayout, free with BLIDestroyLayout
+*************************************************************/
+typedef struct BLILayout BLILayout;
+
+/*************************************************************
+* NAME: BLICreateLayoutStyle
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	enum BL_ILAYOUT_DIR dir -> which way children are placed
+*	BLInt W -> width before growing or shrinking
+*	BLInt H -> height before growing or shrinking
+*	float grow -> share of the parent's leftover space
+* RETURNS:
+*	BLILayoutStyle created from params
+* NOTE:
+*	Children start at the top left and stretch across, with
+*	no padding or gap. shrink is 1
+*************************************************************/
+BLILayoutStyle BLICreateLayoutStyle(enum BL_ILAYOUT_DIR dir, BLInt W, BLInt H, float grow);
+
+/*************************************************************
+* NAME: BLICreateLayout
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt capacity -> nodes to make room for, 0 for
+*	BL_ILAYOUT_NODE_START
+* RETURNS:
+*	BLILayout* created (empty), NULL for failure
+* NOTE: N/A
+*************************************************************/
+BLILayout* BLICreateLayout(BLUInt capacity);
+
+/*************************************************************
+* NAME: BLIDestroyLayout
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayout* layout -> layout to free
+* RETURNS:
+*	void
+* NOTE: N/A
+*************************************************************/
+void BLIDestroyLayout(BLILayout* layout);
+
+/*************************************************************
+* NAME: BLILayoutClear
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayout* layout -> layout to empty
+* RETURNS:
+*	void
+* NOTE:
+*	Throws out every node, memory is kept
+*************************************************************/
+void BLILayoutClear(BLILayout* layout);
+
+/*************************************************************
+* NAME: BLILayoutAddNode
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayout* layout -> layout to add to
+*	BLUInt parent -> parent node, BL_ILAYOUT_NONE for a root
+*	const BLILayoutStyle* style -> style of the node
+* RETURNS:
+*	BLUInt index of the node, BL_ILAYOUT_NONE for failure
+* NOTE:
+*	Children are placed in the order they're added. A root
+*	is placed with BLILayoutSetRootRect
+*************************************************************/
+BLUInt BLILayoutAddNode(BLILayout* layout, BLUInt parent, const BLILayoutStyle* style);
+
+/*************************************************************
+* NAME: BLILayoutSetStyle
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayout* layout -> layout to edit
+*	BLUInt node -> node to edit
+*	const BLILayoutStyle* style -> new style
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	Only the parent's children and the node's own subtree are
+*	laid out again, and only if the style changed
+*************************************************************/
+int BLILayoutSetStyle(BLILayout* layout, BLUInt node, const BLILayoutStyle* style);
+
+/*************************************************************
+* NAME: BLILayoutGetStyle
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLILayout* layout -> layout to read
+*	BLUInt node -> node to read
+* RETURNS:
+*	const BLILayoutStyle* of the node, NULL for failure
+* NOTE: N/A
+*************************************************************/
+const BLILayoutStyle* BLILayoutGetStyle(const BLILayout* layout, BLUInt node);
+
+/*************************************************************
+* NAME: BLILayoutSetRootRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayout* layout -> layout to edit
+*	BLUInt node -> root node to place
+*	BLRecti rect -> screenspace rect of the root
+* RETURNS:
+*	int, 1 for success, 0 for failure (not a root)
+* NOTE:
+*	Pass the viewport here when it resizes, nothing else in
+*	the layout reads it
+*************************************************************/
+int BLILayoutSetRootRect(BLILayout* layout, BLUInt node, BLRecti rect);
+
+/*************************************************************
+* NAME: BLILayoutSetBlock
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayout* layout -> layout to edit
+*	BLUInt node -> node to edit
+*	BLBlockHandle handle -> block placed at the node's rect,
+*	BL_BLOCK_HANDLE_NONE for none
+* RETURNS:
+*	void
+* NOTE: N/A
+*************************************************************/
+void BLILayoutSetBlock(BLILayout* layout, BLUInt node, BLBlockHandle handle);
+
+/*************************************************************
+* NAME: BLILayoutUpdate
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayout* layout -> layout to compute
+* RETURNS:
+*	BLUInt amount of nodes placed
+* NOTE:
+*	Nodes are kept parent first, so one pass over the flat
+*	arrays places every node. Only children of changed nodes
+*	are placed again, subtrees whose rect didn't move are
+*	skipped
+*************************************************************/
+BLUInt BLILayoutUpdate(BLILayout* layout);
+
+/*************************************************************
+* NAME: BLILayoutGetRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLILayout* layout -> layout to read
+*	BLUInt node -> node to read
+* RETURNS:
+*	BLRecti of the node from the last update
+* NOTE: N/A
+*************************************************************/
+BLRecti BLILayoutGetRect(const BLILayout* layout, BLUInt node);
+
+/*************************************************************
+* NAME: BLILayoutGetRects
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLILayout* layout -> layout to read
+*	BLUInt* count -> set to the amount of nodes
+* RETURNS:
+*	const BLRecti* rect of every node, by index
+* NOTE:
+*	Good until the next add
+*************************************************************/
+const BLRecti* BLILayoutGetRects(const BLILayout* layout, BLUInt* count);
+
+/*************************************************************
+* NAME: BLILayoutApplyBlocks
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayout* layout -> layout to read
+*	BLBlockStore* store -> store holding the nodes' blocks
+* RETURNS:
+*	void
+* NOTE:
+*	Only nodes that moved since the last apply set their
+*	block's dims
+*************************************************************/
+void BLILayoutApplyBlocks(BLILayout* layout, BLBlockStore* store);
+
+
+#endif
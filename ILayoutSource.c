@@ -0,0 +1,703 @@
+/*************************************************************
+* FILE: ILayoutSource.c
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Source file for the layout tree
+* CONTENTS:
+*	- Includes
+*	- Backend struct defs
+*	- File-Specifc functions
+*	- Functions
+*
+*************************************************************/
+
+#include <stdio.h>   // I/O
+#include <stdlib.h>  // For memory management
+#include <string.h>  // For style compares
+#include <math.h>    // For rounding
+
+#include "ILayout.h" // Header
+
+/*************************************************************
+* NAME: BLILayout
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLUInt count -> amount of nodes
+*	BLUInt cap   -> size of every node array
+*	BLILayoutStyle* styles -> style of each node
+*	BLRecti* rects   -> placed rect of each node
+*	BLUInt* parents  -> parent of each node
+*	BLUInt* firstChildren -> first child of each node
+*	BLUInt* lastChildren  -> last child of each node
+*	BLUInt* nextSiblings  -> next child of the same parent
+*	BLBlockHandle* blocks -> block placed at each node
+*	BLByte* dirty -> 1 if a node's children must be placed
+*	BLByte* moved -> 1 if a node's rect changed since the last
+*	apply
+*	BLUInt dirtyMin -> lowest dirty node
+* NOTE:
+*	Children are always added after their parent, so index
+*	order is parent first
+*************************************************************/
+struct BLILayout
+{
+	BLUInt          count;
+	BLUInt          cap;
+	BLILayoutStyle* styles;
+	BLRecti*        rects;
+	BLUInt*         parents;
+	BLUInt*         firstChildren;
+	BLUInt*         lastChildren;
+	BLUInt*         nextSiblings;
+	BLBlockHandle*  blocks;
+	BLByte*         dirty;
+	BLByte*         moved;
+	BLUInt          dirtyMin;
+};
+
+/*************************************************************
+* NAME: BLHelperGrowArray
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	void** array -> array to grow
+*	BLUInt cap   -> new capacity (in elements)
+*	size_t elemSize -> size of each element
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static int BLHelperGrowArray(void** array, BLUInt cap, size_t elemSize)
+{
+	void* newArray = realloc(*array, (size_t)cap * elemSize);
+	if(newArray == NULL)
+	{
+		fprintf(stderr, "ILayout: memory err\n");
+		return 0;
+	}
+	*array = newArray;
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLHelperGrowLayout
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayout* layout -> layout to grow
+*	BLUInt need -> nodes needed
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Doubles every node array until need fits
+*************************************************************/
+static int BLHelperGrowLayout(BLILayout* layout, BLUInt need)
+{
+	//check if big enough
+	if(need <= layout->cap)
+	{
+		return 1;
+	}
+
+	//get new size
+	BLUInt newCap = (layout->cap > 0) ? layout->cap : BL_ILAYOUT_NODE_START;
+	while(newCap < need)
+	{
+		newCap *= 2;
+	}
+
+	//reallocate every array
+	if(BLHelperGrowArray((void**)&layout->styles,        newCap, sizeof(BLILayoutStyle)) == 0 ||
+	   BLHelperGrowArray((void**)&layout->rects,         newCap, sizeof(BLRecti))        == 0 ||
+	   BLHelperGrowArray((void**)&layout->parents,       newCap, sizeof(BLUInt))         == 0 ||
+	   BLHelperGrowArray((void**)&layout->firstChildren, newCap, sizeof(BLUInt))         == 0 ||
+	   BLHelperGrowArray((void**)&layout->lastChildren,  newCap, sizeof(BLUInt))         == 0 ||
+	   BLHelperGrowArray((void**)&layout->nextSiblings,  newCap, sizeof(BLUInt))         == 0 ||
+	   BLHelperGrowArray((void**)&layout->blocks,        newCap, sizeof(BLBlockHandle))  == 0 ||
+	   BLHelperGrowArray((void**)&layout->dirty,         newCap, sizeof(BLByte))         == 0 ||
+	   BLHelperGrowArray((void**)&layout->moved,         newCap, sizeof(BLByte))         == 0)
+	{
+		return 0;
+	}
+	layout->cap = newCap;
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLHelperMarkDirty
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayout* layout -> layout to edit
+*	BLUInt node -> node whose children must be placed
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline void BLHelperMarkDirty(BLILayout* layout, BLUInt node)
+{
+	layout->dirty[node] = 1;
+	if(node < layout->dirtyMin)
+	{
+		layout->dirtyMin = node;
+	}
+}
+
+/*************************************************************
+* NAME: BLHelperRound
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	float value -> value to round
+* RETURNS:
+*	BLInt nearest to value
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline BLInt BLHelperRound(float value)
+{
+	return (BLInt)floorf(value + 0.5f);
+}
+
+/*************************************************************
+* NAME: BLHelperPlaceChildren
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayout* layout -> layout to edit
+*	BLUInt parent -> node whose children are placed
+* RETURNS:
+*	BLUInt amount of children placed
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Children that move are marked dirty, so the update pass
+*	places their children next. Edges are rounded from float
+*	positions so that grown children leave no gaps
+*************************************************************/
+static BLUInt BLHelperPlaceChildren(BLILayout* layout, BLUInt parent)
+{
+	const BLILayoutStyle* style = &layout->styles[parent];
+	const BLRecti         outer = layout->rects[parent];
+	const int             isRow = (style->dir == BL_ILAYOUT_DIR_ROW);
+
+	//space inside the padding
+	BLRecti inner = BLCreateRecti(outer.X + style->padding, outer.Y + style->padding,
+		outer.W - (style->padding * 2), outer.H - (style->padding * 2));
+	inner.W = (inner.W > 0) ? inner.W : 0;
+	inner.H = (inner.H > 0) ? inner.H : 0;
+	const float mainSize  = (float)(isRow ? inner.W : inner.H);
+	const float crossSize = (float)(isRow ? inner.H : inner.W);
+
+	//add up children
+	BLUInt count       = 0;
+	float  basisSum    = 0.0f;
+	float  growSum     = 0.0f;
+	float  shrinkSum   = 0.0f;
+	for(BLUInt child = layout->firstChildren[parent]; child != BL_ILAYOUT_NONE; child = layout->nextSiblings[child])
+	{
+		const BLILayoutStyle* cStyle = &layout->styles[child];
+		const float           basis  = (float)(isRow ? cStyle->W : cStyle->H);
+		basisSum  += basis;
+		growSum   += cStyle->grow;
+		shrinkSum += cStyle->shrink * basis;
+		count++;
+	}
+
+	//share out leftover space (or overflow)
+	const float freeSpace = mainSize - basisSum - (float)(style->gap * (BLInt)(count - 1));
+	float       leftover  = freeSpace;
+	if((freeSpace > 0.0f && growSum > 0.0f) || (freeSpace < 0.0f && shrinkSum > 0.0f))
+	{
+		leftover = 0.0f;
+	}
+
+	//place along the main axis
+	float lead  = 0.0f;
+	float extra = 0.0f;
+	switch (style->justify)
+	{
+	case BL_ILAYOUT_ALIGN_CENTER:
+		lead = leftover * 0.5f;
+		break;
+
+	case BL_ILAYOUT_ALIGN_END:
+		lead = leftover;
+		break;
+
+	case BL_ILAYOUT_ALIGN_SPACE_BETWEEN:
+		extra = (count > 1 && leftover > 0.0f) ? leftover / (float)(count - 1) : 0.0f;
+		break;
+
+	default:
+		break;
+	}
+
+	//place each child
+	float  cursor = lead;
+	BLUInt placed = 0;
+	for(BLUInt child = layout->firstChildren[parent]; child != BL_ILAYOUT_NONE; child = layout->nextSiblings[child])
+	{
+		const BLILayoutStyle* cStyle = &layout->styles[child];
+		const float           basis  = (float)(isRow ? cStyle->W : cStyle->H);
+
+		//flex main size
+		float size = basis;
+		if(freeSpace > 0.0f && growSum > 0.0f)
+		{
+			size += freeSpace * (cStyle->grow / growSum);
+		}
+		else if(freeSpace < 0.0f && shrinkSum > 0.0f)
+		{
+			size += freeSpace * ((cStyle->shrink * basis) / shrinkSum);
+		}
+		size = (size > 0.0f) ? size : 0.0f;
+
+		const BLInt mainStart = BLHelperRound(cursor);
+		const BLInt mainEnd   = BLHelperRound(cursor + size);
+		cursor += size + (float)style->gap + extra;
+
+		//cross size and offset
+		float crossLength = (float)(isRow ? cStyle->H : cStyle->W);
+		float crossOffset = 0.0f;
+		switch (style->align)
+		{
+		case BL_ILAYOUT_ALIGN_STRETCH:
+			crossLength = crossSize;
+			break;
+
+		case BL_ILAYOUT_ALIGN_CENTER:
+			crossOffset = (crossSize - crossLength) * 0.5f;
+			break;
+
+		case BL_ILAYOUT_ALIGN_END:
+			crossOffset = crossSize - crossLength;
+			break;
+
+		default:
+			break;
+		}
+		const BLInt crossStart = BLHelperRound(crossOffset);
+		const BLInt crossEnd   = BLHelperRound(crossOffset + crossLength);
+
+		//rows run left to right and start at the top, columns
+		//run top to bottom and start at the left
+		BLRecti rect;
+		if(isRow)
+		{
+			rect = BLCreateRecti(inner.X + mainStart, inner.Y + inner.H - crossEnd, mainEnd - mainStart, crossEnd - crossStart);
+		}
+		else
+		{
+			rect = BLCreateRecti(inner.X + crossStart, inner.Y + inner.H - mainEnd, crossEnd - crossStart, mainEnd - mainStart);
+		}
+
+		//only moved children need their own children placed
+		const BLRecti old = layout->rects[child];
+		if(old.X != rect.X || old.Y != rect.Y || old.W != rect.W || old.H != rect.H)
+		{
+			layout->rects[child] = rect;
+			layout->moved[child] = 1;
+			layout->dirty[child] = 1;
+		}
+		placed++;
+	}
+
+	//end
+	return placed;
+}
+
+/*************************************************************
+* NAME: BLICreateLayoutStyle
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	enum BL_ILAYOUT_DIR dir -> which way children are placed
+*	BLInt W -> width before growing or shrinking
+*	BLInt H -> height before growing or shrinking
+*	float grow -> share of the parent's leftover space
+* RETURNS:
+*	BLILayoutStyle created from params
+* NOTE:
+*	Children start at the top left and stretch across, with
+*	no padding or gap. shrink is 1
+*************************************************************/
+BLILayoutStyle BLICreateLayoutStyle(enum BL_ILAYOUT_DIR dir, BLInt W, BLInt H, float grow)
+{
+	BLILayoutStyle style;
+	memset(&style, 0, sizeof(BLILayoutStyle));
+
+	style.dir     = dir;
+	style.justify = BL_ILAYOUT_ALIGN_START;
+	style.align   = BL_ILAYOUT_ALIGN_STRETCH;
+	style.W       = W;
+	style.H       = H;
+	style.grow    = grow;
+	style.shrink  = 1.0f;
+
+	//end
+	return style;
+}
+
+/*************************************************************
+* NAME: BLICreateLayout
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt capacity -> nodes to make room for, 0 for
+*	BL_ILAYOUT_NODE_START
+* RETURNS:
+*	BLILayout* created (empty), NULL for failure
+* NOTE: N/A
+*************************************************************/
+BLILayout* BLICreateLayout(BLUInt capacity)
+{
+	BLILayout* layout = calloc(1, sizeof(BLILayout));
+	if(layout == NULL)
+	{
+		fprintf(stderr, "ILayout: memory err\n");
+		return NULL;
+	}
+
+	//make room up front
+	if(BLHelperGrowLayout(layout, (capacity > 0) ? capacity : BL_ILAYOUT_NODE_START) == 0)
+	{
+		BLIDestroyLayout(layout);
+		return NULL;
+	}
+
+	//end
+	return layout;
+}
+
+/*************************************************************
+* NAME: BLIDestroyLayout
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayout* layout -> layout to free
+* RETURNS:
+*	void
+* NOTE: N/A
+*************************************************************/
+void BLIDestroyLayout(BLILayout* layout)
+{
+	if(layout == NULL)
+	{
+		return;
+	}
+
+	free(layout->styles);
+	free(layout->rects);
+	free(layout->parents);
+	free(layout->firstChildren);
+	free(layout->lastChildren);
+	free(layout->nextSiblings);
+	free(layout->blocks);
+	free(layout->dirty);
+	free(layout->moved);
+	free(layout);
+}
+
+/*************************************************************
+* NAME: BLILayoutClear
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayout* layout -> layout to empty
+* RETURNS:
+*	void
+* NOTE:
+*	Throws out every node, memory is kept
+*************************************************************/
+void BLILayoutClear(BLILayout* layout)
+{
+	if(layout != NULL)
+	{
+		layout->count    = 0;
+		layout->dirtyMin = 0;
+	}
+}
+
+/*************************************************************
+* NAME: BLILayoutAddNode
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayout* layout -> layout to add to
+*	BLUInt parent -> parent node, BL_ILAYOUT_NONE for a root
+*	const BLILayoutStyle* style -> style of the node
+* RETURNS:
+*	BLUInt index of the node, BL_ILAYOUT_NONE for failure
+* NOTE:
+*	Children are placed in the order they're added. A root
+*	is placed with BLILayoutSetRootRect
+*************************************************************/
+BLUInt BLILayoutAddNode(BLILayout* layout, BLUInt parent, const BLILayoutStyle* style)
+{
+	if(layout == NULL || style == NULL || (parent != BL_ILAYOUT_NONE && parent >= layout->count))
+	{
+		return BL_ILAYOUT_NONE;
+	}
+	if(BLHelperGrowLayout(layout, layout->count + 1) == 0)
+	{
+		return BL_ILAYOUT_NONE;
+	}
+
+	//fill in node
+	const BLUInt node = layout->count++;
+	layout->styles[node]        = *style;
+	layout->rects[node]         = BLCreateRecti(0, 0, 0, 0);
+	layout->parents[node]       = parent;
+	layout->firstChildren[node] = BL_ILAYOUT_NONE;
+	layout->lastChildren[node]  = BL_ILAYOUT_NONE;
+	layout->nextSiblings[node]  = BL_ILAYOUT_NONE;
+	layout->blocks[node]        = BL_BLOCK_HANDLE_NONE;
+	layout->dirty[node]         = 0;
+	layout->moved[node]         = 0;
+
+	//link as last child, siblings must be placed again
+	if(parent != BL_ILAYOUT_NONE)
+	{
+		if(layout->lastChildren[parent] == BL_ILAYOUT_NONE)
+		{
+			layout->firstChildren[parent] = node;
+		}
+		else
+		{
+			layout->nextSiblings[layout->lastChildren[parent]] = node;
+		}
+		layout->lastChildren[parent] = node;
+		BLHelperMarkDirty(layout, parent);
+	}
+
+	//end
+	return node;
+}
+
+/*************************************************************
+* NAME: BLILayoutSetStyle
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayout* layout -> layout to edit
+*	BLUInt node -> node to edit
+*	const BLILayoutStyle* style -> new style
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	Only the parent's children and the node's own subtree are
+*	laid out again, and only if the style changed
+*************************************************************/
+int BLILayoutSetStyle(BLILayout* layout, BLUInt node, const BLILayoutStyle* style)
+{
+	if(layout == NULL || style == NULL || node >= layout->count)
+	{
+		return 0;
+	}
+
+	//nothing to do
+	if(memcmp(&layout->styles[node], style, sizeof(BLILayoutStyle)) == 0)
+	{
+		return 1;
+	}
+	layout->styles[node] = *style;
+
+	//size moves siblings, the rest moves children
+	if(layout->parents[node] != BL_ILAYOUT_NONE)
+	{
+		BLHelperMarkDirty(layout, layout->parents[node]);
+	}
+	BLHelperMarkDirty(layout, node);
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLILayoutGetStyle
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLILayout* layout -> layout to read
+*	BLUInt node -> node to read
+* RETURNS:
+*	const BLILayoutStyle* of the node, NULL for failure
+* NOTE: N/A
+*************************************************************/
+const BLILayoutStyle* BLILayoutGetStyle(const BLILayout* layout, BLUInt node)
+{
+	if(layout == NULL || node >= layout->count)
+	{
+		return NULL;
+	}
+	return &layout->styles[node];
+}
+
+/*************************************************************
+* NAME: BLILayoutSetRootRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayout* layout -> layout to edit
+*	BLUInt node -> root node to place
+*	BLRecti rect -> screenspace rect of the root
+* RETURNS:
+*	int, 1 for success, 0 for failure (not a root)
+* NOTE:
+*	Pass the viewport here when it resizes, nothing else in
+*	the layout reads it
+*************************************************************/
+int BLILayoutSetRootRect(BLILayout* layout, BLUInt node, BLRecti rect)
+{
+	if(layout == NULL || node >= layout->count || layout->parents[node] != BL_ILAYOUT_NONE)
+	{
+		return 0;
+	}
+
+	const BLRecti old = layout->rects[node];
+	if(old.X != rect.X || old.Y != rect.Y || old.W != rect.W || old.H != rect.H)
+	{
+		layout->rects[node] = rect;
+		layout->moved[node] = 1;
+		BLHelperMarkDirty(layout, node);
+	}
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLILayoutSetBlock
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayout* layout -> layout to edit
+*	BLUInt node -> node to edit
+*	BLBlockHandle handle -> block placed at the node's rect,
+*	BL_BLOCK_HANDLE_NONE for none
+* RETURNS:
+*	void
+* NOTE: N/A
+*************************************************************/
+void BLILayoutSetBlock(BLILayout* layout, BLUInt node, BLBlockHandle handle)
+{
+	if(layout == NULL || node >= layout->count)
+	{
+		return;
+	}
+
+	//place the new block on the next apply
+	layout->blocks[node] = handle;
+	layout->moved[node]  = 1;
+}
+
+/*************************************************************
+* NAME: BLILayoutUpdate
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayout* layout -> layout to compute
+* RETURNS:
+*	BLUInt amount of nodes placed
+* NOTE:
+*	Nodes are kept parent first, so one pass over the flat
+*	arrays places every node. Only children of changed nodes
+*	are placed again, subtrees whose rect didn't move are
+*	skipped
+*************************************************************/
+BLUInt BLILayoutUpdate(BLILayout* layout)
+{
+	if(layout == NULL)
+	{
+		return 0;
+	}
+
+	//parents come first, so children marked here are reached later
+	BLUInt placed = 0;
+	for(BLUInt i = layout->dirtyMin; i < layout->count; i++)
+	{
+		if(layout->dirty[i] == 0)
+		{
+			continue;
+		}
+		layout->dirty[i] = 0;
+
+		if(layout->firstChildren[i] != BL_ILAYOUT_NONE)
+		{
+			placed += BLHelperPlaceChildren(layout, i);
+		}
+	}
+	layout->dirtyMin = layout->count;
+
+	//end
+	return placed;
+}
+
+/*************************************************************
+* NAME: BLILayoutGetRect
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLILayout* layout -> layout to read
+*	BLUInt node -> node to read
+* RETURNS:
+*	BLRecti of the node from the last update
+* NOTE: N/A
+*************************************************************/
+BLRecti BLILayoutGetRect(const BLILayout* layout, BLUInt node)
+{
+	if(layout == NULL || node >= layout->count)
+	{
+		return BLCreateRecti(0, 0, 0, 0);
+	}
+	return layout->rects[node];
+}
+
+/*************************************************************
+* NAME: BLILayoutGetRects
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLILayout* layout -> layout to read
+*	BLUInt* count -> set to the amount of nodes
+* RETURNS:
+*	const BLRecti* rect of every node, by index
+* NOTE:
+*	Good until the next add
+*************************************************************/
+const BLRecti* BLILayoutGetRects(const BLILayout* layout, BLUInt* count)
+{
+	if(layout == NULL)
+	{
+		*count = 0;
+		return NULL;
+	}
+
+	*count = layout->count;
+	return layout->rects;
+}
+
+/*************************************************************
+* NAME: BLILayoutApplyBlocks
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLILayout* layout -> layout to read
+*	BLBlockStore* store -> store holding the nodes' blocks
+* RETURNS:
+*	void
+* NOTE:
+*	Only nodes that moved since the last apply set their
+*	block's dims
+*************************************************************/
+void BLILayoutApplyBlocks(BLILayout* layout, BLBlockStore* store)
+{
+	if(layout == NULL || store == NULL)
+	{
+		return;
+	}
+
+	for(BLUInt i = 0; i < layout->count; i++)
+	{
+		if(layout->moved[i] == 0)
+		{
+			continue;
+		}
+		layout->moved[i] = 0;
+
+		if(layout->blocks[i] != BL_BLOCK_HANDLE_NONE)
+		{
+			BLIBlockStoreSetDims(store, layout->blocks[i], layout->rects[i]);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+#ifndef __ITEXTCACHE_INCLUDE__
+#define __ITEXTCACHE_INCLUDE__
+
+
+/*************************************************************
+* FILE: ITextCache.h
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Cache for the glyph quads of static strings
+* CONTENTS:
+*	- Includes
+*	- Defs
+*	- Structs
+*	- Functions
+*
+*************************************************************/
+
+#include "ICore.h"
+
+#define BL_ITEXTCACHE_ENTRY_MAX   0x100    // max amount of cached strings
+#define BL_ITEXTCACHE_BUCKET_SIZE 0x200    // hash table size (power of 2)
+#define BL_ITEXTCACHE_DEFAULT_CAP 0x100000 // default memory cap (1MB)
+
+/*************************************************************
+* NAME: BLITextCacheStats
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLUInt hits       -> strings drawn from the cache
+*	BLUInt misses     -> strings that had to be laid out
+*	BLUInt evictions  -> entries thrown out to make space
+*	BLUInt entryCount -> strings currently cached
+*	BLUInt memUsed    -> bytes used by cached strings
+*	BLUInt memCap     -> max bytes cached strings can use
+* NOTE: N/A
+*************************************************************/
+typedef struct BLITextCacheStats
+{
+	BLUInt hits;
+	BLUInt misses;
+	BLUInt evictions;
+	BLUInt entryCount;
+	BLUInt memUsed;
+	BLUInt memCap;
+}BLITextCacheStats;
+
+/*************************************************************
+* NAME: BLInitITextCache
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt memCap -> max bytes cached strings can use
+*	(0 for BL_ITEXTCACHE_DEFAULT_CAP)
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE: N/A
+*************************************************************/
+int BLInitITextCache(BLUInt memCap);
+
+/*************************************************************
+* NAME: BLTerminateITextCache
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Frees every cached string
+*************************************************************/
+void BLTerminateITextCache( );
+
+/*************************************************************
+* NAME: BLIClearTextCache
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Throws out every cached string, stats are kept
+*************************************************************/
+void BLIClearTextCache( );
+
+/*************************************************************
+* NAME: BLIRenderStringCached
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLByte* str -> string to render
+*	BLRecti rBounds   -> bounds of the string (only X and Y are
+*	used for BL_ISTRING_LAYOUT_LINE, as the top left)
+*	BLUInt scale -> scale of each letter (in pixels)
+*	enum BL_ISTRING_LAYOUT lType -> which render function to match
+*	enum BL_GFONT_TYPE sType     -> type of font to render
+* RETURNS:
+*	int, 1 for success, 0 for string out of rect bounds
+* NOTE:
+*	Looks the same as the matching BLIRenderString* function,
+*	but the glyph quads are kept between calls. A string that
+*	was drawn before with the same params costs a single draw.
+*	Falls back to BLIRenderString* if the cache isn't init, or
+*	if the string has more glyphs than the glyph cache holds
+*************************************************************/
+int BLIRenderStringCached(const BLByte* str, BLRecti rBounds, BLUInt scale, enum BL_ISTRING_LAYOUT lType, enum BL_GFONT_TYPE sType);
+
+/*************************************************************
+* NAME: BLIGetTextCacheStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLITextCacheStats of the text cache
+* NOTE: N/A
+*************************************************************/
+BLITextCacheStats BLIGetTextCacheStats( );
+
+/*************************************************************
+* NAME: BLIResetTextCacheStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Zeros hits, misses and evictions
+*************************************************************/
+void BLIResetTextCacheStats( );
+
+#endif
@@ -0,0 +1,730 @@
+
+
+/*************************************************************
+* FILE: ITextCacheSource.c
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Source file for the static string cache
+* CONTENTS:
+*	- Includes
+*	- Backend struct defs
+*	- Backend objects
+*	- File-Specifc functions
+*	- Functions
+*
+*************************************************************/
+
+#include <stdio.h>   // I/O
+#include <stdlib.h>  // For memory management
+#include <string.h>  // For string compare and copy
+
+#include "ITextCache.h" // Header
+#include "IBatch.h"     // For drawing cached quads
+
+/*************************************************************
+* NAME: BLTextCacheEntry
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	int inUse        -> 1 if entry holds a string
+*	uint32_t hash    -> hash of the key
+*	BLByte* str      -> copy of the key string
+*	BLRecti rBounds  -> key bounds
+*	BLUInt scale     -> key scale
+*	enum BL_ISTRING_LAYOUT lType -> key layout
+*	enum BL_GFONT_TYPE sType     -> key font type
+*	enum BL_ISTRING_MODE sMode   -> key string mode
+*	const BLBitmapFont* font     -> key bitmap font
+*	BLGlyphCache* gCache  -> key glyph cache
+*	BLUInt gEpoch         -> glyph cache evictions when built
+*	BLTextureHandle atlas -> atlas the quads draw from
+*	int fits         -> return value of the layout
+*	BLIVertex* verts -> glyph quads
+*	BLUInt vertCount -> amount of verts
+*	BLRecti inkBounds -> bounds of every quad (for culling)
+*	BLUInt memSize   -> bytes used by str and verts
+*	BLInt bucketNext -> next entry in the same bucket
+*	BLInt lruPrev    -> more recently used entry
+*	BLInt lruNext    -> less recently used entry
+* NOTE: File specific struct
+*************************************************************/
+typedef struct BLTextCacheEntry
+{
+	int                    inUse;
+	uint32_t               hash;
+	BLByte*                str;
+	BLRecti                rBounds;
+	BLUInt                 scale;
+	enum BL_ISTRING_LAYOUT lType;
+	enum BL_GFONT_TYPE     sType;
+	enum BL_ISTRING_MODE   sMode;
+	const BLBitmapFont*    font;
+	BLGlyphCache*          gCache;
+	BLUInt                 gEpoch;
+	BLTextureHandle        atlas;
+	int                    fits;
+	BLIVertex*             verts;
+	BLUInt                 vertCount;
+	BLRecti                inkBounds;
+	BLUInt                 memSize;
+	BLInt                  bucketNext;
+	BLInt                  lruPrev;
+	BLInt                  lruNext;
+}BLTextCacheEntry;
+
+/*************************************************************
+* NAME: BLTextCache
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLTextCacheEntry entries[] -> every entry
+*	BLInt buckets[] -> first entry of each hash bucket
+*	BLInt lruHead   -> most recently used entry
+*	BLInt lruTail   -> least recently used entry
+*	BLITextCacheStats stats -> counters
+*	BLIGlyph* gBuf  -> scratch buffer for layouts
+*	BLUInt gBufSize -> size of gBuf
+* NOTE: File specific struct, there should only be one
+* instance of this struct at ALL times
+*************************************************************/
+typedef struct BLTextCache
+{
+	BLTextCacheEntry  entries[BL_ITEXTCACHE_ENTRY_MAX];
+	BLInt             buckets[BL_ITEXTCACHE_BUCKET_SIZE];
+	BLInt             lruHead;
+	BLInt             lruTail;
+	BLITextCacheStats stats;
+	BLIGlyph*         gBuf;
+	BLUInt            gBufSize;
+}BLTextCache;
+
+/*************************************************************
+* NAME: textCache (object)
+* DATE: 2026 - 10 - 19
+* USE:
+*	This is an instance of the BLTextCache struct used to hold
+*	every cached string
+* NOTE: N/A
+*************************************************************/
+static BLTextCache* textCache = NULL;
+
+/*************************************************************
+* NAME: BLHelperHashKey
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLByte* str -> key string
+*	BLRecti rBounds   -> key bounds
+*	BLUInt scale      -> key scale
+*	enum BL_ISTRING_LAYOUT lType -> key layout
+*	enum BL_GFONT_TYPE sType     -> key font type
+*	enum BL_ISTRING_MODE sMode   -> key string mode
+* RETURNS:
+*	uint32_t hash of the key (FNV-1a)
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static uint32_t BLHelperHashKey(const BLByte* str, BLRecti rBounds, BLUInt scale, enum BL_ISTRING_LAYOUT lType, enum BL_GFONT_TYPE sType, enum BL_ISTRING_MODE sMode)
+{
+	//hash string
+	uint32_t hash = 2166136261u;
+	for(int i = 0; str[i] != 0; i++)
+	{
+		hash = (hash ^ str[i]) * 16777619u;
+	}
+
+	//hash params
+	const uint32_t params[8] = { (uint32_t)rBounds.X, (uint32_t)rBounds.Y, (uint32_t)rBounds.W,
+		(uint32_t)rBounds.H, scale, (uint32_t)lType, (uint32_t)sType, (uint32_t)sMode };
+	for(int i = 0; i < 8; i++)
+	{
+		for(int j = 0; j < 4; j++)
+		{
+			hash = (hash ^ ((params[i] >> (j * 8)) & 0xff)) * 16777619u;
+		}
+	}
+
+	//end
+	return hash;
+}
+
+/*************************************************************
+* NAME: BLHelperLRUUnlink
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLInt index -> entry to take out of the LRU list
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline void BLHelperLRUUnlink(BLInt index)
+{
+	BLTextCacheEntry* entry = &textCache->entries[index];
+
+	//relink neighbours
+	if(entry->lruPrev != -1)
+	{
+		textCache->entries[entry->lruPrev].lruNext = entry->lruNext;
+	}
+	else
+	{
+		textCache->lruHead = entry->lruNext;
+	}
+
+	if(entry->lruNext != -1)
+	{
+		textCache->entries[entry->lruNext].lruPrev = entry->lruPrev;
+	}
+	else
+	{
+		textCache->lruTail = entry->lruPrev;
+	}
+
+	//end
+	entry->lruPrev = -1;
+	entry->lruNext = -1;
+	return;
+}
+
+/*************************************************************
+* NAME: BLHelperLRUPushFront
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLInt index -> entry to mark as most recently used
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Entry must NOT be in the LRU list
+*************************************************************/
+static inline void BLHelperLRUPushFront(BLInt index)
+{
+	BLTextCacheEntry* entry = &textCache->entries[index];
+
+	//link in front of head
+	entry->lruPrev = -1;
+	entry->lruNext = textCache->lruHead;
+
+	if(textCache->lruHead != -1)
+	{
+		textCache->entries[textCache->lruHead].lruPrev = index;
+	}
+	else
+	{
+		textCache->lruTail = index;
+	}
+
+	//end
+	textCache->lruHead = index;
+	return;
+}
+
+/*************************************************************
+* NAME: BLHelperEvictEntry
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLInt index -> entry to throw out
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static void BLHelperEvictEntry(BLInt index)
+{
+	BLTextCacheEntry* entry = &textCache->entries[index];
+
+	//take out of bucket chain
+	BLInt* link = &textCache->buckets[entry->hash & (BL_ITEXTCACHE_BUCKET_SIZE - 1)];
+	while(*link != -1)
+	{
+		if(*link == index)
+		{
+			*link = entry->bucketNext;
+			break;
+		}
+		link = &textCache->entries[*link].bucketNext;
+	}
+
+	//take out of LRU list
+	BLHelperLRUUnlink(index);
+
+	//free memory
+	textCache->stats.memUsed -= entry->memSize;
+	textCache->stats.entryCount--;
+	free(entry->str);
+	free(entry->verts);
+
+	//end
+	memset(entry, 0, sizeof(BLTextCacheEntry));
+	entry->bucketNext = -1;
+	entry->lruPrev    = -1;
+	entry->lruNext    = -1;
+	return;
+}
+
+/*************************************************************
+* NAME: BLHelperRenderUncached
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLByte* str -> string to render
+*	BLRecti rBounds   -> bounds of the string
+*	BLUInt scale -> scale of each letter (in pixels)
+*	enum BL_ISTRING_LAYOUT lType -> which render function to use
+*	enum BL_GFONT_TYPE sType     -> type of font to render
+* RETURNS:
+*	int, 1 for success, 0 for string out of rect bounds
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static int BLHelperRenderUncached(const BLByte* str, BLRecti rBounds, BLUInt scale, enum BL_ISTRING_LAYOUT lType, enum BL_GFONT_TYPE sType)
+{
+	switch (lType)
+	{
+	case BL_ISTRING_LAYOUT_LINE:
+
+		BLIRenderString(str, (BLUInt)rBounds.X, (BLUInt)rBounds.Y, scale, sType);
+		return 1;
+
+	case BL_ISTRING_LAYOUT_CENTERED:
+
+		BLIRenderStringCentered(str, rBounds, scale, sType);
+		return 1;
+
+	case BL_ISTRING_LAYOUT_RECT:
+
+		return BLIRenderStringRect(str, rBounds, scale, sType);
+
+	default:
+		break;
+	}
+
+	//end
+	return 0;
+}
+
+/*************************************************************
+* NAME: BLHelperDrawEntry
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLTextCacheEntry* entry -> entry to draw
+*	int alphaTest -> 1 to cut at half alpha (distance fields)
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Entries fully outside of the visible rect are culled whole
+*************************************************************/
+static void BLHelperDrawEntry(const BLTextCacheEntry* entry, int alphaTest)
+{
+	//cull
+	const BLRect  visible = BLGetVisibleRect( );
+	const BLRecti ink     = entry->inkBounds;
+	if((float)(ink.X + ink.W) <= visible.X || (float)ink.X >= visible.X + visible.width ||
+		(float)(ink.Y + ink.H) <= visible.Y || (float)ink.Y >= visible.Y + visible.height)
+	{
+		BLAddCullStats(0, entry->vertCount / 4, 0);
+		return;
+	}
+
+	//draw
+	BLIBatchVerts(entry->atlas, alphaTest, entry->verts, entry->vertCount);
+	BLISubmitBatch( );
+	BLAddCullStats(entry->vertCount / 4, 0, 0);
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLInitITextCache
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt memCap -> max bytes cached strings can use
+*	(0 for BL_ITEXTCACHE_DEFAULT_CAP)
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE: N/A
+*************************************************************/
+int BLInitITextCache(BLUInt memCap)
+{
+	//see if already init
+	if(textCache != NULL)
+	{
+		fprintf(stderr, "ITextCache already init!\n");
+		return 0;
+	}
+
+	//init textCache
+	textCache = calloc(1, sizeof(BLTextCache));
+
+	//check if null
+	if(textCache == NULL)
+	{
+		fprintf(stderr, "Cannot Init ITextCache: memory err\n");
+		return 0;
+	}
+
+	//empty links
+	for(int i = 0; i < BL_ITEXTCACHE_BUCKET_SIZE; i++)
+	{
+		textCache->buckets[i] = -1;
+	}
+	for(int i = 0; i < BL_ITEXTCACHE_ENTRY_MAX; i++)
+	{
+		textCache->entries[i].bucketNext = -1;
+		textCache->entries[i].lruPrev    = -1;
+		textCache->entries[i].lruNext    = -1;
+	}
+	textCache->lruHead = -1;
+	textCache->lruTail = -1;
+
+	//set cap
+	textCache->stats.memCap = (memCap == 0) ? BL_ITEXTCACHE_DEFAULT_CAP : memCap;
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLTerminateITextCache
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Frees every cached string
+*************************************************************/
+void BLTerminateITextCache( )
+{
+	//check if init
+	if(textCache == NULL)
+	{
+		return;
+	}
+
+	//free entries
+	BLIClearTextCache( );
+
+	//free textCache
+	free(textCache->gBuf);
+	free(textCache);
+	textCache = NULL;
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLIClearTextCache
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Throws out every cached string, stats are kept
+*************************************************************/
+void BLIClearTextCache( )
+{
+	//check if init
+	if(textCache == NULL)
+	{
+		return;
+	}
+
+	//evict everything (doesn't count as evictions)
+	while(textCache->lruTail != -1)
+	{
+		BLHelperEvictEntry(textCache->lruTail);
+	}
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLIRenderStringCached
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLByte* str -> string to render
+*	BLRecti rBounds   -> bounds of the string (only X and Y are
+*	used for BL_ISTRING_LAYOUT_LINE, as the top left)
+*	BLUInt scale -> scale of each letter (in pixels)
+*	enum BL_ISTRING_LAYOUT lType -> which render function to match
+*	enum BL_GFONT_TYPE sType     -> type of font to render
+* RETURNS:
+*	int, 1 for success, 0 for string out of rect bounds
+* NOTE:
+*	Looks the same as the matching BLIRenderString* function,
+*	but the glyph quads are kept between calls. A string that
+*	was drawn before with the same params costs a single draw.
+*	Falls back to BLIRenderString* if the cache isn't init, or
+*	if the string has more glyphs than the glyph cache holds
+*************************************************************/
+int BLIRenderStringCached(const BLByte* str, BLRecti rBounds, BLUInt scale, enum BL_ISTRING_LAYOUT lType, enum BL_GFONT_TYPE sType)
+{
+	//check if init
+	if(textCache == NULL)
+	{
+		return BLHelperRenderUncached(str, rBounds, scale, lType, sType);
+	}
+
+	//a line only depends on its top left
+	if(lType == BL_ISTRING_LAYOUT_LINE)
+	{
+		rBounds.W = 0;
+		rBounds.H = 0;
+	}
+
+	//look up key
+	const enum BL_ISTRING_MODE sMode = BLIGetStringMode( );
+	const BLBitmapFont*        font  = BLIGetBitmapFont( );
+	BLGlyphCache*              gCache = BLIGetGlyphCache( );
+	if(font == NULL || (gCache != NULL && BLGetGlyphCacheFont(gCache) != font))
+	{
+		gCache = NULL;
+	}
+	const uint32_t hash = BLHelperHashKey(str, rBounds, scale, lType, sType, sMode);
+	BLInt index = textCache->buckets[hash & (BL_ITEXTCACHE_BUCKET_SIZE - 1)];
+
+	while(index != -1)
+	{
+		BLTextCacheEntry* entry = &textCache->entries[index];
+
+		//check for full match
+		if(entry->hash == hash && entry->scale == scale && entry->lType == lType && entry->sType == sType && entry->sMode == sMode && entry->font == font && entry->gCache == gCache &&
+			entry->rBounds.X == rBounds.X && entry->rBounds.Y == rBounds.Y &&
+			entry->rBounds.W == rBounds.W && entry->rBounds.H == rBounds.H &&
+			strcmp((const char*)entry->str, (const char*)str) == 0)
+		{
+			//glyphs moved in the glyph cache, lay out again
+			if(gCache != NULL && BLGetGlyphCacheStats(gCache).evictions != entry->gEpoch)
+			{
+				BLHelperEvictEntry(index);
+				break;
+			}
+
+			//hit, mark as most recently used and draw
+			textCache->stats.hits++;
+			BLHelperLRUUnlink(index);
+			BLHelperLRUPushFront(index);
+			BLHelperDrawEntry(entry, font == NULL && sMode == BL_ISTRING_MODE_SDF);
+			return entry->fits;
+		}
+
+		index = entry->bucketNext;
+	}
+
+	//miss
+	textCache->stats.misses++;
+
+	//layout into scratch buffer (grow if too small)
+	int fits = 1;
+	BLUInt gCount = BLILayoutString(str, rBounds, scale, lType, textCache->gBuf, textCache->gBufSize, &fits);
+	if(gCount > textCache->gBufSize)
+	{
+		BLIGlyph* newBuf = realloc(textCache->gBuf, gCount * sizeof(BLIGlyph));
+		if(newBuf == NULL)
+		{
+			fprintf(stderr, "ITextCache: memory err\n");
+			return BLHelperRenderUncached(str, rBounds, scale, lType, sType);
+		}
+
+		textCache->gBuf     = newBuf;
+		textCache->gBufSize = gCount;
+		BLILayoutString(str, rBounds, scale, lType, textCache->gBuf, textCache->gBufSize, &fits);
+	}
+
+	//uvs are only good if nothing is evicted while building
+	const BLUInt gEpoch = (gCache != NULL) ? BLGetGlyphCacheStats(gCache).evictions : 0;
+
+	//count visible glyphs (empty glyphs like space need no quad)
+	BLUInt quadCount = 0;
+	BLRect uv;
+	for(BLUInt i = 0; i < gCount; i++)
+	{
+		BLIGetGlyphAtlas(textCache->gBuf[i].codepoint, &uv);
+		if(uv.width != 0)
+		{
+			quadCount++;
+		}
+	}
+
+	//get memory needed
+	const BLUInt strSize = (BLUInt)strlen((const char*)str) + 1;
+	const BLUInt memSize = strSize + (quadCount * 4 * sizeof(BLIVertex));
+
+	//too big to ever cache
+	if(memSize > textCache->stats.memCap)
+	{
+		return BLHelperRenderUncached(str, rBounds, scale, lType, sType);
+	}
+
+	//evict until there is space and a free entry
+	while(textCache->stats.memUsed + memSize > textCache->stats.memCap ||
+		textCache->stats.entryCount >= BL_ITEXTCACHE_ENTRY_MAX)
+	{
+		BLHelperEvictEntry(textCache->lruTail);
+		textCache->stats.evictions++;
+	}
+
+	//find free entry
+	BLInt newIndex = 0;
+	while(textCache->entries[newIndex].inUse)
+	{
+		newIndex++;
+	}
+	BLTextCacheEntry* entry = &textCache->entries[newIndex];
+
+	//allocate
+	entry->str   = malloc(strSize);
+	entry->verts = malloc((quadCount * 4 * sizeof(BLIVertex)) + 1);
+	if(entry->str == NULL || entry->verts == NULL)
+	{
+		fprintf(stderr, "ITextCache: memory err\n");
+		free(entry->str);
+		free(entry->verts);
+		entry->str   = NULL;
+		entry->verts = NULL;
+		return BLHelperRenderUncached(str, rBounds, scale, lType, sType);
+	}
+
+	//build quads
+	const BLColor sColor = BLGetFontColor(sType);
+	BLUInt vIndex = 0;
+	BLInt  inkMinX = 0, inkMinY = 0, inkMaxX = 0, inkMaxY = 0;
+	entry->atlas  = 0;
+	for(BLUInt i = 0; i < gCount; i++)
+	{
+		const BLIGlyph glyph = textCache->gBuf[i];
+		const BLTextureHandle atlas = BLIGetGlyphAtlas(glyph.codepoint, &uv);
+		if(uv.width == 0)
+		{
+			continue;
+		}
+		entry->atlas = atlas;
+
+		//grow ink bounds
+		if(vIndex == 0 || glyph.bounds.X < inkMinX)
+		{
+			inkMinX = glyph.bounds.X;
+		}
+		if(vIndex == 0 || glyph.bounds.Y < inkMinY)
+		{
+			inkMinY = glyph.bounds.Y;
+		}
+		if(vIndex == 0 || glyph.bounds.X + glyph.bounds.W > inkMaxX)
+		{
+			inkMaxX = glyph.bounds.X + glyph.bounds.W;
+		}
+		if(vIndex == 0 || glyph.bounds.Y + glyph.bounds.H > inkMaxY)
+		{
+			inkMaxY = glyph.bounds.Y + glyph.bounds.H;
+		}
+
+		//precalculate coords
+		const float   bX = (float)glyph.bounds.X;
+		const float   bY = (float)glyph.bounds.Y;
+		const float   tX = (float)(glyph.bounds.X + glyph.bounds.W);
+		const float   tY = (float)(glyph.bounds.Y + glyph.bounds.H);
+		BLIVertex* quad = &entry->verts[vIndex];
+
+		quad[0] = (BLIVertex){ bX, bY, uv.X,            uv.Y,             sColor }; //bottom left
+		quad[1] = (BLIVertex){ bX, tY, uv.X,            uv.Y + uv.height, sColor }; //top left
+		quad[2] = (BLIVertex){ tX, tY, uv.X + uv.width, uv.Y + uv.height, sColor }; //top right
+		quad[3] = (BLIVertex){ tX, bY, uv.X + uv.width, uv.Y,             sColor }; //bottom right
+
+		vIndex += 4;
+	}
+
+	//string has more glyphs than the glyph cache holds, early
+	//glyphs were thrown out by later ones
+	if(gCache != NULL && BLGetGlyphCacheStats(gCache).evictions != gEpoch)
+	{
+		free(entry->str);
+		free(entry->verts);
+		entry->str   = NULL;
+		entry->verts = NULL;
+		return BLHelperRenderUncached(str, rBounds, scale, lType, sType);
+	}
+
+	//fill key
+	memcpy(entry->str, str, strSize);
+	entry->inUse     = 1;
+	entry->hash      = hash;
+	entry->rBounds   = rBounds;
+	entry->scale     = scale;
+	entry->lType     = lType;
+	entry->sType     = sType;
+	entry->sMode     = sMode;
+	entry->font      = font;
+	entry->gCache    = gCache;
+	entry->gEpoch    = gEpoch;
+	entry->fits      = fits;
+	entry->vertCount = vIndex;
+	entry->inkBounds = BLCreateRecti(inkMinX, inkMinY, inkMaxX - inkMinX, inkMaxY - inkMinY);
+	entry->memSize   = memSize;
+
+	//link into bucket and LRU list
+	entry->bucketNext = textCache->buckets[hash & (BL_ITEXTCACHE_BUCKET_SIZE - 1)];
+	textCache->buckets[hash & (BL_ITEXTCACHE_BUCKET_SIZE - 1)] = newIndex;
+	BLHelperLRUPushFront(newIndex);
+
+	textCache->stats.memUsed += memSize;
+	textCache->stats.entryCount++;
+
+	//draw
+	BLHelperDrawEntry(entry, font == NULL && sMode == BL_ISTRING_MODE_SDF);
+
+	//end
+	return fits;
+}
+
+/*************************************************************
+* NAME: BLIGetTextCacheStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLITextCacheStats of the text cache
+* NOTE: N/A
+*************************************************************/
+BLITextCacheStats BLIGetTextCacheStats( )
+{
+	//check if init
+	if(textCache == NULL)
+	{
+		BLITextCacheStats empty = { 0 };
+		return empty;
+	}
+
+	//end
+	return textCache->stats;
+}
+
+/*************************************************************
+* NAME: BLIResetTextCacheStats
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	void
+* NOTE:
+*	Zeros hits, misses and evictions
+*************************************************************/
+void BLIResetTextCacheStats( )
+{
+	//check if init
+	if(textCache == NULL)
+	{
+		return;
+	}
+
+	//reset counters
+	textCache->stats.hits      = 0;
+	textCache->stats.misses    = 0;
+	textCache->stats.evictions = 0;
+
+	//end
+	return;
+}
\ No newline at end of file
@@ -0,0 +1,300 @@
+#ifndef __ITEXTEDIT_INCLUDE__
+#define __ITEXTEDIT_INCLUDE__
+
+
+/*************************************************************
+* FILE: ITextEdit.h
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Editable multi-line text with a cursor and selection,
+*	stored in a gap buffer
+* CONTENTS:
+*	- Includes
+*	- Defs
+*	- Structs
+*	- Functions
+*
+*************************************************************/
+
+#include "ICore.h"
+
+#define BL_ITEXTEDIT_TEXT_START 0x400 // starting text buffer size
+#define BL_ITEXTEDIT_LINE_START 0x40  // starting line index size
+
+/*************************************************************
+* NAME: BLITextEdit
+* DATE: 2026 - 10 - 19
+* NOTE:
+*	Members are private to ITextEditSource.c. Create with
+*	BLICreateTextEdit, free with BLIDestroyTextEdit
+*************************************************************/
+typedef struct BLITextEdit BLITextEdit;
+
+/*************************************************************
+* NAME: BLICreateTextEdit
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt maxLength -> max amount of text (in bytes), 0 for
+*	no limit
+* RETURNS:
+*	BLITextEdit* created (empty), NULL for failure
+* NOTE: N/A
+*************************************************************/
+BLITextEdit* BLICreateTextEdit(BLUInt maxLength);
+
+/*************************************************************
+* NAME: BLIDestroyTextEdit
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to free
+* RETURNS:
+*	void
+* NOTE: N/A
+*************************************************************/
+void BLIDestroyTextEdit(BLITextEdit* edit);
+
+/*************************************************************
+* NAME: BLITextEditInsert
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to insert into
+*	const BLByte* str -> text to insert
+*	BLUInt length     -> bytes of str to insert
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	Replaces the selection, then inserts at the cursor. Text
+*	past maxLength is cut. Cost depends on the size of str and
+*	the distance from the last edit, not the size of the text
+*************************************************************/
+int BLITextEditInsert(BLITextEdit* edit, const BLByte* str, BLUInt length);
+
+/*************************************************************
+* NAME: BLITextEditDelete
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to delete from
+*	BLInt count -> bytes to delete after the cursor (negative
+*	deletes before the cursor)
+* RETURNS:
+*	void
+* NOTE:
+*	Only deletes the selection if there is one
+*************************************************************/
+void BLITextEditDelete(BLITextEdit* edit, BLInt count);
+
+/*************************************************************
+* NAME: BLITextEditInput
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to type into
+*	BLByte input -> char from BLIGetChar
+* RETURNS:
+*	int, 1 if the text changed, 0 if not
+* NOTE:
+*	Backspace (8) deletes, 0 does nothing, everything else
+*	is inserted
+*************************************************************/
+int BLITextEditInput(BLITextEdit* edit, BLByte input);
+
+/*************************************************************
+* NAME: BLITextEditUpdate
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to update
+* RETURNS:
+*	int, 1 if the text changed, 0 if not
+* NOTE:
+*	Goes through this update's events in the order they
+*	happened. Types char events (printable ASCII), and the
+*	enter and backspace keys. Moves the cursor with the arrow,
+*	home and end keys (selecting with shift) and deletes with
+*	the delete key. Held keys repeat by BLWindowUpdate's
+*	timing. Call once per frame for the focused edit
+*************************************************************/
+int BLITextEditUpdate(BLITextEdit* edit);
+
+/*************************************************************
+* NAME: BLITextEditSetCursor
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to change
+*	BLUInt position -> byte to put the cursor before
+*	int select -> 1 to extend the selection, 0 to clear it
+* RETURNS:
+*	void
+* NOTE:
+*	position is clamped to the length of the text
+*************************************************************/
+void BLITextEditSetCursor(BLITextEdit* edit, BLUInt position, int select);
+
+/*************************************************************
+* NAME: BLITextEditMoveCursor
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to change
+*	BLInt count -> bytes to move (negative moves back)
+*	int select -> 1 to extend the selection, 0 to clear it
+* RETURNS:
+*	void
+* NOTE: N/A
+*************************************************************/
+void BLITextEditMoveCursor(BLITextEdit* edit, BLInt count, int select);
+
+/*************************************************************
+* NAME: BLITextEditMoveLine
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to change
+*	BLInt lines -> lines to move (negative moves up)
+*	int select -> 1 to extend the selection, 0 to clear it
+* RETURNS:
+*	void
+* NOTE:
+*	Keeps the cursor's column where the line is long enough
+*************************************************************/
+void BLITextEditMoveLine(BLITextEdit* edit, BLInt lines, int select);
+
+/*************************************************************
+* NAME: BLITextEditSelectAll
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to change
+* RETURNS:
+*	void
+* NOTE: N/A
+*************************************************************/
+void BLITextEditSelectAll(BLITextEdit* edit);
+
+/*************************************************************
+* NAME: BLITextEditGetCursor
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITextEdit* edit -> text edit to check
+* RETURNS:
+*	BLUInt, byte the cursor is before
+* NOTE: N/A
+*************************************************************/
+BLUInt BLITextEditGetCursor(const BLITextEdit* edit);
+
+/*************************************************************
+* NAME: BLITextEditGetSelection
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITextEdit* edit -> text edit to check
+*	BLUInt* start -> set to the first selected byte
+*	BLUInt* end   -> set to the byte after the selection
+* RETURNS:
+*	int, 1 if there is a selection, 0 if not
+* NOTE: N/A
+*************************************************************/
+int BLITextEditGetSelection(const BLITextEdit* edit, BLUInt* start, BLUInt* end);
+
+/*************************************************************
+* NAME: BLITextEditGetLength
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITextEdit* edit -> text edit to check
+* RETURNS:
+*	BLUInt, bytes of text
+* NOTE: N/A
+*************************************************************/
+BLUInt BLITextEditGetLength(const BLITextEdit* edit);
+
+/*************************************************************
+* NAME: BLITextEditGetLineCount
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITextEdit* edit -> text edit to check
+* RETURNS:
+*	BLUInt, amount of lines
+* NOTE: N/A
+*************************************************************/
+BLUInt BLITextEditGetLineCount(const BLITextEdit* edit);
+
+/*************************************************************
+* NAME: BLITextEditGetLineOf
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITextEdit* edit -> text edit to check
+*	BLUInt position -> byte to find
+* RETURNS:
+*	BLUInt, line the byte is on
+* NOTE:
+*	O(log lines)
+*************************************************************/
+BLUInt BLITextEditGetLineOf(const BLITextEdit* edit, BLUInt position);
+
+/*************************************************************
+* NAME: BLITextEditCopy
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITextEdit* edit -> text edit to copy from
+*	BLUInt start -> first byte to copy
+*	BLUInt end   -> byte after the last to copy
+*	BLByte* dest -> buffer to copy to (null terminated)
+*	BLUInt destSize -> size of dest
+* RETURNS:
+*	BLUInt, bytes copied (without the null terminator)
+* NOTE:
+*	Use with BLITextEditGetSelection to copy the selection
+*************************************************************/
+BLUInt BLITextEditCopy(const BLITextEdit* edit, BLUInt start, BLUInt end, BLByte* dest, BLUInt destSize);
+
+/*************************************************************
+* NAME: BLIRenderTextEditText
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to render
+*	BLRecti rBounds   -> bounds of the text edit
+*	BLUInt scale -> scale of each letter (in pixels)
+*	enum BL_GFONT_TYPE sType -> type of font to render
+* RETURNS:
+*	void
+* NOTE:
+*	Text pass of BLIRenderTextEdit, draws no selection or
+*	cursor. Scrolls to keep the cursor in view. Only the lines
+*	that fit rBounds are laid out and drawn
+*************************************************************/
+void BLIRenderTextEditText(BLITextEdit* edit, BLRecti rBounds, BLUInt scale, enum BL_GFONT_TYPE sType);
+
+/*************************************************************
+* NAME: BLIRenderTextEditCursor
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to render
+*	BLRecti rBounds   -> bounds of the text edit
+*	BLUInt scale -> scale of each letter (in pixels)
+*	BLColor cursorColor -> color of the cursor (the selection
+*	is drawn with a third of its alpha)
+* RETURNS:
+*	void
+* NOTE:
+*	Selection and cursor pass of BLIRenderTextEdit, call after
+*	BLIRenderTextEditText. Draws nothing if cursorColor has
+*	no alpha
+*************************************************************/
+void BLIRenderTextEditCursor(BLITextEdit* edit, BLRecti rBounds, BLUInt scale, BLColor cursorColor);
+
+/*************************************************************
+* NAME: BLIRenderTextEdit
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to render
+*	BLRecti rBounds   -> bounds of the text edit
+*	BLUInt scale -> scale of each letter (in pixels)
+*	enum BL_GFONT_TYPE sType -> type of font to render
+*	BLColor cursorColor -> color of the cursor (the selection
+*	is drawn with a third of its alpha)
+* RETURNS:
+*	void
+* NOTE:
+*	Scrolls to keep the cursor in view. Only the lines that
+*	fit rBounds are laid out and drawn. Lines don't wrap. Same
+*	as BLIRenderTextEditText then BLIRenderTextEditCursor in
+*	one batch
+*************************************************************/
+void BLIRenderTextEdit(BLITextEdit* edit, BLRecti rBounds, BLUInt scale, enum BL_GFONT_TYPE sType, BLColor cursorColor);
+
+#endif
@@ -0,0 +1,1170 @@
+
+
+/*************************************************************
+* FILE: ITextEditSource.c
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Source file for editable text
+* CONTENTS:
+*	- Includes
+*	- Backend struct defs
+*	- File-Specifc functions
+*	- Functions
+*
+*************************************************************/
+
+#include <stdio.h>   // I/O
+#include <stdlib.h>  // For memory management
+#include <string.h>  // For memmove
+#include <glfw3.h>   // For navigation key codes
+
+#include "ITextEdit.h" // Header
+#include "IBatch.h"    // For drawing every line at once
+
+/*************************************************************
+* NAME: BLITextEdit
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLByte* text      -> gap buffer of the text
+*	BLUInt textCap    -> size of text
+*	BLUInt gapStart   -> first byte of the gap
+*	BLUInt gapEnd     -> byte after the gap
+*	BLUInt* lines     -> gap buffer of line starts
+*	BLUInt lineCap    -> size of lines
+*	BLUInt lineGapStart -> first entry of the line gap
+*	BLUInt lineGapEnd   -> entry after the line gap
+*	BLUInt maxLength  -> max bytes of text, 0 for no limit
+*	BLUInt cursor     -> byte the cursor is before
+*	BLUInt anchor     -> other end of the selection
+*	BLUInt scroll     -> line shown at the top
+*	BLByte* scratch   -> single line copy for rendering
+*	BLUInt scratchSize -> size of scratch
+* NOTE:
+*	Line starts before the line gap are stored from the start
+*	of the text, line starts after it from the end of the
+*	text. Inserting or deleting only touches the edited line,
+*	the lines after it stay correct without being updated
+*************************************************************/
+struct BLITextEdit
+{
+	BLByte* text;
+	BLUInt  textCap;
+	BLUInt  gapStart;
+	BLUInt  gapEnd;
+	BLUInt* lines;
+	BLUInt  lineCap;
+	BLUInt  lineGapStart;
+	BLUInt  lineGapEnd;
+	BLUInt  maxLength;
+	BLUInt  cursor;
+	BLUInt  anchor;
+	BLUInt  scroll;
+	BLByte* scratch;
+	BLUInt  scratchSize;
+};
+
+/*************************************************************
+* NAME: BLHelperTextLength
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITextEdit* edit -> text edit to check
+* RETURNS:
+*	BLUInt, bytes of text
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline BLUInt BLHelperTextLength(const BLITextEdit* edit)
+{
+	return edit->textCap - (edit->gapEnd - edit->gapStart);
+}
+
+/*************************************************************
+* NAME: BLHelperLineCount
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITextEdit* edit -> text edit to check
+* RETURNS:
+*	BLUInt, amount of lines
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline BLUInt BLHelperLineCount(const BLITextEdit* edit)
+{
+	return edit->lineCap - (edit->lineGapEnd - edit->lineGapStart);
+}
+
+/*************************************************************
+* NAME: BLHelperLineStart
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITextEdit* edit -> text edit to check
+*	BLUInt line -> index of line
+* RETURNS:
+*	BLUInt, first byte of the line
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline BLUInt BLHelperLineStart(const BLITextEdit* edit, BLUInt line)
+{
+	if(line < edit->lineGapStart)
+	{
+		return edit->lines[line];
+	}
+
+	return BLHelperTextLength(edit) - edit->lines[line + (edit->lineGapEnd - edit->lineGapStart)];
+}
+
+/*************************************************************
+* NAME: BLHelperLineEnd
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITextEdit* edit -> text edit to check
+*	BLUInt line -> index of line
+* RETURNS:
+*	BLUInt, newline (or end of text) that ends the line
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline BLUInt BLHelperLineEnd(const BLITextEdit* edit, BLUInt line)
+{
+	if(line + 1 < BLHelperLineCount(edit))
+	{
+		return BLHelperLineStart(edit, line + 1) - 1;
+	}
+
+	return BLHelperTextLength(edit);
+}
+
+/*************************************************************
+* NAME: BLHelperMoveGap
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to change
+*	BLUInt position -> byte to move the gap to
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	O(distance moved)
+*************************************************************/
+static void BLHelperMoveGap(BLITextEdit* edit, BLUInt position)
+{
+	//move text after position to after the gap
+	if(position < edit->gapStart)
+	{
+		const BLUInt moveSize = edit->gapStart - position;
+		memmove(edit->text + edit->gapEnd - moveSize, edit->text + position, moveSize);
+		edit->gapStart -= moveSize;
+		edit->gapEnd   -= moveSize;
+	}
+
+	//move text before position to before the gap
+	if(position > edit->gapStart)
+	{
+		const BLUInt moveSize = position - edit->gapStart;
+		memmove(edit->text + edit->gapStart, edit->text + edit->gapEnd, moveSize);
+		edit->gapStart += moveSize;
+		edit->gapEnd   += moveSize;
+	}
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLHelperMoveLineGap
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to change
+*	BLUInt line -> line to move the line gap to
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	O(lines moved). Converts line starts that cross the gap
+*************************************************************/
+static void BLHelperMoveLineGap(BLITextEdit* edit, BLUInt line)
+{
+	const BLUInt length = BLHelperTextLength(edit);
+
+	//move line starts to after the gap
+	while(edit->lineGapStart > line)
+	{
+		edit->lineGapStart--;
+		edit->lineGapEnd--;
+		edit->lines[edit->lineGapEnd] = length - edit->lines[edit->lineGapStart];
+	}
+
+	//move line starts to before the gap
+	while(edit->lineGapStart < line)
+	{
+		edit->lines[edit->lineGapStart] = length - edit->lines[edit->lineGapEnd];
+		edit->lineGapStart++;
+		edit->lineGapEnd++;
+	}
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLHelperGrowGap
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	void** buffer   -> gap buffer to grow
+*	BLUInt* cap     -> capacity of buffer (in elements)
+*	BLUInt* gapEnd  -> element after the gap
+*	BLUInt gapSize  -> current size of the gap
+*	BLUInt need     -> gap size needed (in elements)
+*	BLUInt elemSize -> size of each element
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Doubles the capacity until the gap fits need
+*************************************************************/
+static int BLHelperGrowGap(void** buffer, BLUInt* cap, BLUInt* gapEnd, BLUInt gapSize, BLUInt need, BLUInt elemSize)
+{
+	//check if big enough
+	if(need <= gapSize)
+	{
+		return 1;
+	}
+
+	//get new size
+	const BLUInt used = *cap - gapSize;
+	BLUInt newCap = *cap;
+	while(newCap - used < need)
+	{
+		newCap *= 2;
+	}
+
+	//reallocate
+	BLByte* newBuffer = realloc(*buffer, (size_t)newCap * elemSize);
+	if(newBuffer == NULL)
+	{
+		fprintf(stderr, "ITextEdit: memory err\n");
+		return 0;
+	}
+
+	//move everything after the gap to the end
+	const BLUInt tailSize = *cap - *gapEnd;
+	memmove(newBuffer + (size_t)(newCap - tailSize) * elemSize, newBuffer + (size_t)*gapEnd * elemSize, (size_t)tailSize * elemSize);
+
+	*buffer = newBuffer;
+	*gapEnd = newCap - tailSize;
+	*cap    = newCap;
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLHelperDeleteRange
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to change
+*	BLUInt start -> first byte to delete
+*	BLUInt end   -> byte after the last to delete
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Puts the cursor at start
+*************************************************************/
+static void BLHelperDeleteRange(BLITextEdit* edit, BLUInt start, BLUInt end)
+{
+	const BLUInt length = BLHelperTextLength(edit);
+
+	//move line gap after the first line edited
+	BLHelperMoveLineGap(edit, BLITextEditGetLineOf(edit, start) + 1);
+
+	//drop lines that start in the deleted text
+	while(edit->lineGapEnd < edit->lineCap && length - edit->lines[edit->lineGapEnd] <= end)
+	{
+		edit->lineGapEnd++;
+	}
+
+	//grow gap over the deleted text
+	BLHelperMoveGap(edit, start);
+	edit->gapEnd += end - start;
+
+	edit->cursor = start;
+	edit->anchor = start;
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLHelperCopyRange
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITextEdit* edit -> text edit to copy from
+*	BLUInt start -> first byte to copy
+*	BLUInt end   -> byte after the last to copy
+*	BLByte* dest -> buffer to copy to (must fit end - start)
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static void BLHelperCopyRange(const BLITextEdit* edit, BLUInt start, BLUInt end, BLByte* dest)
+{
+	//copy text before the gap
+	if(start < edit->gapStart)
+	{
+		const BLUInt beforeEnd = (end < edit->gapStart) ? end : edit->gapStart;
+		memcpy(dest, edit->text + start, beforeEnd - start);
+		dest  += beforeEnd - start;
+		start  = beforeEnd;
+	}
+
+	//copy text after the gap
+	if(start < end)
+	{
+		memcpy(dest, edit->text + start + (edit->gapEnd - edit->gapStart), end - start);
+	}
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLHelperCopyLine
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to copy from
+*	BLUInt line -> line to copy
+* RETURNS:
+*	BLByte*, null terminated line in scratch, NULL for failure
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static BLByte* BLHelperCopyLine(BLITextEdit* edit, BLUInt line)
+{
+	const BLUInt start = BLHelperLineStart(edit, line);
+	const BLUInt end   = BLHelperLineEnd(edit, line);
+
+	//grow scratch
+	if(end - start + 1 > edit->scratchSize)
+	{
+		BLUInt newSize = (edit->scratchSize == 0) ? BL_ITEXTEDIT_TEXT_START : edit->scratchSize;
+		while(newSize < end - start + 1)
+		{
+			newSize *= 2;
+		}
+
+		BLByte* newScratch = realloc(edit->scratch, newSize);
+		if(newScratch == NULL)
+		{
+			fprintf(stderr, "ITextEdit: memory err\n");
+			return NULL;
+		}
+
+		edit->scratch     = newScratch;
+		edit->scratchSize = newSize;
+	}
+
+	//copy
+	BLHelperCopyRange(edit, start, end, edit->scratch);
+	edit->scratch[end - start] = 0;
+
+	//end
+	return edit->scratch;
+}
+
+/*************************************************************
+* NAME: BLHelperCaretX
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLByte* line -> null terminated line
+*	BLUInt column -> byte of line to get
+*	BLUInt scale  -> scale of each letter (in pixels)
+* RETURNS:
+*	BLInt, distance from the line start to the byte
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static BLInt BLHelperCaretX(BLByte* line, BLUInt column, BLUInt scale)
+{
+	//measure up to column
+	const BLByte cutByte = line[column];
+	line[column] = 0;
+	const BLInt caretX = BLIMeasureString(line, scale).advance;
+	line[column] = cutByte;
+
+	//end
+	return caretX;
+}
+
+/*************************************************************
+* NAME: BLHelperPageLines
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit being rendered
+*	BLRecti rBounds   -> bounds of the text edit
+*	BLUInt scale -> scale of each letter (in pixels)
+*	BLUInt* lastLine -> set to the line after the last one
+*	that fits
+* RETURNS:
+*	BLUInt, amount of lines that fit rBounds, 0 for none
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Scrolls to keep the cursor in view, so every render pass
+*	of one frame sees the same lines
+*************************************************************/
+static BLUInt BLHelperPageLines(BLITextEdit* edit, BLRecti rBounds, BLUInt scale, BLUInt* lastLine)
+{
+	//get lines that fit
+	const BLInt  lineStep  = (BLInt)((float)scale * BL_ICORE_NEWLINE_SCALE);
+	const BLUInt pageLines = (rBounds.H >= (BLInt)scale) ? (BLUInt)(((rBounds.H - (BLInt)scale) / lineStep) + 1) : 0;
+	const BLUInt lineCount = BLHelperLineCount(edit);
+	if(pageLines == 0)
+	{
+		return 0;
+	}
+
+	//keep cursor in view
+	const BLUInt cursorLine = BLITextEditGetLineOf(edit, edit->cursor);
+	if(cursorLine < edit->scroll)
+	{
+		edit->scroll = cursorLine;
+	}
+	if(cursorLine >= edit->scroll + pageLines)
+	{
+		edit->scroll = cursorLine - pageLines + 1;
+	}
+	*lastLine = (edit->scroll + pageLines < lineCount) ? edit->scroll + pageLines : lineCount;
+
+	//end
+	return pageLines;
+}
+
+/*************************************************************
+* NAME: BLICreateTextEdit
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt maxLength -> max amount of text (in bytes), 0 for
+*	no limit
+* RETURNS:
+*	BLITextEdit* created (empty), NULL for failure
+* NOTE: N/A
+*************************************************************/
+BLITextEdit* BLICreateTextEdit(BLUInt maxLength)
+{
+	//allocate
+	BLITextEdit* edit = calloc(1, sizeof(BLITextEdit));
+	if(edit == NULL)
+	{
+		fprintf(stderr, "Cannot create text edit: memory err\n");
+		return NULL;
+	}
+
+	edit->text  = malloc(BL_ITEXTEDIT_TEXT_START);
+	edit->lines = malloc(BL_ITEXTEDIT_LINE_START * sizeof(BLUInt));
+	if(edit->text == NULL || edit->lines == NULL)
+	{
+		fprintf(stderr, "Cannot create text edit: memory err\n");
+		free(edit->text);
+		free(edit->lines);
+		free(edit);
+		return NULL;
+	}
+
+	//empty text, one empty line
+	edit->textCap      = BL_ITEXTEDIT_TEXT_START;
+	edit->gapEnd       = BL_ITEXTEDIT_TEXT_START;
+	edit->lineCap      = BL_ITEXTEDIT_LINE_START;
+	edit->lines[0]     = 0;
+	edit->lineGapStart = 1;
+	edit->lineGapEnd   = BL_ITEXTEDIT_LINE_START;
+	edit->maxLength    = maxLength;
+
+	//end
+	return edit;
+}
+
+/*************************************************************
+* NAME: BLIDestroyTextEdit
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to free
+* RETURNS:
+*	void
+* NOTE: N/A
+*************************************************************/
+void BLIDestroyTextEdit(BLITextEdit* edit)
+{
+	//check if null
+	if(edit == NULL)
+	{
+		return;
+	}
+
+	free(edit->text);
+	free(edit->lines);
+	free(edit->scratch);
+	free(edit);
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLITextEditInsert
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to insert into
+*	const BLByte* str -> text to insert
+*	BLUInt length     -> bytes of str to insert
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	Replaces the selection, then inserts at the cursor. Text
+*	past maxLength is cut. Cost depends on the size of str and
+*	the distance from the last edit, not the size of the text
+*************************************************************/
+int BLITextEditInsert(BLITextEdit* edit, const BLByte* str, BLUInt length)
+{
+	//replace selection
+	BLUInt selStart, selEnd;
+	if(BLITextEditGetSelection(edit, &selStart, &selEnd))
+	{
+		BLHelperDeleteRange(edit, selStart, selEnd);
+	}
+
+	//clamp to maxLength
+	const BLUInt textLength = BLHelperTextLength(edit);
+	if(edit->maxLength != 0 && textLength + length > edit->maxLength)
+	{
+		length = (edit->maxLength > textLength) ? edit->maxLength - textLength : 0;
+	}
+	if(length == 0)
+	{
+		return 1;
+	}
+
+	//count new lines
+	BLUInt newLines = 0;
+	for(BLUInt i = 0; i < length; i++)
+	{
+		newLines += (str[i] == '\n');
+	}
+
+	//make space
+	if(BLHelperGrowGap((void**)&edit->text, &edit->textCap, &edit->gapEnd, edit->gapEnd - edit->gapStart, length, sizeof(BLByte)) == 0 ||
+		BLHelperGrowGap((void**)&edit->lines, &edit->lineCap, &edit->lineGapEnd, edit->lineGapEnd - edit->lineGapStart, newLines, sizeof(BLUInt)) == 0)
+	{
+		return 0;
+	}
+
+	//move gaps to the cursor
+	const BLUInt position = edit->cursor;
+	BLHelperMoveLineGap(edit, BLITextEditGetLineOf(edit, position) + 1);
+	BLHelperMoveGap(edit, position);
+
+	//copy text and add new lines
+	memcpy(edit->text + edit->gapStart, str, length);
+	for(BLUInt i = 0; i < length; i++)
+	{
+		if(str[i] == '\n')
+		{
+			edit->lines[edit->lineGapStart] = position + i + 1;
+			edit->lineGapStart++;
+		}
+	}
+	edit->gapStart += length;
+
+	edit->cursor = position + length;
+	edit->anchor = edit->cursor;
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLITextEditDelete
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to delete from
+*	BLInt count -> bytes to delete after the cursor (negative
+*	deletes before the cursor)
+* RETURNS:
+*	void
+* NOTE:
+*	Only deletes the selection if there is one
+*************************************************************/
+void BLITextEditDelete(BLITextEdit* edit, BLInt count)
+{
+	//delete selection
+	BLUInt start, end;
+	if(BLITextEditGetSelection(edit, &start, &end))
+	{
+		BLHelperDeleteRange(edit, start, end);
+		return;
+	}
+
+	//get range
+	const BLUInt length = BLHelperTextLength(edit);
+	if(count < 0)
+	{
+		start = ((BLUInt)(-count) < edit->cursor) ? edit->cursor - (BLUInt)(-count) : 0;
+		end   = edit->cursor;
+	}
+	else
+	{
+		start = edit->cursor;
+		end   = ((BLUInt)count < length - edit->cursor) ? edit->cursor + (BLUInt)count : length;
+	}
+
+	//delete
+	if(start < end)
+	{
+		BLHelperDeleteRange(edit, start, end);
+	}
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLITextEditInput
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to type into
+*	BLByte input -> char from BLIGetChar
+* RETURNS:
+*	int, 1 if the text changed, 0 if not
+* NOTE:
+*	Backspace (8) deletes, 0 does nothing, everything else
+*	is inserted
+*************************************************************/
+int BLITextEditInput(BLITextEdit* edit, BLByte input)
+{
+	//check if no char
+	if(input == 0)
+	{
+		return 0;
+	}
+
+	const BLUInt length    = BLHelperTextLength(edit);
+	const int    hadSelect = (edit->cursor != edit->anchor);
+
+	//backspace
+	if(input == (BLByte)8)
+	{
+		BLITextEditDelete(edit, -1);
+	}
+	else
+	{
+		BLITextEditInsert(edit, &input, 1);
+	}
+
+	//end
+	return hadSelect || BLHelperTextLength(edit) != length;
+}
+
+/*************************************************************
+* NAME: BLITextEditUpdate
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to update
+* RETURNS:
+*	int, 1 if the text changed, 0 if not
+* NOTE:
+*	Goes through this update's events in the order they
+*	happened. Types char events (printable ASCII), and the
+*	enter and backspace keys. Moves the cursor with the arrow,
+*	home and end keys (selecting with shift) and deletes with
+*	the delete key. Held keys repeat by BLWindowUpdate's
+*	timing. Call once per frame for the focused edit
+*************************************************************/
+int BLITextEditUpdate(BLITextEdit* edit)
+{
+	int changed = 0;
+	const BLInputFrame* input = BLWindowGetInput(BLRenderGetWindowContext( ));
+	for(BLUInt i = 0; i < input->eventCount; i++)
+	{
+		const BLInputEvent* event = &input->events[i];
+
+		//type
+		if(event->type == BL_INPUT_EVENT_CHAR)
+		{
+			if(event->code >= ' ' && event->code <= '~')
+			{
+				changed |= BLITextEditInput(edit, (BLByte)event->code);
+			}
+			continue;
+		}
+
+		//edit and navigate with presses and repeats
+		if(event->type != BL_INPUT_EVENT_KEY || event->action == BL_INPUT_ACTION_RELEASE)
+		{
+			continue;
+		}
+
+		const int select = (event->mods & GLFW_MOD_SHIFT) != 0;
+		const BLUInt line = BLITextEditGetLineOf(edit, edit->cursor);
+		switch (event->code)
+		{
+		case GLFW_KEY_ENTER:
+			changed |= BLITextEditInput(edit, '\n');
+			break;
+
+		case GLFW_KEY_BACKSPACE:
+			changed |= BLITextEditInput(edit, (BLByte)8);
+			break;
+
+		case GLFW_KEY_LEFT:
+			BLITextEditMoveCursor(edit, -1, select);
+			break;
+
+		case GLFW_KEY_RIGHT:
+			BLITextEditMoveCursor(edit, 1, select);
+			break;
+
+		case GLFW_KEY_UP:
+			BLITextEditMoveLine(edit, -1, select);
+			break;
+
+		case GLFW_KEY_DOWN:
+			BLITextEditMoveLine(edit, 1, select);
+			break;
+
+		case GLFW_KEY_HOME:
+			BLITextEditSetCursor(edit, BLHelperLineStart(edit, line), select);
+			break;
+
+		case GLFW_KEY_END:
+			BLITextEditSetCursor(edit, BLHelperLineEnd(edit, line), select);
+			break;
+
+		case GLFW_KEY_DELETE:
+			{
+				const BLUInt length = BLHelperTextLength(edit);
+				changed |= (edit->cursor != edit->anchor);
+				BLITextEditDelete(edit, 1);
+				changed |= (BLHelperTextLength(edit) != length);
+			}
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	//end
+	return changed;
+}
+
+/*************************************************************
+* NAME: BLITextEditSetCursor
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to change
+*	BLUInt position -> byte to put the cursor before
+*	int select -> 1 to extend the selection, 0 to clear it
+* RETURNS:
+*	void
+* NOTE:
+*	position is clamped to the length of the text
+*************************************************************/
+void BLITextEditSetCursor(BLITextEdit* edit, BLUInt position, int select)
+{
+	const BLUInt length = BLHelperTextLength(edit);
+	edit->cursor = (position < length) ? position : length;
+
+	if(select == 0)
+	{
+		edit->anchor = edit->cursor;
+	}
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLITextEditMoveCursor
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to change
+*	BLInt count -> bytes to move (negative moves back)
+*	int select -> 1 to extend the selection, 0 to clear it
+* RETURNS:
+*	void
+* NOTE: N/A
+*************************************************************/
+void BLITextEditMoveCursor(BLITextEdit* edit, BLInt count, int select)
+{
+	//collapse selection to the side moved to
+	BLUInt start, end;
+	if(select == 0 && count != 0 && BLITextEditGetSelection(edit, &start, &end))
+	{
+		BLITextEditSetCursor(edit, (count < 0) ? start : end, 0);
+		return;
+	}
+
+	//move
+	if(count < 0)
+	{
+		BLITextEditSetCursor(edit, ((BLUInt)(-count) < edit->cursor) ? edit->cursor - (BLUInt)(-count) : 0, select);
+	}
+	else
+	{
+		BLITextEditSetCursor(edit, edit->cursor + (BLUInt)count, select);
+	}
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLITextEditMoveLine
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to change
+*	BLInt lines -> lines to move (negative moves up)
+*	int select -> 1 to extend the selection, 0 to clear it
+* RETURNS:
+*	void
+* NOTE:
+*	Keeps the cursor's column where the line is long enough
+*************************************************************/
+void BLITextEditMoveLine(BLITextEdit* edit, BLInt lines, int select)
+{
+	//get cursor line and column
+	const BLUInt line   = BLITextEditGetLineOf(edit, edit->cursor);
+	const BLUInt column = edit->cursor - BLHelperLineStart(edit, line);
+
+	//get line to move to
+	BLUInt target;
+	if(lines < 0)
+	{
+		target = ((BLUInt)(-lines) < line) ? line - (BLUInt)(-lines) : 0;
+	}
+	else
+	{
+		const BLUInt lastLine = BLHelperLineCount(edit) - 1;
+		target = ((BLUInt)lines < lastLine - line) ? line + (BLUInt)lines : lastLine;
+	}
+
+	//keep column
+	const BLUInt targetStart = BLHelperLineStart(edit, target);
+	const BLUInt targetSize  = BLHelperLineEnd(edit, target) - targetStart;
+	BLITextEditSetCursor(edit, targetStart + ((column < targetSize) ? column : targetSize), select);
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLITextEditSelectAll
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to change
+* RETURNS:
+*	void
+* NOTE: N/A
+*************************************************************/
+void BLITextEditSelectAll(BLITextEdit* edit)
+{
+	edit->anchor = 0;
+	edit->cursor = BLHelperTextLength(edit);
+	return;
+}
+
+/*************************************************************
+* NAME: BLITextEditGetCursor
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITextEdit* edit -> text edit to check
+* RETURNS:
+*	BLUInt, byte the cursor is before
+* NOTE: N/A
+*************************************************************/
+BLUInt BLITextEditGetCursor(const BLITextEdit* edit)
+{
+	return edit->cursor;
+}
+
+/*************************************************************
+* NAME: BLITextEditGetSelection
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITextEdit* edit -> text edit to check
+*	BLUInt* start -> set to the first selected byte
+*	BLUInt* end   -> set to the byte after the selection
+* RETURNS:
+*	int, 1 if there is a selection, 0 if not
+* NOTE: N/A
+*************************************************************/
+int BLITextEditGetSelection(const BLITextEdit* edit, BLUInt* start, BLUInt* end)
+{
+	*start = (edit->cursor < edit->anchor) ? edit->cursor : edit->anchor;
+	*end   = (edit->cursor < edit->anchor) ? edit->anchor : edit->cursor;
+	return *start != *end;
+}
+
+/*************************************************************
+* NAME: BLITextEditGetLength
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITextEdit* edit -> text edit to check
+* RETURNS:
+*	BLUInt, bytes of text
+* NOTE: N/A
+*************************************************************/
+BLUInt BLITextEditGetLength(const BLITextEdit* edit)
+{
+	return BLHelperTextLength(edit);
+}
+
+/*************************************************************
+* NAME: BLITextEditGetLineCount
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITextEdit* edit -> text edit to check
+* RETURNS:
+*	BLUInt, amount of lines
+* NOTE: N/A
+*************************************************************/
+BLUInt BLITextEditGetLineCount(const BLITextEdit* edit)
+{
+	return BLHelperLineCount(edit);
+}
+
+/*************************************************************
+* NAME: BLITextEditGetLineOf
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITextEdit* edit -> text edit to check
+*	BLUInt position -> byte to find
+* RETURNS:
+*	BLUInt, line the byte is on
+* NOTE:
+*	O(log lines)
+*************************************************************/
+BLUInt BLITextEditGetLineOf(const BLITextEdit* edit, BLUInt position)
+{
+	//find the last line starting at or before position
+	BLUInt low  = 0;
+	BLUInt high = BLHelperLineCount(edit) - 1;
+	while(low < high)
+	{
+		const BLUInt mid = (low + high + 1) / 2;
+		if(BLHelperLineStart(edit, mid) <= position)
+		{
+			low = mid;
+		}
+		else
+		{
+			high = mid - 1;
+		}
+	}
+
+	//end
+	return low;
+}
+
+/*************************************************************
+* NAME: BLITextEditCopy
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITextEdit* edit -> text edit to copy from
+*	BLUInt start -> first byte to copy
+*	BLUInt end   -> byte after the last to copy
+*	BLByte* dest -> buffer to copy to (null terminated)
+*	BLUInt destSize -> size of dest
+* RETURNS:
+*	BLUInt, bytes copied (without the null terminator)
+* NOTE:
+*	Use with BLITextEditGetSelection to copy the selection
+*************************************************************/
+BLUInt BLITextEditCopy(const BLITextEdit* edit, BLUInt start, BLUInt end, BLByte* dest, BLUInt destSize)
+{
+	//check if dest has space
+	if(destSize == 0)
+	{
+		return 0;
+	}
+
+	//clamp range
+	const BLUInt length = BLHelperTextLength(edit);
+	if(end > length)
+	{
+		end = length;
+	}
+	if(start > end)
+	{
+		start = end;
+	}
+	if(end - start > destSize - 1)
+	{
+		end = start + destSize - 1;
+	}
+
+	//copy
+	BLHelperCopyRange(edit, start, end, dest);
+	dest[end - start] = 0;
+
+	//end
+	return end - start;
+}
+
+/*************************************************************
+* NAME: BLIRenderTextEditText
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to render
+*	BLRecti rBounds   -> bounds of the text edit
+*	BLUInt scale -> scale of each letter (in pixels)
+*	enum BL_GFONT_TYPE sType -> type of font to render
+* RETURNS:
+*	void
+* NOTE:
+*	Text pass of BLIRenderTextEdit, draws no selection or
+*	cursor. Scrolls to keep the cursor in view. Only the lines
+*	that fit rBounds are laid out and drawn
+*************************************************************/
+void BLIRenderTextEditText(BLITextEdit* edit, BLRecti rBounds, BLUInt scale, enum BL_GFONT_TYPE sType)
+{
+	BLUInt lastLine = 0;
+	if(BLHelperPageLines(edit, rBounds, scale, &lastLine) == 0)
+	{
+		return;
+	}
+
+	//draw visible lines
+	//remember: string layout starts a glyph left of tX
+	const BLInt lineStep = (BLInt)((float)scale * BL_ICORE_NEWLINE_SCALE);
+	BLIBeginBatch( );
+	for(BLUInt i = edit->scroll; i < lastLine; i++)
+	{
+		BLByte* line = BLHelperCopyLine(edit, i);
+		if(line == NULL)
+		{
+			break;
+		}
+
+		const BLInt lineTop = rBounds.Y + rBounds.H - ((BLInt)(i - edit->scroll) * lineStep);
+		BLIRenderString(line, (BLUInt)(rBounds.X + (BLInt)scale), (BLUInt)lineTop, scale, sType);
+	}
+	BLIEndBatch( );
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLIRenderTextEditCursor
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to render
+*	BLRecti rBounds   -> bounds of the text edit
+*	BLUInt scale -> scale of each letter (in pixels)
+*	BLColor cursorColor -> color of the cursor (the selection
+*	is drawn with a third of its alpha)
+* RETURNS:
+*	void
+* NOTE:
+*	Selection and cursor pass of BLIRenderTextEdit, call after
+*	BLIRenderTextEditText. Draws nothing if cursorColor has
+*	no alpha
+*************************************************************/
+void BLIRenderTextEditCursor(BLITextEdit* edit, BLRecti rBounds, BLUInt scale, BLColor cursorColor)
+{
+	//check if hidden
+	BLUInt lastLine = 0;
+	if(cursorColor.A == 0 || BLHelperPageLines(edit, rBounds, scale, &lastLine) == 0)
+	{
+		return;
+	}
+
+	const BLInt lineStep = (BLInt)((float)scale * BL_ICORE_NEWLINE_SCALE);
+	BLIBeginBatch( );
+
+	//draw selection
+	BLUInt selStart, selEnd;
+	if(BLITextEditGetSelection(edit, &selStart, &selEnd))
+	{
+		BLColor selColor = cursorColor;
+		selColor.A /= 3;
+
+		for(BLUInt i = edit->scroll; i < lastLine; i++)
+		{
+			//check if line is selected (with its newline)
+			const BLUInt lineStart = BLHelperLineStart(edit, i);
+			const BLUInt lineEnd   = BLHelperLineEnd(edit, i);
+			if(selStart > lineEnd || selEnd <= lineStart)
+			{
+				continue;
+			}
+
+			BLByte* line = BLHelperCopyLine(edit, i);
+			if(line == NULL)
+			{
+				break;
+			}
+
+			//get selected part of line
+			const BLUInt c0 = ((selStart > lineStart) ? selStart : lineStart) - lineStart;
+			const BLUInt c1 = ((selEnd < lineEnd) ? selEnd : lineEnd) - lineStart;
+			const BLInt  x0 = BLHelperCaretX(line, c0, scale);
+			BLInt        x1 = BLHelperCaretX(line, c1, scale);
+			if(selEnd > lineEnd)
+			{
+				x1 += (BLInt)scale / 2;
+			}
+
+			const BLInt lineTop = rBounds.Y + rBounds.H - ((BLInt)(i - edit->scroll) * lineStep);
+			BLIRenderBox(BLCreateRecti(rBounds.X + x0, lineTop - (BLInt)scale, x1 - x0, (BLInt)scale), selColor);
+		}
+	}
+
+	//draw cursor
+	const BLUInt cursorLine = BLITextEditGetLineOf(edit, edit->cursor);
+	BLByte*      line       = BLHelperCopyLine(edit, cursorLine);
+	if(line != NULL)
+	{
+		const BLInt caretX  = BLHelperCaretX(line, edit->cursor - BLHelperLineStart(edit, cursorLine), scale);
+		const BLInt lineTop = rBounds.Y + rBounds.H - ((BLInt)(cursorLine - edit->scroll) * lineStep);
+		const BLInt width   = ((BLInt)scale / 8 > 1) ? (BLInt)scale / 8 : 1;
+		BLIRenderBox(BLCreateRecti(rBounds.X + caretX, lineTop - (BLInt)scale, width, (BLInt)scale), cursorColor);
+	}
+
+	BLIEndBatch( );
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLIRenderTextEdit
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextEdit* edit -> text edit to render
+*	BLRecti rBounds   -> bounds of the text edit
+*	BLUInt scale -> scale of each letter (in pixels)
+*	enum BL_GFONT_TYPE sType -> type of font to render
+*	BLColor cursorColor -> color of the cursor (the selection
+*	is drawn with a third of its alpha)
+* RETURNS:
+*	void
+* NOTE:
+*	Scrolls to keep the cursor in view. Only the lines that
+*	fit rBounds are laid out and drawn. Lines don't wrap. Same
+*	as BLIRenderTextEditText then BLIRenderTextEditCursor in
+*	one batch
+*************************************************************/
+void BLIRenderTextEdit(BLITextEdit* edit, BLRecti rBounds, BLUInt scale, enum BL_GFONT_TYPE sType, BLColor cursorColor)
+{
+	BLIBeginBatch( );
+	BLIRenderTextEditText(edit, rBounds, scale, sType);
+	BLIRenderTextEditCursor(edit, rBounds, scale, cursorColor);
+	BLIEndBatch( );
+
+	//end
+	return;
+}
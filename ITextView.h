@@ -0,0 +1,162 @@
+#ifndef __ITEXTVIEW_INCLUDE__
+#define __ITEXTVIEW_INCLUDE__
+
+
+/*************************************************************
+* FILE: ITextView.h
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Scrolling view for very large, append only text (logs)
+* CONTENTS:
+*	- Includes
+*	- Defs
+*	- Structs
+*	- Functions
+*
+*************************************************************/
+
+#include "ICore.h"
+
+#define BL_ITEXTVIEW_TEXT_START 0x1000 // starting text buffer size
+#define BL_ITEXTVIEW_LINE_START 0x100  // starting line index size
+
+/*************************************************************
+* NAME: BLITextView
+* DATE: 2026 - 10 - 19
+* NOTE:
+*	Members are private to ITextViewSource.c. Create with
+*	BLICreateTextView, free with BLIDestroyTextView
+*************************************************************/
+typedef struct BLITextView BLITextView;
+
+/*************************************************************
+* NAME: BLICreateTextView
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLITextView* created (empty), NULL for failure
+* NOTE:
+*	New views follow the end of the text
+*************************************************************/
+BLITextView* BLICreateTextView( );
+
+/*************************************************************
+* NAME: BLIDestroyTextView
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextView* view -> view to free
+* RETURNS:
+*	void
+* NOTE: N/A
+*************************************************************/
+void BLIDestroyTextView(BLITextView* view);
+
+/*************************************************************
+* NAME: BLITextViewAppend
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextView* view -> view to append to
+*	const BLByte* str -> text to append (newlines start lines)
+*	BLUInt length     -> bytes of str to append
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	Only the appended bytes are indexed, so the cost doesn't
+*	depend on how much text the view holds
+*************************************************************/
+int BLITextViewAppend(BLITextView* view, const BLByte* str, BLUInt length);
+
+/*************************************************************
+* NAME: BLITextViewClear
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextView* view -> view to clear
+* RETURNS:
+*	void
+* NOTE:
+*	Memory is kept for reuse
+*************************************************************/
+void BLITextViewClear(BLITextView* view);
+
+/*************************************************************
+* NAME: BLITextViewGetLineCount
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITextView* view -> view to check
+* RETURNS:
+*	BLUInt, amount of lines in the view
+* NOTE: N/A
+*************************************************************/
+BLUInt BLITextViewGetLineCount(const BLITextView* view);
+
+/*************************************************************
+* NAME: BLITextViewGetLine
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITextView* view -> view to check
+*	BLUInt line -> index of line
+* RETURNS:
+*	const BLByte* null terminated line (no newline), NULL if
+*	line is out of range
+* NOTE:
+*	Only valid until the next append
+*************************************************************/
+const BLByte* BLITextViewGetLine(const BLITextView* view, BLUInt line);
+
+/*************************************************************
+* NAME: BLITextViewScrollTo
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextView* view -> view to scroll
+*	BLUInt line -> line to show at the top
+* RETURNS:
+*	void
+* NOTE:
+*	Scrolling to the last page makes the view follow the end
+*	of the text as it is appended
+*************************************************************/
+void BLITextViewScrollTo(BLITextView* view, BLUInt line);
+
+/*************************************************************
+* NAME: BLITextViewScrollBy
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextView* view -> view to scroll
+*	BLInt lines -> lines to scroll (positive scrolls down)
+* RETURNS:
+*	void
+* NOTE: N/A
+*************************************************************/
+void BLITextViewScrollBy(BLITextView* view, BLInt lines);
+
+/*************************************************************
+* NAME: BLITextViewGetScroll
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITextView* view -> view to check
+* RETURNS:
+*	BLUInt, line shown at the top
+* NOTE: N/A
+*************************************************************/
+BLUInt BLITextViewGetScroll(const BLITextView* view);
+
+/*************************************************************
+* NAME: BLIRenderTextView
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextView* view -> view to render
+*	BLRecti rBounds   -> bounds of the view
+*	BLUInt scale -> scale of each letter (in pixels)
+*	enum BL_GFONT_TYPE sType -> type of font to render
+* RETURNS:
+*	void
+* NOTE:
+*	Only the lines that fit rBounds are laid out and drawn, in
+*	a single batch. Lines don't wrap. The cost only depends on
+*	the size of rBounds, not on the size of the text
+*************************************************************/
+void BLIRenderTextView(BLITextView* view, BLRecti rBounds, BLUInt scale, enum BL_GFONT_TYPE sType);
+
+#endif
@@ -0,0 +1,404 @@
+
+
+/*************************************************************
+* FILE: ITextViewSource.c
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Source file for the scrolling text view
+* CONTENTS:
+*	- Includes
+*	- Backend struct defs
+*	- File-Specifc functions
+*	- Functions
+*
+*************************************************************/
+
+#include <stdio.h>   // I/O
+#include <stdlib.h>  // For memory management
+
+#include "ITextView.h" // Header
+#include "IBatch.h"    // For drawing every line at once
+
+/*************************************************************
+* NAME: BLITextView
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLByte* text      -> every line, each null terminated
+*	BLUInt textSize   -> bytes of text used (without the last
+*	null terminator)
+*	BLUInt textCap    -> size of text
+*	BLUInt* lineStarts -> offset of each line in text
+*	BLUInt lineCount  -> amount of lines
+*	BLUInt lineCap    -> size of lineStarts
+*	BLUInt scroll     -> line shown at the top
+*	int follow        -> 1 to keep the last line in view
+*	BLUInt pageLines  -> lines that fit at the last render
+* NOTE:
+*	Newlines are stored as null terminators, so each line can
+*	be laid out straight from the text
+*************************************************************/
+struct BLITextView
+{
+	BLByte* text;
+	BLUInt  textSize;
+	BLUInt  textCap;
+	BLUInt* lineStarts;
+	BLUInt  lineCount;
+	BLUInt  lineCap;
+	BLUInt  scroll;
+	int     follow;
+	BLUInt  pageLines;
+};
+
+/*************************************************************
+* NAME: BLHelperGrowBuffer
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	void** buffer   -> buffer to grow
+*	BLUInt* cap     -> capacity of buffer (in elements)
+*	BLUInt need     -> capacity needed (in elements)
+*	BLUInt elemSize -> size of each element
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Doubles the capacity until need fits
+*************************************************************/
+static int BLHelperGrowBuffer(void** buffer, BLUInt* cap, BLUInt need, BLUInt elemSize)
+{
+	//check if big enough
+	if(need <= *cap)
+	{
+		return 1;
+	}
+
+	//get new size
+	BLUInt newCap = *cap;
+	while(newCap < need)
+	{
+		newCap *= 2;
+	}
+
+	//reallocate
+	void* newBuffer = realloc(*buffer, (size_t)newCap * elemSize);
+	if(newBuffer == NULL)
+	{
+		fprintf(stderr, "ITextView: memory err\n");
+		return 0;
+	}
+
+	*buffer = newBuffer;
+	*cap    = newCap;
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLHelperMaxScroll
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITextView* view -> view to check
+* RETURNS:
+*	BLUInt, top line of the last page
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline BLUInt BLHelperMaxScroll(const BLITextView* view)
+{
+	return (view->lineCount > view->pageLines) ? view->lineCount - view->pageLines : 0;
+}
+
+/*************************************************************
+* NAME: BLICreateTextView
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	BLITextView* created (empty), NULL for failure
+* NOTE:
+*	New views follow the end of the text
+*************************************************************/
+BLITextView* BLICreateTextView( )
+{
+	//allocate
+	BLITextView* view = calloc(1, sizeof(BLITextView));
+	if(view == NULL)
+	{
+		fprintf(stderr, "Cannot create text view: memory err\n");
+		return NULL;
+	}
+
+	view->text       = malloc(BL_ITEXTVIEW_TEXT_START);
+	view->lineStarts = malloc(BL_ITEXTVIEW_LINE_START * sizeof(BLUInt));
+	if(view->text == NULL || view->lineStarts == NULL)
+	{
+		fprintf(stderr, "Cannot create text view: memory err\n");
+		free(view->text);
+		free(view->lineStarts);
+		free(view);
+		return NULL;
+	}
+
+	view->textCap = BL_ITEXTVIEW_TEXT_START;
+	view->lineCap = BL_ITEXTVIEW_LINE_START;
+
+	//start with one empty line
+	BLITextViewClear(view);
+
+	//end
+	return view;
+}
+
+/*************************************************************
+* NAME: BLIDestroyTextView
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextView* view -> view to free
+* RETURNS:
+*	void
+* NOTE: N/A
+*************************************************************/
+void BLIDestroyTextView(BLITextView* view)
+{
+	//check if null
+	if(view == NULL)
+	{
+		return;
+	}
+
+	free(view->text);
+	free(view->lineStarts);
+	free(view);
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLITextViewAppend
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextView* view -> view to append to
+*	const BLByte* str -> text to append (newlines start lines)
+*	BLUInt length     -> bytes of str to append
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	Only the appended bytes are indexed, so the cost doesn't
+*	depend on how much text the view holds
+*************************************************************/
+int BLITextViewAppend(BLITextView* view, const BLByte* str, BLUInt length)
+{
+	//make space (and keep the last null terminator)
+	if(BLHelperGrowBuffer((void**)&view->text, &view->textCap, view->textSize + length + 1, sizeof(BLByte)) == 0)
+	{
+		return 0;
+	}
+
+	//copy and index new lines
+	BLByte* dest = view->text + view->textSize;
+	for(BLUInt i = 0; i < length; i++)
+	{
+		//newlines end the current line
+		if(str[i] == '\n')
+		{
+			if(BLHelperGrowBuffer((void**)&view->lineStarts, &view->lineCap, view->lineCount + 1, sizeof(BLUInt)) == 0)
+			{
+				view->textSize += i;
+				view->text[view->textSize] = 0;
+				return 0;
+			}
+
+			dest[i] = 0;
+			view->lineStarts[view->lineCount] = view->textSize + i + 1;
+			view->lineCount++;
+		}
+		else
+		{
+			dest[i] = str[i];
+		}
+	}
+
+	//end text
+	view->textSize += length;
+	view->text[view->textSize] = 0;
+
+	//stay on the last page
+	if(view->follow)
+	{
+		view->scroll = BLHelperMaxScroll(view);
+	}
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLITextViewClear
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextView* view -> view to clear
+* RETURNS:
+*	void
+* NOTE:
+*	Memory is kept for reuse
+*************************************************************/
+void BLITextViewClear(BLITextView* view)
+{
+	view->text[0]       = 0;
+	view->textSize      = 0;
+	view->lineStarts[0] = 0;
+	view->lineCount     = 1;
+	view->scroll        = 0;
+	view->follow        = 1;
+	return;
+}
+
+/*************************************************************
+* NAME: BLITextViewGetLineCount
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITextView* view -> view to check
+* RETURNS:
+*	BLUInt, amount of lines in the view
+* NOTE: N/A
+*************************************************************/
+BLUInt BLITextViewGetLineCount(const BLITextView* view)
+{
+	return view->lineCount;
+}
+
+/*************************************************************
+* NAME: BLITextViewGetLine
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITextView* view -> view to check
+*	BLUInt line -> index of line
+* RETURNS:
+*	const BLByte* null terminated line (no newline), NULL if
+*	line is out of range
+* NOTE:
+*	Only valid until the next append
+*************************************************************/
+const BLByte* BLITextViewGetLine(const BLITextView* view, BLUInt line)
+{
+	//check range
+	if(line >= view->lineCount)
+	{
+		return NULL;
+	}
+
+	return view->text + view->lineStarts[line];
+}
+
+/*************************************************************
+* NAME: BLITextViewScrollTo
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextView* view -> view to scroll
+*	BLUInt line -> line to show at the top
+* RETURNS:
+*	void
+* NOTE:
+*	Scrolling to the last page makes the view follow the end
+*	of the text as it is appended
+*************************************************************/
+void BLITextViewScrollTo(BLITextView* view, BLUInt line)
+{
+	const BLUInt maxScroll = BLHelperMaxScroll(view);
+
+	//clamp to the last page
+	if(line >= maxScroll)
+	{
+		view->scroll = maxScroll;
+		view->follow = 1;
+	}
+	else
+	{
+		view->scroll = line;
+		view->follow = 0;
+	}
+
+	//end
+	return;
+}
+
+/*************************************************************
+* NAME: BLITextViewScrollBy
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextView* view -> view to scroll
+*	BLInt lines -> lines to scroll (positive scrolls down)
+* RETURNS:
+*	void
+* NOTE: N/A
+*************************************************************/
+void BLITextViewScrollBy(BLITextView* view, BLInt lines)
+{
+	//clamp to the first line
+	if(lines < 0 && (BLUInt)(-lines) > view->scroll)
+	{
+		BLITextViewScrollTo(view, 0);
+		return;
+	}
+
+	BLITextViewScrollTo(view, view->scroll + lines);
+	return;
+}
+
+/*************************************************************
+* NAME: BLITextViewGetScroll
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITextView* view -> view to check
+* RETURNS:
+*	BLUInt, line shown at the top
+* NOTE: N/A
+*************************************************************/
+BLUInt BLITextViewGetScroll(const BLITextView* view)
+{
+	return view->scroll;
+}
+
+/*************************************************************
+* NAME: BLIRenderTextView
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITextView* view -> view to render
+*	BLRecti rBounds   -> bounds of the view
+*	BLUInt scale -> scale of each letter (in pixels)
+*	enum BL_GFONT_TYPE sType -> type of font to render
+* RETURNS:
+*	void
+* NOTE:
+*	Only the lines that fit rBounds are laid out and drawn, in
+*	a single batch. Lines don't wrap. The cost only depends on
+*	the size of rBounds, not on the size of the text
+*************************************************************/
+void BLIRenderTextView(BLITextView* view, BLRecti rBounds, BLUInt scale, enum BL_GFONT_TYPE sType)
+{
+	//get lines that fit
+	const BLInt lineStep = (BLInt)((float)scale * BL_ICORE_NEWLINE_SCALE);
+	view->pageLines = (rBounds.H >= (BLInt)scale) ? (BLUInt)(((rBounds.H - (BLInt)scale) / lineStep) + 1) : 0;
+
+	//keep scroll in range
+	if(view->follow || view->scroll > BLHelperMaxScroll(view))
+	{
+		view->scroll = BLHelperMaxScroll(view);
+	}
+
+	//draw visible lines
+	//remember: string layout starts a glyph left of tX
+	BLIBeginBatch( );
+	for(BLUInt i = 0; i < view->pageLines && view->scroll + i < view->lineCount; i++)
+	{
+		const BLInt lineTop = rBounds.Y + rBounds.H - ((BLInt)i * lineStep);
+		BLIRenderString(view->text + view->lineStarts[view->scroll + i], (BLUInt)(rBounds.X + (BLInt)scale), (BLUInt)lineTop, scale, sType);
+	}
+	BLIEndBatch( );
+
+	//end
+	return;
+}
\ No newline at end of file
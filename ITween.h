@@ -0,0 +1,215 @@
+#ifndef __ITWEEN_INCLUDE__
+#define __ITWEEN_INCLUDE__
+
+
+/*************************************************************
+* FILE: ITween.h
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Time based animation of block scales, rects and colors
+* CONTENTS:
+*	- Includes
+*	- Defs
+*	- Enums
+*	- Structs
+*	- Functions
+*
+*************************************************************/
+
+#include "ICore.h"
+#include "IBlocks.h"   // For animated blocks
+#include "IHitGrid.h"  // For hover and click animation
+
+#define BL_ITWEEN_START    0x40 // starting tween buffer size
+#define BL_ITWEEN_CHANNELS 4    // floats animated per tween
+
+/*************************************************************
+* NAME: BL_ITWEEN_TARGET
+* DATE: 2026 - 10 - 19
+* NOTE: This enum is for which part of a block a tween writes
+*************************************************************/
+enum BL_ITWEEN_TARGET
+{
+	BL_ITWEEN_TARGET_SCALE  = 0, // BLIBlockStoreSetScale
+	BL_ITWEEN_TARGET_DIMS   = 1, // BLIBlockStoreSetDims
+	BL_ITWEEN_TARGET_COLOR0 = 2, // first color
+	BL_ITWEEN_TARGET_COLOR1 = 3  // second color
+};
+
+/*************************************************************
+* NAME: BL_ITWEEN_EASE
+* DATE: 2026 - 10 - 19
+* NOTE: This enum is for how a tween moves from start to end.
+* OUT_BACK goes slightly past the end before settling
+*************************************************************/
+enum BL_ITWEEN_EASE
+{
+	BL_ITWEEN_EASE_LINEAR      = 0,
+	BL_ITWEEN_EASE_IN_QUAD     = 1,
+	BL_ITWEEN_EASE_OUT_QUAD    = 2,
+	BL_ITWEEN_EASE_IN_OUT_QUAD = 3,
+	BL_ITWEEN_EASE_OUT_CUBIC   = 4,
+	BL_ITWEEN_EASE_OUT_BACK    = 5
+};
+
+/*************************************************************
+* NAME: BLITweens
+* DATE: 2026 - 10 - 19
+* NOTE:
+*	Members are private to ITweenSource.c. Create with
+*	BLICreateTweens, free with BLIDestroyTweens. Only running
+*	tweens are kept, a block with none costs nothing
+*************************************************************/
+typedef struct BLITweens BLITweens;
+
+/*************************************************************
+* NAME: BLICreateTweens
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt capacity -> tweens to make room for, 0 for
+*	BL_ITWEEN_START
+* RETURNS:
+*	BLITweens* created (empty), NULL for failure
+* NOTE: N/A
+*************************************************************/
+BLITweens* BLICreateTweens(BLUInt capacity);
+
+/*************************************************************
+* NAME: BLIDestroyTweens
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITweens* tweens -> tweens to free
+* RETURNS:
+*	void
+* NOTE:
+*	Blocks keep the last values written
+*************************************************************/
+void BLIDestroyTweens(BLITweens* tweens);
+
+/*************************************************************
+* NAME: BLITweenScale
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITweens* tweens -> tweens to add to
+*	BLBlockStore* store -> store holding the block
+*	BLBlockHandle handle -> block to animate
+*	float scale -> scale to end at
+*	float duration -> length of the tween (seconds)
+*	enum BL_ITWEEN_EASE ease -> easing curve
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	Starts from the block's current scale. A running scale
+*	tween on the block is replaced, so it turns around
+*	smoothly
+*************************************************************/
+int BLITweenScale(BLITweens* tweens, BLBlockStore* store, BLBlockHandle handle, float scale, float duration,
+	enum BL_ITWEEN_EASE ease);
+
+/*************************************************************
+* NAME: BLITweenDims
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITweens* tweens -> tweens to add to
+*	BLBlockStore* store -> store holding the block
+*	BLBlockHandle handle -> block to animate
+*	BLRecti dims -> dims to end at
+*	float duration -> length of the tween (seconds)
+*	enum BL_ITWEEN_EASE ease -> easing curve
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	Starts from the block's current dims, replaces a running
+*	dims tween on the block
+*************************************************************/
+int BLITweenDims(BLITweens* tweens, BLBlockStore* store, BLBlockHandle handle, BLRecti dims, float duration,
+	enum BL_ITWEEN_EASE ease);
+
+/*************************************************************
+* NAME: BLITweenColor
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITweens* tweens -> tweens to add to
+*	BLBlockStore* store -> store holding the block
+*	BLBlockHandle handle -> block to animate
+*	enum BL_ITWEEN_TARGET target -> BL_ITWEEN_TARGET_COLOR0
+*	or BL_ITWEEN_TARGET_COLOR1
+*	BLColor color -> color to end at
+*	float duration -> length of the tween (seconds)
+*	enum BL_ITWEEN_EASE ease -> easing curve
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	Starts from the block's current color, replaces a
+*	running tween of the same color on the block
+*************************************************************/
+int BLITweenColor(BLITweens* tweens, BLBlockStore* store, BLBlockHandle handle, enum BL_ITWEEN_TARGET target,
+	BLColor color, float duration, enum BL_ITWEEN_EASE ease);
+
+/*************************************************************
+* NAME: BLITweenHitState
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITweens* tweens -> tweens to add to
+*	BLBlockStore* store -> store the grid's blocks are in
+*	const BLIHitGrid* grid -> hit grid the blocks were added
+*	to with BLIAddBlockStoreHits
+*	float hoverScale -> scale of the hovered block
+*	float clickScale -> scale of the held block
+*	float duration -> length of each tween (seconds)
+*	enum BL_ITWEEN_EASE ease -> easing curve
+* RETURNS:
+*	void
+* NOTE:
+*	Animated version of BLIBlockStoreSetHitState. Only blocks
+*	that gain or lose hover or click get a scale tween. Leave
+*	the store's state scales at 1 when using this. Call
+*	after BLIHitGridEnd
+*************************************************************/
+void BLITweenHitState(BLITweens* tweens, BLBlockStore* store, const BLIHitGrid* grid, float hoverScale,
+	float clickScale, float duration, enum BL_ITWEEN_EASE ease);
+
+/*************************************************************
+* NAME: BLIAdvanceTweens
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITweens* tweens -> tweens to advance
+*	BLBlockStore* store -> store to write into
+*	float delta -> time since the last advance (seconds)
+* RETURNS:
+*	BLUInt amount of tweens still running
+* NOTE:
+*	Call once a frame before rendering the store. Finished
+*	tweens write their end value and are thrown out, tweens
+*	on removed blocks are dropped
+*************************************************************/
+BLUInt BLIAdvanceTweens(BLITweens* tweens, BLBlockStore* store, float delta);
+
+/*************************************************************
+* NAME: BLICancelTweens
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITweens* tweens -> tweens to edit
+*	BLBlockHandle handle -> block to stop animating
+* RETURNS:
+*	void
+* NOTE:
+*	The block keeps the last values written
+*************************************************************/
+void BLICancelTweens(BLITweens* tweens, BLBlockHandle handle);
+
+/*************************************************************
+* NAME: BLIGetTweenCount
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITweens* tweens -> tweens to check
+* RETURNS:
+*	BLUInt amount of tweens running
+* NOTE: N/A
+*************************************************************/
+BLUInt BLIGetTweenCount(const BLITweens* tweens);
+
+
+
+#endif
@@ -0,0 +1,670 @@
+/*************************************************************
+* FILE: ITweenSource.c
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Source file for block animation
+* CONTENTS:
+*	- Includes
+*	- Backend struct defs
+*	- File-Specifc functions
+*	- Functions
+*
+*************************************************************/
+
+#include <stdio.h>   // I/O
+#include <stdlib.h>  // For memory management
+#include <math.h>    // For rounding
+
+#include "ITween.h"  // Header
+
+/*************************************************************
+* NAME: BLITweens
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLUInt count -> amount of running tweens
+*	BLUInt cap   -> size of every tween array
+*	BLBlockHandle* handles -> block of each tween
+*	BLByte* targets -> enum BL_ITWEEN_TARGET of each tween
+*	BLByte* eases   -> enum BL_ITWEEN_EASE of each tween
+*	float* elapsed   -> time each tween has run (seconds)
+*	float* durations -> length of each tween (seconds)
+*	float* progress  -> eased progress of each tween, scratch
+*	for the current advance
+*	float* starts -> BL_ITWEEN_CHANNELS start values of each
+*	tween
+*	float* deltas -> BL_ITWEEN_CHANNELS end minus start values
+*	of each tween
+*	BLBlockHandle hovered -> block animated as hovered
+*	BLBlockHandle active  -> block animated as held
+* NOTE:
+*	Tweens are packed, finished ones are squeezed out
+*************************************************************/
+struct BLITweens
+{
+	BLUInt         count;
+	BLUInt         cap;
+	BLBlockHandle* handles;
+	BLByte*        targets;
+	BLByte*        eases;
+	float*         elapsed;
+	float*         durations;
+	float*         progress;
+	float*         starts;
+	float*         deltas;
+	BLBlockHandle  hovered;
+	BLBlockHandle  active;
+};
+
+/*************************************************************
+* NAME: BLHelperGrowArray
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	void** array -> array to grow
+*	BLUInt cap   -> new capacity (in elements)
+*	size_t elemSize -> size of each element
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static int BLHelperGrowArray(void** array, BLUInt cap, size_t elemSize)
+{
+	void* newArray = realloc(*array, (size_t)cap * elemSize);
+	if(newArray == NULL)
+	{
+		fprintf(stderr, "ITween: memory err\n");
+		return 0;
+	}
+	*array = newArray;
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLHelperGrowTweens
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITweens* tweens -> tweens to grow
+*	BLUInt need -> tweens needed
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Doubles every tween array until need fits
+*************************************************************/
+static int BLHelperGrowTweens(BLITweens* tweens, BLUInt need)
+{
+	//check if big enough
+	if(need <= tweens->cap)
+	{
+		return 1;
+	}
+
+	//get new size
+	BLUInt newCap = (tweens->cap > 0) ? tweens->cap : BL_ITWEEN_START;
+	while(newCap < need)
+	{
+		newCap *= 2;
+	}
+
+	//reallocate every array
+	if(BLHelperGrowArray((void**)&tweens->handles,   newCap, sizeof(BLBlockHandle)) == 0 ||
+	   BLHelperGrowArray((void**)&tweens->targets,   newCap, sizeof(BLByte))        == 0 ||
+	   BLHelperGrowArray((void**)&tweens->eases,     newCap, sizeof(BLByte))        == 0 ||
+	   BLHelperGrowArray((void**)&tweens->elapsed,   newCap, sizeof(float))         == 0 ||
+	   BLHelperGrowArray((void**)&tweens->durations, newCap, sizeof(float))         == 0 ||
+	   BLHelperGrowArray((void**)&tweens->progress,  newCap, sizeof(float))         == 0 ||
+	   BLHelperGrowArray((void**)&tweens->starts,    newCap, sizeof(float) * BL_ITWEEN_CHANNELS) == 0 ||
+	   BLHelperGrowArray((void**)&tweens->deltas,    newCap, sizeof(float) * BL_ITWEEN_CHANNELS) == 0)
+	{
+		return 0;
+	}
+	tweens->cap = newCap;
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLHelperStartTween
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITweens* tweens -> tweens to add to
+*	BLBlockHandle handle -> block to animate
+*	BLByte target -> enum BL_ITWEEN_TARGET to write
+*	const float* start -> BL_ITWEEN_CHANNELS start values
+*	const float* end   -> BL_ITWEEN_CHANNELS end values
+*	float duration -> length of the tween (seconds)
+*	BLByte ease -> enum BL_ITWEEN_EASE of the tween
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	A running tween with the same block and target is
+*	restarted in place
+*************************************************************/
+static int BLHelperStartTween(BLITweens* tweens, BLBlockHandle handle, BLByte target, const float* start,
+	const float* end, float duration, BLByte ease)
+{
+	//find a running tween to replace
+	BLUInt index = tweens->count;
+	for(BLUInt i = 0; i < tweens->count; i++)
+	{
+		if(tweens->handles[i] == handle && tweens->targets[i] == target)
+		{
+			index = i;
+			break;
+		}
+	}
+
+	//else add one
+	if(index == tweens->count)
+	{
+		if(BLHelperGrowTweens(tweens, tweens->count + 1) == 0)
+		{
+			return 0;
+		}
+		tweens->count++;
+	}
+
+	//fill in tween (0 length finishes on the next advance)
+	tweens->handles[index]   = handle;
+	tweens->targets[index]   = target;
+	tweens->eases[index]     = ease;
+	tweens->elapsed[index]   = 0.0f;
+	tweens->durations[index] = (duration > 1e-6f) ? duration : 1e-6f;
+	float* starts = tweens->starts + (size_t)index * BL_ITWEEN_CHANNELS;
+	float* deltas = tweens->deltas + (size_t)index * BL_ITWEEN_CHANNELS;
+	for(BLUInt c = 0; c < BL_ITWEEN_CHANNELS; c++)
+	{
+		starts[c] = start[c];
+		deltas[c] = end[c] - start[c];
+	}
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLHelperEase
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLByte ease -> enum BL_ITWEEN_EASE to use
+*	float t -> linear progress (0 to 1)
+* RETURNS:
+*	float eased progress, 0 at t = 0 and 1 at t = 1
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline float BLHelperEase(BLByte ease, float t)
+{
+	const float inv = 1.0f - t;
+	switch (ease)
+	{
+	case BL_ITWEEN_EASE_IN_QUAD:
+		return t * t;
+
+	case BL_ITWEEN_EASE_OUT_QUAD:
+		return 1.0f - inv * inv;
+
+	case BL_ITWEEN_EASE_IN_OUT_QUAD:
+		return (t < 0.5f) ? 2.0f * t * t : 1.0f - 2.0f * inv * inv;
+
+	case BL_ITWEEN_EASE_OUT_CUBIC:
+		return 1.0f - inv * inv * inv;
+
+	case BL_ITWEEN_EASE_OUT_BACK:
+		//overshoot of ~10%
+		return 1.0f + inv * inv * (1.70158f - inv * 2.70158f);
+
+	default:
+		return t;
+	}
+}
+
+/*************************************************************
+* NAME: BLHelperColorChannel
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	float value -> animated channel
+* RETURNS:
+*	BLByte of value, rounded and clamped
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline BLByte BLHelperColorChannel(float value)
+{
+	if(value <= 0.0f)
+	{
+		return 0;
+	}
+	if(value >= 255.0f)
+	{
+		return 255;
+	}
+	return (BLByte)(value + 0.5f);
+}
+
+/*************************************************************
+* NAME: BLHelperWriteTween
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITweens* tweens -> tweens to read
+*	BLUInt index -> tween to write
+*	BLBlockStore* store -> store to write into
+* RETURNS:
+*	int, 1 for success, 0 for failure (block was removed)
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static int BLHelperWriteTween(const BLITweens* tweens, BLUInt index, BLBlockStore* store)
+{
+	const BLBlockHandle handle = tweens->handles[index];
+	const float*        starts = tweens->starts + (size_t)index * BL_ITWEEN_CHANNELS;
+	const float*        deltas = tweens->deltas + (size_t)index * BL_ITWEEN_CHANNELS;
+	const float         t      = tweens->progress[index];
+
+	float value[BL_ITWEEN_CHANNELS];
+	for(BLUInt c = 0; c < BL_ITWEEN_CHANNELS; c++)
+	{
+		value[c] = starts[c] + deltas[c] * t;
+	}
+
+	switch (tweens->targets[index])
+	{
+	case BL_ITWEEN_TARGET_SCALE:
+		return BLIBlockStoreSetScale(store, handle, value[0]);
+
+	case BL_ITWEEN_TARGET_DIMS:
+		return BLIBlockStoreSetDims(store, handle, BLCreateRecti((BLInt)floorf(value[0] + 0.5f),
+			(BLInt)floorf(value[1] + 0.5f), (BLInt)floorf(value[2] + 0.5f), (BLInt)floorf(value[3] + 0.5f)));
+
+	default:
+	{
+		//colors are set in pairs, keep the other one
+		BLColor color0;
+		BLColor color1;
+		if(BLIBlockStoreGetColors(store, handle, &color0, &color1) == 0)
+		{
+			return 0;
+		}
+		const BLColor color = BLCreateColor(BLHelperColorChannel(value[0]), BLHelperColorChannel(value[1]),
+			BLHelperColorChannel(value[2]), BLHelperColorChannel(value[3]));
+		if(tweens->targets[index] == BL_ITWEEN_TARGET_COLOR0)
+		{
+			color0 = color;
+		}
+		else
+		{
+			color1 = color;
+		}
+		return BLIBlockStoreSetColors(store, handle, color0, color1);
+	}
+	}
+}
+
+/*************************************************************
+* NAME: BLHelperStateScale
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITweens* tweens -> tweens to check
+*	BLBlockHandle handle -> block to check
+*	float hoverScale -> scale of the hovered block
+*	float clickScale -> scale of the held block
+* RETURNS:
+*	float scale the block should animate to
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static inline float BLHelperStateScale(const BLITweens* tweens, BLBlockHandle handle, float hoverScale, float clickScale)
+{
+	if(handle == tweens->active)
+	{
+		return clickScale;
+	}
+	if(handle == tweens->hovered)
+	{
+		return hoverScale;
+	}
+	return 1.0f;
+}
+
+/*************************************************************
+* NAME: BLICreateTweens
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt capacity -> tweens to make room for, 0 for
+*	BL_ITWEEN_START
+* RETURNS:
+*	BLITweens* created (empty), NULL for failure
+* NOTE: N/A
+*************************************************************/
+BLITweens* BLICreateTweens(BLUInt capacity)
+{
+	BLITweens* tweens = calloc(1, sizeof(BLITweens));
+	if(tweens == NULL)
+	{
+		fprintf(stderr, "ITween: memory err\n");
+		return NULL;
+	}
+	tweens->hovered = BL_BLOCK_HANDLE_NONE;
+	tweens->active  = BL_BLOCK_HANDLE_NONE;
+
+	//make room up front
+	if(BLHelperGrowTweens(tweens, (capacity > 0) ? capacity : BL_ITWEEN_START) == 0)
+	{
+		BLIDestroyTweens(tweens);
+		return NULL;
+	}
+
+	//end
+	return tweens;
+}
+
+/*************************************************************
+* NAME: BLIDestroyTweens
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITweens* tweens -> tweens to free
+* RETURNS:
+*	void
+* NOTE:
+*	Blocks keep the last values written
+*************************************************************/
+void BLIDestroyTweens(BLITweens* tweens)
+{
+	if(tweens == NULL)
+	{
+		return;
+	}
+
+	free(tweens->handles);
+	free(tweens->targets);
+	free(tweens->eases);
+	free(tweens->elapsed);
+	free(tweens->durations);
+	free(tweens->progress);
+	free(tweens->starts);
+	free(tweens->deltas);
+	free(tweens);
+}
+
+/*************************************************************
+* NAME: BLITweenScale
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITweens* tweens -> tweens to add to
+*	BLBlockStore* store -> store holding the block
+*	BLBlockHandle handle -> block to animate
+*	float scale -> scale to end at
+*	float duration -> length of the tween (seconds)
+*	enum BL_ITWEEN_EASE ease -> easing curve
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	Starts from the block's current scale. A running scale
+*	tween on the block is replaced, so it turns around
+*	smoothly
+*************************************************************/
+int BLITweenScale(BLITweens* tweens, BLBlockStore* store, BLBlockHandle handle, float scale, float duration,
+	enum BL_ITWEEN_EASE ease)
+{
+	if(tweens == NULL || BLIBlockStoreIsValid(store, handle) == 0)
+	{
+		return 0;
+	}
+
+	const float start[BL_ITWEEN_CHANNELS] = { BLIBlockStoreGetScale(store, handle), 0.0f, 0.0f, 0.0f };
+	const float end[BL_ITWEEN_CHANNELS]   = { scale, 0.0f, 0.0f, 0.0f };
+	return BLHelperStartTween(tweens, handle, BL_ITWEEN_TARGET_SCALE, start, end, duration, (BLByte)ease);
+}
+
+/*************************************************************
+* NAME: BLITweenDims
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITweens* tweens -> tweens to add to
+*	BLBlockStore* store -> store holding the block
+*	BLBlockHandle handle -> block to animate
+*	BLRecti dims -> dims to end at
+*	float duration -> length of the tween (seconds)
+*	enum BL_ITWEEN_EASE ease -> easing curve
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	Starts from the block's current dims, replaces a running
+*	dims tween on the block
+*************************************************************/
+int BLITweenDims(BLITweens* tweens, BLBlockStore* store, BLBlockHandle handle, BLRecti dims, float duration,
+	enum BL_ITWEEN_EASE ease)
+{
+	BLBlock block;
+	if(tweens == NULL || BLIBlockStoreGet(store, handle, &block) == 0)
+	{
+		return 0;
+	}
+
+	const float start[BL_ITWEEN_CHANNELS] = { (float)block.bDims.X, (float)block.bDims.Y,
+		(float)block.bDims.W, (float)block.bDims.H };
+	const float end[BL_ITWEEN_CHANNELS]   = { (float)dims.X, (float)dims.Y, (float)dims.W, (float)dims.H };
+	return BLHelperStartTween(tweens, handle, BL_ITWEEN_TARGET_DIMS, start, end, duration, (BLByte)ease);
+}
+
+/*************************************************************
+* NAME: BLITweenColor
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITweens* tweens -> tweens to add to
+*	BLBlockStore* store -> store holding the block
+*	BLBlockHandle handle -> block to animate
+*	enum BL_ITWEEN_TARGET target -> BL_ITWEEN_TARGET_COLOR0
+*	or BL_ITWEEN_TARGET_COLOR1
+*	BLColor color -> color to end at
+*	float duration -> length of the tween (seconds)
+*	enum BL_ITWEEN_EASE ease -> easing curve
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	Starts from the block's current color, replaces a
+*	running tween of the same color on the block
+*************************************************************/
+int BLITweenColor(BLITweens* tweens, BLBlockStore* store, BLBlockHandle handle, enum BL_ITWEEN_TARGET target,
+	BLColor color, float duration, enum BL_ITWEEN_EASE ease)
+{
+	BLColor color0;
+	BLColor color1;
+	if(tweens == NULL || (target != BL_ITWEEN_TARGET_COLOR0 && target != BL_ITWEEN_TARGET_COLOR1) ||
+	   BLIBlockStoreGetColors(store, handle, &color0, &color1) == 0)
+	{
+		return 0;
+	}
+
+	const BLColor from = (target == BL_ITWEEN_TARGET_COLOR0) ? color0 : color1;
+	const float start[BL_ITWEEN_CHANNELS] = { from.R, from.G, from.B, from.A };
+	const float end[BL_ITWEEN_CHANNELS]   = { color.R, color.G, color.B, color.A };
+	return BLHelperStartTween(tweens, handle, (BLByte)target, start, end, duration, (BLByte)ease);
+}
+
+/*************************************************************
+* NAME: BLITweenHitState
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITweens* tweens -> tweens to add to
+*	BLBlockStore* store -> store the grid's blocks are in
+*	const BLIHitGrid* grid -> hit grid the blocks were added
+*	to with BLIAddBlockStoreHits
+*	float hoverScale -> scale of the hovered block
+*	float clickScale -> scale of the held block
+*	float duration -> length of each tween (seconds)
+*	enum BL_ITWEEN_EASE ease -> easing curve
+* RETURNS:
+*	void
+* NOTE:
+*	Animated version of BLIBlockStoreSetHitState. Only blocks
+*	that gain or lose hover or click get a scale tween. Leave
+*	the store's state scales at 1 when using this. Call
+*	after BLIHitGridEnd
+*************************************************************/
+void BLITweenHitState(BLITweens* tweens, BLBlockStore* store, const BLIHitGrid* grid, float hoverScale,
+	float clickScale, float duration, enum BL_ITWEEN_EASE ease)
+{
+	if(tweens == NULL || store == NULL || grid == NULL)
+	{
+		return;
+	}
+
+	//keys that aren't live handles count as nothing
+	BLBlockHandle hovered = BLIHitGridGetHovered(grid);
+	BLBlockHandle active  = BLIHitGridGetActive(grid);
+	if(BLIBlockStoreIsValid(store, hovered) == 0)
+	{
+		hovered = BL_BLOCK_HANDLE_NONE;
+	}
+	if(BLIBlockStoreIsValid(store, active) == 0)
+	{
+		active = BL_BLOCK_HANDLE_NONE;
+	}
+	if(hovered == tweens->hovered && active == tweens->active)
+	{
+		return;
+	}
+
+	//animate every block whose state changed
+	const BLBlockHandle changed[4] = { tweens->hovered, tweens->active, hovered, active };
+	tweens->hovered = hovered;
+	tweens->active  = active;
+	for(BLUInt i = 0; i < 4; i++)
+	{
+		if(changed[i] != BL_BLOCK_HANDLE_NONE)
+		{
+			BLITweenScale(tweens, store, changed[i], BLHelperStateScale(tweens, changed[i], hoverScale, clickScale),
+				duration, ease);
+		}
+	}
+}
+
+/*************************************************************
+* NAME: BLIAdvanceTweens
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITweens* tweens -> tweens to advance
+*	BLBlockStore* store -> store to write into
+*	float delta -> time since the last advance (seconds)
+* RETURNS:
+*	BLUInt amount of tweens still running
+* NOTE:
+*	Call once a frame before rendering the store. Finished
+*	tweens write their end value and are thrown out, tweens
+*	on removed blocks are dropped
+*************************************************************/
+BLUInt BLIAdvanceTweens(BLITweens* tweens, BLBlockStore* store, float delta)
+{
+	if(tweens == NULL || tweens->count == 0)
+	{
+		return 0;
+	}
+	const BLUInt count = tweens->count;
+
+	//step every clock in one pass over the packed arrays
+	float*       elapsed   = tweens->elapsed;
+	float*       progress  = tweens->progress;
+	const float* durations = tweens->durations;
+	for(BLUInt i = 0; i < count; i++)
+	{
+		elapsed[i] += delta;
+		const float t = elapsed[i] / durations[i];
+		progress[i] = (t < 1.0f) ? t : 1.0f;
+	}
+
+	//ease
+	for(BLUInt i = 0; i < count; i++)
+	{
+		progress[i] = BLHelperEase(tweens->eases[i], progress[i]);
+	}
+
+	//write into blocks and squeeze out finished tweens
+	BLUInt kept = 0;
+	for(BLUInt i = 0; i < count; i++)
+	{
+		if(BLHelperWriteTween(tweens, i, store) == 0 || elapsed[i] >= durations[i])
+		{
+			continue;
+		}
+		if(kept != i)
+		{
+			tweens->handles[kept]   = tweens->handles[i];
+			tweens->targets[kept]   = tweens->targets[i];
+			tweens->eases[kept]     = tweens->eases[i];
+			tweens->elapsed[kept]   = tweens->elapsed[i];
+			tweens->durations[kept] = tweens->durations[i];
+			for(BLUInt c = 0; c < BL_ITWEEN_CHANNELS; c++)
+			{
+				tweens->starts[(size_t)kept * BL_ITWEEN_CHANNELS + c] = tweens->starts[(size_t)i * BL_ITWEEN_CHANNELS + c];
+				tweens->deltas[(size_t)kept * BL_ITWEEN_CHANNELS + c] = tweens->deltas[(size_t)i * BL_ITWEEN_CHANNELS + c];
+			}
+		}
+		kept++;
+	}
+	tweens->count = kept;
+
+	//end
+	return kept;
+}
+
+/*************************************************************
+* NAME: BLICancelTweens
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLITweens* tweens -> tweens to edit
+*	BLBlockHandle handle -> block to stop animating
+* RETURNS:
+*	void
+* NOTE:
+*	The block keeps the last values written
+*************************************************************/
+void BLICancelTweens(BLITweens* tweens, BLBlockHandle handle)
+{
+	if(tweens == NULL)
+	{
+		return;
+	}
+
+	//swap the last tween into each hole
+	BLUInt i = 0;
+	while(i < tweens->count)
+	{
+		if(tweens->handles[i] != handle)
+		{
+			i++;
+			continue;
+		}
+
+		const BLUInt last = --tweens->count;
+		tweens->handles[i]   = tweens->handles[last];
+		tweens->targets[i]   = tweens->targets[last];
+		tweens->eases[i]     = tweens->eases[last];
+		tweens->elapsed[i]   = tweens->elapsed[last];
+		tweens->durations[i] = tweens->durations[last];
+		for(BLUInt c = 0; c < BL_ITWEEN_CHANNELS; c++)
+		{
+			tweens->starts[(size_t)i * BL_ITWEEN_CHANNELS + c] = tweens->starts[(size_t)last * BL_ITWEEN_CHANNELS + c];
+			tweens->deltas[(size_t)i * BL_ITWEEN_CHANNELS + c] = tweens->deltas[(size_t)last * BL_ITWEEN_CHANNELS + c];
+		}
+	}
+}
+
+/*************************************************************
+* NAME: BLIGetTweenCount
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLITweens* tweens -> tweens to check
+* RETURNS:
+*	BLUInt amount of tweens running
+* NOTE: N/A
+*************************************************************/
+BLUInt BLIGetTweenCount(const BLITweens* tweens)
+{
+	return (tweens != NULL) ? tweens->count : 0;
+}
\ No newline at end of file
@@ -24,6 +24,18 @@
 #define BL_WINDOW_COUNT_MAX 16
 #define BL_WINDOW_ERRHANDLE -1
 
+#define BL_WINDOW_EVENT_QUEUE_SIZE 0x100 // events held per window between updates (power of 2)
+#define BL_WINDOW_KEY_COUNT        0x160 // key codes tracked (GLFW_KEY_LAST fits)
+#define BL_WINDOW_KEYS_DOWN_MAX    0x10  // keys tracked as held at once
+#define BL_WINDOW_BUTTON_COUNT     8     // mouse buttons tracked
+#define BL_WINDOW_REPEAT_DELAY     0.5   // default seconds before a held key repeats
+#define BL_WINDOW_REPEAT_RATE      30.0  // default key repeats per second
+
+#define BL_WINDOW_RECORD_MAGIC     "BLIR" // first bytes of an input recording
+#define BL_WINDOW_RECORD_VERSION   1
+#define BL_WINDOW_RECORD_EVENT_MAX 13     // bytes of the largest recorded event
+#define BL_WINDOW_RECORD_FRAME_MAX (10 + (BL_WINDOW_EVENT_QUEUE_SIZE + BL_WINDOW_KEYS_DOWN_MAX + BL_WINDOW_BUTTON_COUNT + 1) * BL_WINDOW_RECORD_EVENT_MAX)
+
 typedef int16_t BLWindowHandle;
 
 /*************************************************************
@@ -42,6 +54,91 @@ enum BL_WINDOW_TYPE
 	BL_WINDOW_TYPE_BORDERLESS_AND_TRANSPARENT = 4
 };
 
+/*************************************************************
+* NAME: BL_INPUT_EVENT_TYPE
+* DATE: 2026 - 10 - 19
+* NOTE: Type of a BLInputEvent
+*************************************************************/
+enum BL_INPUT_EVENT_TYPE
+{
+	BL_INPUT_EVENT_KEY = 0,
+	BL_INPUT_EVENT_CHAR = 1,
+	BL_INPUT_EVENT_BUTTON = 2,
+	BL_INPUT_EVENT_CURSOR = 3
+};
+
+/*************************************************************
+* NAME: BL_INPUT_ACTION
+* DATE: 2026 - 10 - 19
+* NOTE: Same values as GLFW_RELEASE, GLFW_PRESS and
+*	GLFW_REPEAT
+*************************************************************/
+enum BL_INPUT_ACTION
+{
+	BL_INPUT_ACTION_RELEASE = 0,
+	BL_INPUT_ACTION_PRESS = 1,
+	BL_INPUT_ACTION_REPEAT = 2
+};
+
+/*************************************************************
+* NAME: BLInputEvent
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	enum BL_INPUT_EVENT_TYPE type -> type of event
+*	double time -> time of event (in seconds, glfwGetTime)
+*	BLInt code   -> GLFW key, codepoint or GLFW mouse button
+*	BLInt action -> enum BL_INPUT_ACTION (keys and buttons)
+*	BLInt mods   -> GLFW modifier bits (keys and buttons)
+*	BLVert2f pos -> cursor position (cursor events, window
+*	space with the origin top left)
+* NOTE: N/A
+*************************************************************/
+typedef struct BLInputEvent
+{
+	enum BL_INPUT_EVENT_TYPE type;
+	double   time;
+	BLInt    code;
+	BLInt    action;
+	BLInt    mods;
+	BLVert2f pos;
+}BLInputEvent;
+
+/*************************************************************
+* NAME: BLInputFrame
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLInputEvent events[] -> events since the last update,
+*	oldest first
+*	BLUInt eventCount -> amount of events
+*	BLUInt dropped    -> events lost to a full queue (total)
+*	BLByte keyDown[]  -> 1 for each GLFW key held down
+*	BLShort keysDown[] -> GLFW keys held down, oldest first
+*	BLUInt keysDownCount -> amount of keysDown
+*	BLByte buttonDown[] -> 1 for each mouse button held down
+*	BLVert2f mousePos -> latest cursor position
+*	BLInt mods -> latest GLFW modifier bits
+*	double time -> time of the update (in seconds)
+*	BLUInt updateCount -> updates so far, tells snapshots apart
+* NOTE:
+*	Snapshot of one window's input, rebuilt by BLWindowUpdate.
+*	Held keys repeat as BL_INPUT_ACTION_REPEAT key events, made
+*	by the update from timestamps (see BLWindowSetKeyRepeat)
+*************************************************************/
+typedef struct BLInputFrame
+{
+	BLInputEvent events[BL_WINDOW_EVENT_QUEUE_SIZE];
+	BLUInt       eventCount;
+	BLUInt       dropped;
+	BLByte       keyDown[BL_WINDOW_KEY_COUNT];
+	BLShort      keysDown[BL_WINDOW_KEYS_DOWN_MAX];
+	BLUInt       keysDownCount;
+	BLByte       buttonDown[BL_WINDOW_BUTTON_COUNT];
+	BLVert2f     mousePos;
+	BLInt        mods;
+	double       time;
+	BLUInt       updateCount;
+}BLInputFrame;
+
 /*************************************************************
 * NAME: BLInitWCore
 * DATE: 2021 - 08 - 29
@@ -210,10 +307,122 @@ int BLWindowShouldClose(BLWindowHandle winHndl);
 *	void
 * NOTE:
 *	To update all window states, it is recommended that this
-*	function is called
+*	function is called. Also rebuilds every window's input
+*	snapshot from its queued events and key repeats
 *************************************************************/
 void BLWindowUpdate( );
 
+/*************************************************************
+* NAME: BLWindowSetKeyRepeat
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	double delay -> seconds a key is held before it repeats
+*	double rate  -> repeats per second, 0 for no repeat
+* RETURNS:
+*	void
+* NOTE:
+*	Applies to every window. Defaults to BL_WINDOW_REPEAT_DELAY
+*	and BL_WINDOW_REPEAT_RATE. Only the latest pressed key
+*	repeats, and the OS's own key repeats are ignored
+*************************************************************/
+void BLWindowSetKeyRepeat(double delay, double rate);
+
+/*************************************************************
+* NAME: BLWindowPushEvent
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLWindowHandle winHndl -> window the event belongs to
+*	BLInputEvent event -> event to queue
+* RETURNS:
+*	int, 1 for success, 0 if the queue was full (event
+*	dropped)
+* NOTE:
+*	GLFW callbacks queue through this, it can also be used to
+*	drive input without a real window. Lock free for one
+*	pushing thread per window. Events show up in the window's
+*	snapshot on the next BLWindowUpdate
+*************************************************************/
+int BLWindowPushEvent(BLWindowHandle winHndl, BLInputEvent event);
+
+/*************************************************************
+* NAME: BLWindowStartRecording
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLWindowHandle winHndl -> window to record input of
+*	const char* filePath -> file to record to (overwritten)
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	Every BLWindowUpdate after this writes the window's
+*	snapshot to filePath, until BLWindowStopRecording.
+*	Frames are stored as their time and events, in native
+*	byte order
+*************************************************************/
+int BLWindowStartRecording(BLWindowHandle winHndl, const char* filePath);
+
+/*************************************************************
+* NAME: BLWindowStopRecording
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLWindowHandle winHndl -> window to stop recording
+* RETURNS:
+*	void
+* NOTE: N/A
+*************************************************************/
+void BLWindowStopRecording(BLWindowHandle winHndl);
+
+/*************************************************************
+* NAME: BLWindowStartReplay
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLWindowHandle winHndl -> window to replay input to
+*	const char* filePath -> file from BLWindowStartRecording
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	Clears the window's held input, then every BLWindowUpdate
+*	takes the next recorded frame (time included) instead of
+*	live input. Stops by itself at the end of the file. Works
+*	without a real window, so ICore can be driven headless
+*************************************************************/
+int BLWindowStartReplay(BLWindowHandle winHndl, const char* filePath);
+
+/*************************************************************
+* NAME: BLWindowStopReplay
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLWindowHandle winHndl -> window to stop replaying
+* RETURNS:
+*	void
+* NOTE:
+*	Live input carries on from the replayed state
+*************************************************************/
+void BLWindowStopReplay(BLWindowHandle winHndl);
+
+/*************************************************************
+* NAME: BLWindowIsReplaying
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLWindowHandle winHndl -> window to check
+* RETURNS:
+*	int, 1 if replaying, 0 if not
+* NOTE: N/A
+*************************************************************/
+int BLWindowIsReplaying(BLWindowHandle winHndl);
+
+/*************************************************************
+* NAME: BLWindowGetInput
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLWindowHandle winHndl -> window to get input of
+* RETURNS:
+*	const BLInputFrame* snapshot of the window's input (an
+*	empty snapshot for an invalid handle)
+* NOTE:
+*	Stays the same until the next BLWindowUpdate
+*************************************************************/
+const BLInputFrame* BLWindowGetInput(BLWindowHandle winHndl);
+
 /*************************************************************
 * NAME: BLWindowSwapBuffers
 * DATE: 2021 - 08 - 29
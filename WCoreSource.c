@@ -17,6 +17,7 @@
 
 #include <stdio.h>   // I/O
 #include <stdlib.h>  // For memory management
+#include <string.h>  // For memset
 
 #include <glfw3.h>   // For window management
 
@@ -25,6 +26,45 @@
 
 #include "WCore.h"   // Header
 
+/*************************************************************
+* NAME: BLWindowInput
+* DATE: 2026 - 10 - 19
+* MEMBERS:
+*	BLInputEvent queue[] -> ring buffer of pushed events
+*	volatile LONG head -> events pushed (written by the pusher)
+*	volatile LONG tail -> events taken (written by the update)
+*	volatile LONG dropped -> events pushed to a full queue
+*	BLInt repeatKey -> GLFW key to repeat, -1 for none
+*	double repeatNext -> time of the next repeat
+*	FILE* recordFile -> file snapshots are recorded to, or NULL
+*	FILE* replayFile -> file snapshots are replayed from, or
+*	NULL
+*	int recordStart -> 1 until the first frame is recorded
+*	recordStart... -> held state when recording started
+*	BLInputFrame frame -> snapshot read by ICore
+* NOTE:
+*	Single producer, single consumer. head and tail only ever
+*	count up, the slot is the count masked by the queue size
+*************************************************************/
+typedef struct BLWindowInput
+{
+	BLInputEvent  queue[BL_WINDOW_EVENT_QUEUE_SIZE];
+	volatile LONG head;
+	volatile LONG tail;
+	volatile LONG dropped;
+	BLInt         repeatKey;
+	double        repeatNext;
+	FILE*         recordFile;
+	FILE*         replayFile;
+	int           recordStart;
+	BLShort       recordStartKeyArr[BL_WINDOW_KEYS_DOWN_MAX];
+	BLUInt        recordStartKeys;
+	BLByte        recordStartButtons[BL_WINDOW_BUTTON_COUNT];
+	BLVert2f      recordStartPos;
+	BLInt         recordStartMods;
+	BLInputFrame  frame;
+}BLWindowInput;
+
 /*************************************************************
 * NAME: BLWindowList
 * DATE: 2021 - 08 - 29
@@ -38,6 +78,9 @@ typedef struct BLWindowList
 {
 	BLUInt         windowCount;
 	GLFWwindow*    glWinArr[BL_WINDOW_COUNT_MAX];
+	BLWindowInput  inputArr[BL_WINDOW_COUNT_MAX];
+	double         repeatDelay;
+	double         repeatRate;
 }BLWindowList;
 
 /*************************************************************
@@ -50,6 +93,519 @@ typedef struct BLWindowList
 *************************************************************/
 static BLWindowList* windowList = NULL;
 
+/*************************************************************
+* NAME: emptyFrame (object)
+* DATE: 2026 - 10 - 19
+* USE:
+*	Returned by BLWindowGetInput for invalid handles so that
+*	callers never get NULL
+* NOTE: N/A
+*************************************************************/
+static const BLInputFrame emptyFrame = { 0 };
+
+/*************************************************************
+* NAME: BLHelperPushInputEvent
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLWindowInput* input -> window input to queue to
+*	BLInputEvent event -> event to queue
+* RETURNS:
+*	int, 1 for success, 0 if the queue was full
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	The slot is written before head is published, so the
+*	update never reads a half written event
+*************************************************************/
+static int BLHelperPushInputEvent(BLWindowInput* input, BLInputEvent event)
+{
+	const LONG head = input->head;
+	const LONG tail = input->tail;
+	MemoryBarrier( );
+
+	//check if full
+	if((BLUInt)(head - tail) >= BL_WINDOW_EVENT_QUEUE_SIZE)
+	{
+		InterlockedExchange(&input->dropped, input->dropped + 1);
+		return 0;
+	}
+
+	//write slot, then publish
+	input->queue[(BLUInt)head & (BL_WINDOW_EVENT_QUEUE_SIZE - 1)] = event;
+	InterlockedExchange(&input->head, head + 1);
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLHelperSetKeyDown
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLInputFrame* frame -> snapshot to change
+*	BLInt key -> GLFW key
+*	int down -> 1 for pressed, 0 for released
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Keeps keysDown in press order
+*************************************************************/
+static void BLHelperSetKeyDown(BLInputFrame* frame, BLInt key, int down)
+{
+	//unknown keys aren't tracked
+	if(key < 0 || key >= BL_WINDOW_KEY_COUNT || frame->keyDown[key] == (BLByte)down)
+	{
+		return;
+	}
+	frame->keyDown[key] = (BLByte)down;
+
+	//released, remove from list
+	if(down == 0)
+	{
+		for(BLUInt i = 0; i < frame->keysDownCount; i++)
+		{
+			if(frame->keysDown[i] == (BLShort)key)
+			{
+				memmove(frame->keysDown + i, frame->keysDown + i + 1, (frame->keysDownCount - i - 1) * sizeof(BLShort));
+				frame->keysDownCount--;
+				break;
+			}
+		}
+		return;
+	}
+
+	//pressed, add to list (dropping the oldest if full)
+	if(frame->keysDownCount == BL_WINDOW_KEYS_DOWN_MAX)
+	{
+		memmove(frame->keysDown, frame->keysDown + 1, (BL_WINDOW_KEYS_DOWN_MAX - 1) * sizeof(BLShort));
+		frame->keysDownCount--;
+	}
+	frame->keysDown[frame->keysDownCount++] = (BLShort)key;
+}
+
+/*************************************************************
+* NAME: BLHelperApplyEvent
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLWindowInput* input -> window input to change
+*	BLInputEvent event -> event to apply
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Adds event to the snapshot (if there's room) and updates
+*	held keys, buttons, the cursor and the key to repeat
+*************************************************************/
+static void BLHelperApplyEvent(BLWindowInput* input, BLInputEvent event)
+{
+	BLInputFrame* frame = &input->frame;
+	if(frame->eventCount < BL_WINDOW_EVENT_QUEUE_SIZE)
+	{
+		frame->events[frame->eventCount++] = event;
+	}
+
+	switch (event.type)
+	{
+	case BL_INPUT_EVENT_KEY:
+		if(event.action == BL_INPUT_ACTION_PRESS)
+		{
+			input->repeatKey  = event.code;
+			input->repeatNext = event.time + windowList->repeatDelay;
+		}
+		else if(event.action == BL_INPUT_ACTION_RELEASE && event.code == input->repeatKey)
+		{
+			input->repeatKey = -1;
+		}
+		if(event.action != BL_INPUT_ACTION_REPEAT)
+		{
+			BLHelperSetKeyDown(frame, event.code, event.action == BL_INPUT_ACTION_PRESS);
+		}
+		frame->mods = event.mods;
+		break;
+
+	case BL_INPUT_EVENT_BUTTON:
+		if(event.code >= 0 && event.code < BL_WINDOW_BUTTON_COUNT)
+		{
+			frame->buttonDown[event.code] = (event.action != BL_INPUT_ACTION_RELEASE);
+		}
+		frame->mods = event.mods;
+		break;
+
+	case BL_INPUT_EVENT_CURSOR:
+		frame->mousePos = event.pos;
+		break;
+
+	default:
+		break;
+	}
+}
+
+/*************************************************************
+* NAME: BLHelperRepeatKey
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLWindowInput* input -> window input to change
+*	double now -> time of the update (in seconds)
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Adds one repeat event per repeat due, each stamped with
+*	the time it was due
+*************************************************************/
+static void BLHelperRepeatKey(BLWindowInput* input, double now)
+{
+	BLInputFrame* frame = &input->frame;
+	if(input->repeatKey < 0 || windowList->repeatRate <= 0.0)
+	{
+		return;
+	}
+
+	const double period = 1.0 / windowList->repeatRate;
+	while(input->repeatNext <= now && frame->eventCount < BL_WINDOW_EVENT_QUEUE_SIZE)
+	{
+		BLInputEvent event = { .type = BL_INPUT_EVENT_KEY, .time = input->repeatNext, .code = input->repeatKey,
+		                       .action = BL_INPUT_ACTION_REPEAT, .mods = frame->mods };
+		frame->events[frame->eventCount++] = event;
+		input->repeatNext += period;
+	}
+
+	//too far behind, skip the rest
+	if(input->repeatNext <= now)
+	{
+		input->repeatNext = now + period;
+	}
+}
+
+/*************************************************************
+* NAME: BLHelperWriteEvent
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLByte* dest -> buffer to write to
+*	const BLInputEvent* event -> event to write
+*	double frameTime -> time of the frame event belongs to
+* RETURNS:
+*	BLUInt, bytes written
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Cursor events are type, time and position. Others are
+*	type, action, mods, code and time. Time is stored as a
+*	float offset from frameTime
+*************************************************************/
+static BLUInt BLHelperWriteEvent(BLByte* dest, const BLInputEvent* event, double frameTime)
+{
+	const float   offset = (float)(event->time - frameTime);
+	const int32_t code   = (int32_t)event->code;
+	BLByte* write = dest;
+
+	*write++ = (BLByte)event->type;
+	if(event->type != BL_INPUT_EVENT_CURSOR)
+	{
+		*write++ = (BLByte)event->action;
+		*write++ = (BLByte)event->mods;
+		memcpy(write, &code, sizeof(code));
+		write += sizeof(code);
+	}
+	memcpy(write, &offset, sizeof(offset));
+	write += sizeof(offset);
+	if(event->type == BL_INPUT_EVENT_CURSOR)
+	{
+		memcpy(write, &event->pos.X, sizeof(float));
+		memcpy(write + sizeof(float), &event->pos.Y, sizeof(float));
+		write += sizeof(float) * 2;
+	}
+
+	//end
+	return (BLUInt)(write - dest);
+}
+
+/*************************************************************
+* NAME: BLHelperWriteFrame
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLWindowInput* input -> window input being recorded
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Writes the frame time, event count and events. The first
+*	frame also starts with presses for whatever was held when
+*	recording started, so replay starts from the same state
+*************************************************************/
+static void BLHelperWriteFrame(BLWindowInput* input)
+{
+	static BLByte buffer[BL_WINDOW_RECORD_FRAME_MAX];
+	const BLInputFrame* frame = &input->frame;
+	BLUInt   size  = sizeof(double) + sizeof(uint16_t);
+	uint16_t count = 0;
+
+	//held state from before recording
+	if(input->recordStart)
+	{
+		BLInputEvent event = { .type = BL_INPUT_EVENT_CURSOR, .time = frame->time, .pos = input->recordStartPos };
+		size += BLHelperWriteEvent(buffer + size, &event, frame->time);
+		count++;
+
+		for(BLUInt i = 0; i < input->recordStartKeys; i++)
+		{
+			BLInputEvent key = { .type = BL_INPUT_EVENT_KEY, .time = frame->time, .code = input->recordStartKeyArr[i],
+			                     .action = BL_INPUT_ACTION_PRESS, .mods = input->recordStartMods };
+			size += BLHelperWriteEvent(buffer + size, &key, frame->time);
+			count++;
+		}
+		for(BLInt i = 0; i < BL_WINDOW_BUTTON_COUNT; i++)
+		{
+			if(input->recordStartButtons[i])
+			{
+				BLInputEvent button = { .type = BL_INPUT_EVENT_BUTTON, .time = frame->time, .code = i,
+				                        .action = BL_INPUT_ACTION_PRESS, .mods = input->recordStartMods };
+				size += BLHelperWriteEvent(buffer + size, &button, frame->time);
+				count++;
+			}
+		}
+		input->recordStart = 0;
+	}
+
+	//this frame's events
+	for(BLUInt i = 0; i < frame->eventCount; i++)
+	{
+		size += BLHelperWriteEvent(buffer + size, &frame->events[i], frame->time);
+		count++;
+	}
+
+	//frame header, then write all at once
+	memcpy(buffer, &frame->time, sizeof(double));
+	memcpy(buffer + sizeof(double), &count, sizeof(uint16_t));
+	if(fwrite(buffer, 1, size, input->recordFile) != size)
+	{
+		fprintf(stderr, "Failed to write input recording!\n");
+	}
+}
+
+/*************************************************************
+* NAME: BLHelperReadFrame
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLWindowInput* input -> window input being replayed
+* RETURNS:
+*	int, 1 for success, 0 for end of file or bad data
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Applies the recorded events the same way as live ones and
+*	sets the frame time to the recorded time
+*************************************************************/
+static int BLHelperReadFrame(BLWindowInput* input)
+{
+	FILE* file = input->replayFile;
+	double   time;
+	uint16_t count;
+
+	//frame header
+	if(fread(&time, sizeof(double), 1, file) != 1 || fread(&count, sizeof(uint16_t), 1, file) != 1)
+	{
+		return 0;
+	}
+
+	//events
+	for(BLUInt i = 0; i < count; i++)
+	{
+		BLInputEvent event = { 0 };
+		BLByte  type;
+		BLByte  keyData[2];
+		int32_t code   = 0;
+		float   offset = 0.0f;
+
+		if(fread(&type, 1, 1, file) != 1 || type > BL_INPUT_EVENT_CURSOR)
+		{
+			fprintf(stderr, "Input recording is corrupt!\n");
+			return 0;
+		}
+		event.type = (enum BL_INPUT_EVENT_TYPE)type;
+
+		if(event.type != BL_INPUT_EVENT_CURSOR)
+		{
+			if(fread(keyData, 1, 2, file) != 2 || fread(&code, sizeof(code), 1, file) != 1)
+			{
+				return 0;
+			}
+			event.action = keyData[0];
+			event.mods   = keyData[1];
+			event.code   = code;
+		}
+		if(fread(&offset, sizeof(offset), 1, file) != 1)
+		{
+			return 0;
+		}
+		if(event.type == BL_INPUT_EVENT_CURSOR && (fread(&event.pos.X, sizeof(float), 1, file) != 1 || fread(&event.pos.Y, sizeof(float), 1, file) != 1))
+		{
+			return 0;
+		}
+		event.time = time + offset;
+
+		BLHelperApplyEvent(input, event);
+	}
+
+	//end
+	input->frame.time = time;
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLHelperUpdateInput
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLWindowInput* input -> window input to update
+*	double now -> time of the update (in seconds)
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Takes every queued event into the snapshot. Held keys,
+*	buttons and the cursor carry over from the last snapshot,
+*	so cost is O(events), not O(keys). While replaying, queued
+*	events are thrown away and the next recorded frame is used
+*************************************************************/
+static void BLHelperUpdateInput(BLWindowInput* input, double now)
+{
+	BLInputFrame* frame = &input->frame;
+	const LONG tail = input->tail;
+	const LONG head = input->head;
+	MemoryBarrier( );
+
+	//take events
+	frame->eventCount = 0;
+	for(LONG i = tail; i != head && input->replayFile == NULL; i++)
+	{
+		BLHelperApplyEvent(input, input->queue[(BLUInt)i & (BL_WINDOW_EVENT_QUEUE_SIZE - 1)]);
+	}
+
+	//free slots
+	MemoryBarrier( );
+	InterlockedExchange(&input->tail, head);
+	frame->dropped = (BLUInt)input->dropped;
+
+	//replay recorded frame, or repeat held key
+	if(input->replayFile != NULL)
+	{
+		if(BLHelperReadFrame(input) == 0)
+		{
+			fclose(input->replayFile);
+			input->replayFile = NULL;
+			frame->time = now;
+		}
+	}
+	else
+	{
+		BLHelperRepeatKey(input, now);
+		frame->time = now;
+	}
+
+	//record
+	if(input->recordFile != NULL)
+	{
+		BLHelperWriteFrame(input);
+	}
+
+	frame->updateCount++;
+}
+
+/*************************************************************
+* NAME: BLHelperFindWindow
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	GLFWwindow* glWin -> GLFW window to find
+* RETURNS:
+*	BLWindowHandle of glWin, BL_WINDOW_ERRHANDLE if not found
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static BLWindowHandle BLHelperFindWindow(GLFWwindow* glWin)
+{
+	for(int i = 0; i < BL_WINDOW_COUNT_MAX; i++)
+	{
+		if(windowList->glWinArr[i] == glWin)
+		{
+			return (BLWindowHandle)i;
+		}
+	}
+	return BL_WINDOW_ERRHANDLE;
+}
+
+/*************************************************************
+* NAME: BLHelperKeyCallback
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	GLFW key callback params
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static void BLHelperKeyCallback(GLFWwindow* glWin, int key, int scancode, int action, int mods)
+{
+	(void)scancode;
+
+	//repeats are timed by BLWindowUpdate instead of the OS
+	if(action == GLFW_REPEAT)
+	{
+		return;
+	}
+
+	BLInputEvent event = { .type = BL_INPUT_EVENT_KEY, .time = glfwGetTime( ), .code = key,
+	                       .action = action, .mods = mods };
+	BLWindowPushEvent(BLHelperFindWindow(glWin), event);
+}
+
+/*************************************************************
+* NAME: BLHelperCharCallback
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	GLFW char callback params
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static void BLHelperCharCallback(GLFWwindow* glWin, unsigned int codepoint)
+{
+	BLInputEvent event = { .type = BL_INPUT_EVENT_CHAR, .time = glfwGetTime( ), .code = (BLInt)codepoint };
+	BLWindowPushEvent(BLHelperFindWindow(glWin), event);
+}
+
+/*************************************************************
+* NAME: BLHelperMouseButtonCallback
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	GLFW mouse button callback params
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static void BLHelperMouseButtonCallback(GLFWwindow* glWin, int button, int action, int mods)
+{
+	BLInputEvent event = { .type = BL_INPUT_EVENT_BUTTON, .time = glfwGetTime( ), .code = button,
+	                       .action = action, .mods = mods };
+	BLWindowPushEvent(BLHelperFindWindow(glWin), event);
+}
+
+/*************************************************************
+* NAME: BLHelperCursorCallback
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	GLFW cursor position callback params
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static void BLHelperCursorCallback(GLFWwindow* glWin, double posX, double posY)
+{
+	BLInputEvent event = { .type = BL_INPUT_EVENT_CURSOR, .time = glfwGetTime( ),
+	                       .pos = BLCreateVert2f((float)posX, (float)posY) };
+	BLWindowPushEvent(BLHelperFindWindow(glWin), event);
+}
+
 /*************************************************************
 * NAME: BLInitWCore
 * DATE: 2021 - 08 - 29
@@ -80,8 +636,17 @@ void BLInitWCore( )
 	if(windowList == NULL)
 	{
 		fprintf(stderr, "Windowlist failed to init!\n");
+		return;
 	}
 
+	//no keys to repeat yet
+	for(int i = 0; i < BL_WINDOW_COUNT_MAX; i++)
+	{
+		windowList->inputArr[i].repeatKey = -1;
+	}
+	windowList->repeatDelay = BL_WINDOW_REPEAT_DELAY;
+	windowList->repeatRate  = BL_WINDOW_REPEAT_RATE;
+
 	//end
 	return;
 }
@@ -99,6 +664,13 @@ void BLInitWCore( )
 *************************************************************/
 void BLTerminateWCore( )
 {
+	//close recordings and replays
+	for(int i = 0; i < BL_WINDOW_COUNT_MAX; i++)
+	{
+		BLWindowStopRecording((BLWindowHandle)i);
+		BLWindowStopReplay((BLWindowHandle)i);
+	}
+
 	//terminate GLFW
 	glfwTerminate( );
 
@@ -183,6 +755,14 @@ BLWindowHandle BLCreateWindow(enum BL_WINDOW_TYPE winType, const char* title, BL
 			//set rendering context to created window
 			glfwMakeContextCurrent(windowList->glWinArr[i]);
 
+			//start with no input, queue input from now on
+			memset(&windowList->inputArr[i], 0, sizeof(BLWindowInput));
+			windowList->inputArr[i].repeatKey = -1;
+			glfwSetKeyCallback(windowList->glWinArr[i], BLHelperKeyCallback);
+			glfwSetCharCallback(windowList->glWinArr[i], BLHelperCharCallback);
+			glfwSetMouseButtonCallback(windowList->glWinArr[i], BLHelperMouseButtonCallback);
+			glfwSetCursorPosCallback(windowList->glWinArr[i], BLHelperCursorCallback);
+
 			//increment window count
 			windowList->windowCount++;
 
@@ -212,6 +792,10 @@ void BLDestroyWindow(BLWindowHandle winHndl)
 	//set window ptr to NULL
 	windowList->glWinArr[(int)winHndl] = NULL;
 
+	//close recording and replay
+	BLWindowStopRecording(winHndl);
+	BLWindowStopReplay(winHndl);
+
 	//decrement window count
 	windowList->windowCount--;
 
@@ -401,17 +985,258 @@ int BLWindowShouldClose(BLWindowHandle winHndl)
 *	void
 * NOTE:
 *	To update all window states, it is recommended that this
-*	function is called
+*	function is called. Also rebuilds every window's input
+*	snapshot from its queued events and key repeats
 *************************************************************/
 void BLWindowUpdate( )
 {
 	//get GLFW to poll events
 	glfwPollEvents( );
 
+	//take queued events into snapshots
+	const double now = glfwGetTime( );
+	for(int i = 0; i < BL_WINDOW_COUNT_MAX; i++)
+	{
+		BLHelperUpdateInput(&windowList->inputArr[i], now);
+	}
+
 	//end
 	return;
 }
 
+/*************************************************************
+* NAME: BLWindowSetKeyRepeat
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	double delay -> seconds a key is held before it repeats
+*	double rate  -> repeats per second, 0 for no repeat
+* RETURNS:
+*	void
+* NOTE:
+*	Applies to every window. Defaults to BL_WINDOW_REPEAT_DELAY
+*	and BL_WINDOW_REPEAT_RATE. Only the latest pressed key
+*	repeats, and the OS's own key repeats are ignored
+*************************************************************/
+void BLWindowSetKeyRepeat(double delay, double rate)
+{
+	windowList->repeatDelay = (delay > 0.0) ? delay : 0.0;
+	windowList->repeatRate  = (rate  > 0.0) ? rate  : 0.0;
+}
+
+/*************************************************************
+* NAME: BLWindowPushEvent
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLWindowHandle winHndl -> window the event belongs to
+*	BLInputEvent event -> event to queue
+* RETURNS:
+*	int, 1 for success, 0 if the queue was full (event
+*	dropped)
+* NOTE:
+*	GLFW callbacks queue through this, it can also be used to
+*	drive input without a real window. Lock free for one
+*	pushing thread per window. Events show up in the window's
+*	snapshot on the next BLWindowUpdate
+*************************************************************/
+int BLWindowPushEvent(BLWindowHandle winHndl, BLInputEvent event)
+{
+	//check if valid handle
+	if(winHndl < 0 || winHndl >= BL_WINDOW_COUNT_MAX)
+	{
+		return 0;
+	}
+
+	return BLHelperPushInputEvent(&windowList->inputArr[(int)winHndl], event);
+}
+
+/*************************************************************
+* NAME: BLWindowStartRecording
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLWindowHandle winHndl -> window to record input of
+*	const char* filePath -> file to record to (overwritten)
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	Every BLWindowUpdate after this writes the window's
+*	snapshot to filePath, until BLWindowStopRecording.
+*	Frames are stored as their time and events, in native
+*	byte order
+*************************************************************/
+int BLWindowStartRecording(BLWindowHandle winHndl, const char* filePath)
+{
+	//check if valid handle
+	if(winHndl < 0 || winHndl >= BL_WINDOW_COUNT_MAX)
+	{
+		fprintf(stderr, "Invalid window handle for recording!\n");
+		return 0;
+	}
+	BLWindowInput* input = &windowList->inputArr[(int)winHndl];
+	BLWindowStopRecording(winHndl);
+
+	//open file
+	input->recordFile = fopen(filePath, "wb");
+	if(input->recordFile == NULL)
+	{
+		fprintf(stderr, "Failed to open %s for recording!\n", filePath);
+		return 0;
+	}
+
+	//header
+	const uint32_t version = BL_WINDOW_RECORD_VERSION;
+	fwrite(BL_WINDOW_RECORD_MAGIC, 1, 4, input->recordFile);
+	fwrite(&version, sizeof(version), 1, input->recordFile);
+
+	//keep held state for the first frame
+	const BLInputFrame* frame = &input->frame;
+	memcpy(input->recordStartKeyArr, frame->keysDown, sizeof(frame->keysDown));
+	memcpy(input->recordStartButtons, frame->buttonDown, sizeof(frame->buttonDown));
+	input->recordStartKeys = frame->keysDownCount;
+	input->recordStartPos  = frame->mousePos;
+	input->recordStartMods = frame->mods;
+	input->recordStart     = 1;
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLWindowStopRecording
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLWindowHandle winHndl -> window to stop recording
+* RETURNS:
+*	void
+* NOTE: N/A
+*************************************************************/
+void BLWindowStopRecording(BLWindowHandle winHndl)
+{
+	if(winHndl < 0 || winHndl >= BL_WINDOW_COUNT_MAX || windowList->inputArr[(int)winHndl].recordFile == NULL)
+	{
+		return;
+	}
+
+	fclose(windowList->inputArr[(int)winHndl].recordFile);
+	windowList->inputArr[(int)winHndl].recordFile = NULL;
+}
+
+/*************************************************************
+* NAME: BLWindowStartReplay
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLWindowHandle winHndl -> window to replay input to
+*	const char* filePath -> file from BLWindowStartRecording
+* RETURNS:
+*	int, 1 for success, 0 for failure
+* NOTE:
+*	Clears the window's held input, then every BLWindowUpdate
+*	takes the next recorded frame (time included) instead of
+*	live input. Stops by itself at the end of the file. Works
+*	without a real window, so ICore can be driven headless
+*************************************************************/
+int BLWindowStartReplay(BLWindowHandle winHndl, const char* filePath)
+{
+	//check if valid handle
+	if(winHndl < 0 || winHndl >= BL_WINDOW_COUNT_MAX)
+	{
+		fprintf(stderr, "Invalid window handle for replay!\n");
+		return 0;
+	}
+	BLWindowInput* input = &windowList->inputArr[(int)winHndl];
+	BLWindowStopReplay(winHndl);
+
+	//open file
+	FILE* file = fopen(filePath, "rb");
+	if(file == NULL)
+	{
+		fprintf(stderr, "Failed to open %s for replay!\n", filePath);
+		return 0;
+	}
+
+	//check header
+	char     magic[4];
+	uint32_t version;
+	if(fread(magic, 1, 4, file) != 4 || memcmp(magic, BL_WINDOW_RECORD_MAGIC, 4) != 0 ||
+		fread(&version, sizeof(version), 1, file) != 1 || version != BL_WINDOW_RECORD_VERSION)
+	{
+		fprintf(stderr, "%s is not an input recording!\n", filePath);
+		fclose(file);
+		return 0;
+	}
+
+	//start from nothing held
+	const BLUInt updateCount = input->frame.updateCount;
+	memset(&input->frame, 0, sizeof(BLInputFrame));
+	input->frame.updateCount = updateCount;
+	input->repeatKey  = -1;
+	input->replayFile = file;
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLWindowStopReplay
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLWindowHandle winHndl -> window to stop replaying
+* RETURNS:
+*	void
+* NOTE:
+*	Live input carries on from the replayed state
+*************************************************************/
+void BLWindowStopReplay(BLWindowHandle winHndl)
+{
+	if(winHndl < 0 || winHndl >= BL_WINDOW_COUNT_MAX || windowList->inputArr[(int)winHndl].replayFile == NULL)
+	{
+		return;
+	}
+
+	fclose(windowList->inputArr[(int)winHndl].replayFile);
+	windowList->inputArr[(int)winHndl].replayFile = NULL;
+}
+
+/*************************************************************
+* NAME: BLWindowIsReplaying
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLWindowHandle winHndl -> window to check
+* RETURNS:
+*	int, 1 if replaying, 0 if not
+* NOTE: N/A
+*************************************************************/
+int BLWindowIsReplaying(BLWindowHandle winHndl)
+{
+	if(winHndl < 0 || winHndl >= BL_WINDOW_COUNT_MAX)
+	{
+		return 0;
+	}
+
+	return windowList->inputArr[(int)winHndl].replayFile != NULL;
+}
+
+/*************************************************************
+* NAME: BLWindowGetInput
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLWindowHandle winHndl -> window to get input of
+* RETURNS:
+*	const BLInputFrame* snapshot of the window's input (an
+*	empty snapshot for an invalid handle)
+* NOTE:
+*	Stays the same until the next BLWindowUpdate
+*************************************************************/
+const BLInputFrame* BLWindowGetInput(BLWindowHandle winHndl)
+{
+	//check if valid handle
+	if(winHndl < 0 || winHndl >= BL_WINDOW_COUNT_MAX)
+	{
+		return &emptyFrame;
+	}
+
+	return &windowList->inputArr[(int)winHndl].frame;
+}
+
 /*************************************************************
 * NAME: BLWindowSwapBuffers
 * DATE: 2021 - 08 - 29
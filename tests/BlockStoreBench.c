@@ -0,0 +1,193 @@
+/*************************************************************
+* FILE: BlockStoreBench.c
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Standalone benchmark for BLBlockStore. Times adding,
+*	removing and re-adding 100k blocks, and scanning their
+*	dims through BLIBlockStoreGetView next to a plain BLBlock
+*	array. Pure CPU, needs no window, build with every BLib
+*	source file and run
+* CONTENTS:
+*	- Includes
+*	- Defs
+*	- Objects
+*	- Helper functions
+*	- Main
+*
+*************************************************************/
+
+#include <stdio.h>   // I/O
+#include <stdlib.h>  // For memory management
+#include <time.h>    // For timing
+
+#include "../BLib.h" // BLib
+
+#define BL_BENCH_BLOCK_COUNT 100000 // blocks in the store
+#define BL_BENCH_SCAN_REPEAT 100    // times the dims are scanned
+
+/*************************************************************
+* NAME: benchSeed (object)
+* DATE: 2026 - 10 - 19
+* USE:
+*	State of BLHelperRandom, fixed so every run does the same
+*	work
+* NOTE: N/A
+*************************************************************/
+static BLUInt benchSeed = 0x2545F491;
+
+/*************************************************************
+* NAME: BLHelperRandom
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	BLUInt range -> upper bound (exclusive)
+* RETURNS:
+*	BLUInt from 0 to range - 1
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	xorshift, rand( ) only goes to 32767 on some compilers
+*************************************************************/
+static BLUInt BLHelperRandom(BLUInt range)
+{
+	benchSeed ^= benchSeed << 13;
+	benchSeed ^= benchSeed >> 17;
+	benchSeed ^= benchSeed << 5;
+	return benchSeed % range;
+}
+
+/*************************************************************
+* NAME: BLHelperMillis
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	clock_t start -> clock( ) before the timed work
+* RETURNS:
+*	double, milliseconds since start
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static double BLHelperMillis(clock_t start)
+{
+	return (double)(clock( ) - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+/*************************************************************
+* NAME: BLHelperPrintTime
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const char* name -> what was timed
+*	double millis -> total time (in milliseconds)
+*	BLUInt ops    -> operations done in that time
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static void BLHelperPrintTime(const char* name, double millis, BLUInt ops)
+{
+	printf("%-28s %9.3f ms %9.2f ns/op\n", name, millis, millis * 1000000.0 / (double)ops);
+}
+
+/*************************************************************
+* NAME: main
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	int, 0 for success, 1 for failure
+* NOTE: N/A
+*************************************************************/
+int main( )
+{
+	BLBlock*       blocks  = malloc(BL_BENCH_BLOCK_COUNT * sizeof(BLBlock));
+	BLBlockHandle* handles = malloc(BL_BENCH_BLOCK_COUNT * sizeof(BLBlockHandle));
+	BLUInt*        order   = malloc(BL_BENCH_BLOCK_COUNT * sizeof(BLUInt));
+	BLBlockStore*  store   = BLICreateBlockStore(0);
+	if(blocks == NULL || handles == NULL || order == NULL || store == NULL)
+	{
+		fprintf(stderr, "BlockStoreBench: memory err\n");
+		return 1;
+	}
+
+	//make blocks, a quarter with text
+	for(BLUInt i = 0; i < BL_BENCH_BLOCK_COUNT; i++)
+	{
+		BLColor colors[2] = { BLCreateColor(i & 0xFF, 0x40, 0x80, 0xFF), BLCreateColor(0x20, i & 0xFF, 0x20, 0xFF) };
+		BLRecti dims = BLCreateRecti(BLHelperRandom(1920), BLHelperRandom(1080), 8 + BLHelperRandom(64), 8 + BLHelperRandom(64));
+		blocks[i] = BLICreateBlock((enum BL_BLOCK_LOOK)BLHelperRandom(3), dims, colors, BLHelperRandom(3), 8,
+		                           (i % 4 == 0) ? (BLByte*)"block" : NULL);
+		order[i] = i;
+	}
+
+	//removal order, shuffled
+	for(BLUInt i = BL_BENCH_BLOCK_COUNT - 1; i > 0; i--)
+	{
+		const BLUInt swap = BLHelperRandom(i + 1);
+		const BLUInt temp = order[i];
+		order[i]    = order[swap];
+		order[swap] = temp;
+	}
+
+	//add, growing from empty
+	clock_t start = clock( );
+	for(BLUInt i = 0; i < BL_BENCH_BLOCK_COUNT; i++)
+	{
+		handles[i] = BLIBlockStoreAdd(store, &blocks[i]);
+	}
+	BLHelperPrintTime("add (grow from empty)", BLHelperMillis(start), BL_BENCH_BLOCK_COUNT);
+
+	//remove half, shuffled
+	start = clock( );
+	for(BLUInt i = 0; i < BL_BENCH_BLOCK_COUNT / 2; i++)
+	{
+		BLIBlockStoreRemove(store, handles[order[i]]);
+	}
+	BLHelperPrintTime("remove half (shuffled)", BLHelperMillis(start), BL_BENCH_BLOCK_COUNT / 2);
+
+	//add them back into the freed slots
+	start = clock( );
+	for(BLUInt i = 0; i < BL_BENCH_BLOCK_COUNT / 2; i++)
+	{
+		handles[order[i]] = BLIBlockStoreAdd(store, &blocks[order[i]]);
+	}
+	BLHelperPrintTime("re-add half (reused slots)", BLHelperMillis(start), BL_BENCH_BLOCK_COUNT / 2);
+
+	//scan dims, store view against a plain array
+	volatile long long sum = 0;
+	start = clock( );
+	for(BLUInt r = 0; r < BL_BENCH_SCAN_REPEAT; r++)
+	{
+		const BLBlockStoreView view = BLIBlockStoreGetView(store);
+		for(BLUInt i = 0; i < view.count; i++)
+		{
+			sum += view.dims[i].X + view.dims[i].W;
+		}
+	}
+	BLHelperPrintTime("scan dims (store view)", BLHelperMillis(start), BL_BENCH_BLOCK_COUNT * BL_BENCH_SCAN_REPEAT);
+
+	start = clock( );
+	for(BLUInt r = 0; r < BL_BENCH_SCAN_REPEAT; r++)
+	{
+		for(BLUInt i = 0; i < BL_BENCH_BLOCK_COUNT; i++)
+		{
+			sum += blocks[i].bDims.X + blocks[i].bDims.W;
+		}
+	}
+	BLHelperPrintTime("scan dims (BLBlock array)", BLHelperMillis(start), BL_BENCH_BLOCK_COUNT * BL_BENCH_SCAN_REPEAT);
+
+	//remove everything, shuffled
+	start = clock( );
+	for(BLUInt i = 0; i < BL_BENCH_BLOCK_COUNT; i++)
+	{
+		BLIBlockStoreRemove(store, handles[order[i]]);
+	}
+	BLHelperPrintTime("remove all (shuffled)", BLHelperMillis(start), BL_BENCH_BLOCK_COUNT);
+
+	const BLUInt left = BLIBlockStoreGetView(store).count;
+
+	//end
+	BLIDestroyBlockStore(store);
+	free(order);
+	free(handles);
+	free(blocks);
+	return (left == 0) ? 0 : 1;
+}
\ No newline at end of file
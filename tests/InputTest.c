@@ -0,0 +1,243 @@
+/*************************************************************
+* FILE: InputTest.c
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Standalone test for the WCore input queue. Pushes events
+*	with BLWindowPushEvent, drains them with BLWindowUpdate and
+*	checks the window's BLInputFrame. Needs no window, build
+*	with every BLib source file and run, returns 0 on success
+* CONTENTS:
+*	- Includes
+*	- Defs
+*	- Test functions
+*	- Main
+*
+*************************************************************/
+
+#include <stdio.h>   // I/O
+
+#include "../BLib.h" // BLib
+
+#define BL_TEST_WINDOW 0 // handle pushed to, no window is created
+
+/*************************************************************
+* NAME: BL_TEST_CHECK
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	cond -> condition that should be true
+* NOTE:
+*	Prints the failed condition and fails the test function
+*************************************************************/
+#define BL_TEST_CHECK(cond)                                        \
+	if(!(cond))                                                    \
+	{                                                              \
+		fprintf(stderr, "InputTest: %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+		return 0;                                                  \
+	}
+
+/*************************************************************
+* NAME: BLHelperPush
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	enum BL_INPUT_EVENT_TYPE type -> type of event
+*	BLInt code   -> key, button or codepoint
+*	BLInt action -> enum BL_INPUT_ACTION
+*	BLInt mods   -> GLFW modifier bits
+* RETURNS:
+*	int, return value of BLWindowPushEvent
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static int BLHelperPush(enum BL_INPUT_EVENT_TYPE type, BLInt code, BLInt action, BLInt mods)
+{
+	BLInputEvent event = { .type = type, .code = code, .action = action, .mods = mods };
+	return BLWindowPushEvent(BL_TEST_WINDOW, event);
+}
+
+/*************************************************************
+* NAME: BLHelperTestKeys
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	int, 1 for pass, 0 for fail
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Key and char events come out in push order, held keys stay
+*	held across updates until released
+*************************************************************/
+static int BLHelperTestKeys( )
+{
+	const BLInputFrame* frame = BLWindowGetInput(BL_TEST_WINDOW);
+
+	BL_TEST_CHECK(BLHelperPush(BL_INPUT_EVENT_KEY, 'A', BL_INPUT_ACTION_PRESS, 0) == 1);
+	BL_TEST_CHECK(BLHelperPush(BL_INPUT_EVENT_CHAR, 'a', 0, 0) == 1);
+	BL_TEST_CHECK(BLHelperPush(BL_INPUT_EVENT_KEY, 'B', BL_INPUT_ACTION_PRESS, 1) == 1);
+	BLWindowUpdate( );
+
+	BL_TEST_CHECK(frame->eventCount == 3);
+	BL_TEST_CHECK(frame->events[0].type == BL_INPUT_EVENT_KEY && frame->events[0].code == 'A');
+	BL_TEST_CHECK(frame->events[1].type == BL_INPUT_EVENT_CHAR && frame->events[1].code == 'a');
+	BL_TEST_CHECK(frame->events[2].type == BL_INPUT_EVENT_KEY && frame->events[2].code == 'B');
+	BL_TEST_CHECK(frame->keyDown['A'] && frame->keyDown['B']);
+	BL_TEST_CHECK(frame->keysDownCount == 2);
+	BL_TEST_CHECK(frame->keysDown[0] == 'A' && frame->keysDown[1] == 'B');
+	BL_TEST_CHECK(frame->mods == 1);
+
+	//held keys carry over, events don't
+	BLWindowUpdate( );
+	BL_TEST_CHECK(frame->eventCount == 0);
+	BL_TEST_CHECK(frame->keyDown['A'] && frame->keysDownCount == 2);
+
+	//release keeps the other key's order
+	BL_TEST_CHECK(BLHelperPush(BL_INPUT_EVENT_KEY, 'A', BL_INPUT_ACTION_RELEASE, 0) == 1);
+	BLWindowUpdate( );
+	BL_TEST_CHECK(frame->eventCount == 1 && frame->events[0].action == BL_INPUT_ACTION_RELEASE);
+	BL_TEST_CHECK(!frame->keyDown['A'] && frame->keyDown['B']);
+	BL_TEST_CHECK(frame->keysDownCount == 1 && frame->keysDown[0] == 'B');
+	BL_TEST_CHECK(frame->mods == 0);
+
+	BL_TEST_CHECK(BLHelperPush(BL_INPUT_EVENT_KEY, 'B', BL_INPUT_ACTION_RELEASE, 0) == 1);
+	BLWindowUpdate( );
+	BL_TEST_CHECK(frame->keysDownCount == 0);
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLHelperTestMouse
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	int, 1 for pass, 0 for fail
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Buttons stay held until released, the cursor keeps its
+*	latest position
+*************************************************************/
+static int BLHelperTestMouse( )
+{
+	const BLInputFrame* frame = BLWindowGetInput(BL_TEST_WINDOW);
+
+	BLInputEvent cursor = { .type = BL_INPUT_EVENT_CURSOR, .pos = BLCreateVert2f(10.0f, 20.0f) };
+	BL_TEST_CHECK(BLWindowPushEvent(BL_TEST_WINDOW, cursor) == 1);
+	BL_TEST_CHECK(BLHelperPush(BL_INPUT_EVENT_BUTTON, 1, BL_INPUT_ACTION_PRESS, 0) == 1);
+	cursor.pos = BLCreateVert2f(30.0f, 40.0f);
+	BL_TEST_CHECK(BLWindowPushEvent(BL_TEST_WINDOW, cursor) == 1);
+	BLWindowUpdate( );
+
+	BL_TEST_CHECK(frame->eventCount == 3);
+	BL_TEST_CHECK(frame->events[0].type == BL_INPUT_EVENT_CURSOR && frame->events[0].pos.X == 10.0f);
+	BL_TEST_CHECK(frame->events[1].type == BL_INPUT_EVENT_BUTTON && frame->events[1].code == 1);
+	BL_TEST_CHECK(frame->buttonDown[1] && !frame->buttonDown[0]);
+	BL_TEST_CHECK(frame->mousePos.X == 30.0f && frame->mousePos.Y == 40.0f);
+
+	BLWindowUpdate( );
+	BL_TEST_CHECK(frame->eventCount == 0 && frame->buttonDown[1]);
+	BL_TEST_CHECK(frame->mousePos.X == 30.0f);
+
+	BL_TEST_CHECK(BLHelperPush(BL_INPUT_EVENT_BUTTON, 1, BL_INPUT_ACTION_RELEASE, 0) == 1);
+	BLWindowUpdate( );
+	BL_TEST_CHECK(!frame->buttonDown[1]);
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLHelperTestOverflow
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	int, 1 for pass, 0 for fail
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Pushing to a full queue returns 0 and counts the event as
+*	dropped, the queue takes events again after an update
+*************************************************************/
+static int BLHelperTestOverflow( )
+{
+	const BLInputFrame* frame = BLWindowGetInput(BL_TEST_WINDOW);
+	const BLUInt dropped = frame->dropped;
+
+	//fill queue
+	for(BLUInt i = 0; i < BL_WINDOW_EVENT_QUEUE_SIZE; i++)
+	{
+		BL_TEST_CHECK(BLHelperPush(BL_INPUT_EVENT_CHAR, (BLInt)('a' + (i % 26)), 0, 0) == 1);
+	}
+
+	//full
+	BL_TEST_CHECK(BLHelperPush(BL_INPUT_EVENT_CHAR, 'z', 0, 0) == 0);
+	BL_TEST_CHECK(BLHelperPush(BL_INPUT_EVENT_KEY, 'C', BL_INPUT_ACTION_PRESS, 0) == 0);
+	BLWindowUpdate( );
+
+	BL_TEST_CHECK(frame->eventCount == BL_WINDOW_EVENT_QUEUE_SIZE);
+	BL_TEST_CHECK(frame->dropped == dropped + 2);
+	BL_TEST_CHECK(frame->events[0].code == 'a');
+	BL_TEST_CHECK(frame->events[BL_WINDOW_EVENT_QUEUE_SIZE - 1].code == (BLInt)('a' + ((BL_WINDOW_EVENT_QUEUE_SIZE - 1) % 26)));
+	BL_TEST_CHECK(!frame->keyDown['C']);
+
+	//drained
+	BL_TEST_CHECK(BLHelperPush(BL_INPUT_EVENT_CHAR, 'z', 0, 0) == 1);
+	BLWindowUpdate( );
+	BL_TEST_CHECK(frame->eventCount == 1 && frame->events[0].code == 'z');
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: BLHelperTestHandles
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	int, 1 for pass, 0 for fail
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	Invalid handles refuse events and give an empty snapshot
+*************************************************************/
+static int BLHelperTestHandles( )
+{
+	BLInputEvent event = { .type = BL_INPUT_EVENT_KEY, .code = 'A', .action = BL_INPUT_ACTION_PRESS };
+	BL_TEST_CHECK(BLWindowPushEvent(BL_WINDOW_ERRHANDLE, event) == 0);
+	BL_TEST_CHECK(BLWindowPushEvent(BL_WINDOW_COUNT_MAX, event) == 0);
+	BL_TEST_CHECK(BLWindowGetInput(BL_WINDOW_ERRHANDLE) != NULL);
+	BL_TEST_CHECK(BLWindowGetInput(BL_WINDOW_ERRHANDLE)->eventCount == 0);
+
+	//end
+	return 1;
+}
+
+/*************************************************************
+* NAME: main
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	int, 0 if every test passed, 1 otherwise
+* NOTE: N/A
+*************************************************************/
+int main( )
+{
+	BLInitWCore( );
+
+	//no repeats, so every event is a pushed one
+	BLWindowSetKeyRepeat(0.0, 0.0);
+
+	int passed = 1;
+	passed &= BLHelperTestKeys( );
+	passed &= BLHelperTestMouse( );
+	passed &= BLHelperTestOverflow( );
+	passed &= BLHelperTestHandles( );
+
+	BLTerminateWCore( );
+
+	//end
+	printf("InputTest: %s\n", passed ? "passed" : "FAILED");
+	return passed ? 0 : 1;
+}
\ No newline at end of file
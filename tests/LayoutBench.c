@@ -0,0 +1,136 @@
+/*************************************************************
+* FILE: LayoutBench.c
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Standalone benchmark for BLILayout. Builds a 10k node
+*	tree (a column of rows of leaves) and times
+*	BLILayoutUpdate with everything changed, nothing changed,
+*	one leaf changed and the root resized. Pure CPU, needs no
+*	window, build with every BLib source file and run
+* CONTENTS:
+*	- Includes
+*	- Defs
+*	- Helper functions
+*	- Main
+*
+*************************************************************/
+
+#include <stdio.h>   // I/O
+#include <time.h>    // For timing
+
+#include "../BLib.h" // BLib
+
+#define BL_BENCH_ROW_COUNT  100 // rows in the root column
+#define BL_BENCH_LEAF_COUNT 99  // leaves in each row
+#define BL_BENCH_REPEAT     100 // updates timed per case
+
+/*************************************************************
+* NAME: BLHelperMillis
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	clock_t start -> clock( ) before the timed work
+* RETURNS:
+*	double, milliseconds since start
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static double BLHelperMillis(clock_t start)
+{
+	return (double)(clock( ) - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+/*************************************************************
+* NAME: BLHelperPrintTime
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const char* name -> what was timed
+*	double millis -> total time of every repeat (in
+*	milliseconds)
+*	BLUInt placed -> nodes placed by one update
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static void BLHelperPrintTime(const char* name, double millis, BLUInt placed)
+{
+	printf("%-24s %9.4f ms/update %6u nodes placed\n", name, millis / BL_BENCH_REPEAT, placed);
+}
+
+/*************************************************************
+* NAME: main
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	int, 0 for success, 1 for failure
+* NOTE: N/A
+*************************************************************/
+int main( )
+{
+	BLILayout* layout = BLICreateLayout(0);
+	if(layout == NULL)
+	{
+		fprintf(stderr, "LayoutBench: memory err\n");
+		return 1;
+	}
+
+	//a column of rows, each row splits its width between leaves
+	BLILayoutStyle column = BLICreateLayoutStyle(BL_ILAYOUT_DIR_COLUMN, 0, 0, 0.0f);
+	BLILayoutStyle row    = BLICreateLayoutStyle(BL_ILAYOUT_DIR_ROW, 0, 20, 1.0f);
+	BLILayoutStyle leaf   = BLICreateLayoutStyle(BL_ILAYOUT_DIR_ROW, 10, 0, 1.0f);
+	column.padding = 4;
+	column.gap     = 2;
+	row.gap        = 1;
+
+	//build
+	clock_t start = clock( );
+	const BLUInt root = BLILayoutAddNode(layout, BL_ILAYOUT_NONE, &column);
+	BLUInt lastLeaf = BL_ILAYOUT_NONE;
+	for(BLUInt i = 0; i < BL_BENCH_ROW_COUNT; i++)
+	{
+		const BLUInt rowNode = BLILayoutAddNode(layout, root, &row);
+		for(BLUInt j = 0; j < BL_BENCH_LEAF_COUNT; j++)
+		{
+			lastLeaf = BLILayoutAddNode(layout, rowNode, &leaf);
+		}
+	}
+	const double buildMillis = BLHelperMillis(start);
+
+	BLUInt nodeCount = 0;
+	BLILayoutGetRects(layout, &nodeCount);
+	printf("%u nodes built in %.3f ms\n", nodeCount, buildMillis);
+
+	//everything changed, the root is resized every time
+	BLUInt placed = 0;
+	start = clock( );
+	for(BLUInt r = 0; r < BL_BENCH_REPEAT; r++)
+	{
+		BLILayoutSetRootRect(layout, root, BLCreateRecti(0, 0, 1920 + (BLInt)(r % 2), 4000));
+		placed = BLILayoutUpdate(layout);
+	}
+	BLHelperPrintTime("root resized", BLHelperMillis(start), placed);
+
+	//nothing changed
+	start = clock( );
+	for(BLUInt r = 0; r < BL_BENCH_REPEAT; r++)
+	{
+		placed = BLILayoutUpdate(layout);
+	}
+	BLHelperPrintTime("nothing changed", BLHelperMillis(start), placed);
+
+	//one leaf changed, only its row is placed again
+	start = clock( );
+	for(BLUInt r = 0; r < BL_BENCH_REPEAT; r++)
+	{
+		leaf.W = 10 + (BLInt)(r % 2) * 20;
+		BLILayoutSetStyle(layout, lastLeaf, &leaf);
+		placed = BLILayoutUpdate(layout);
+	}
+	BLHelperPrintTime("one leaf changed", BLHelperMillis(start), placed);
+
+	//end
+	BLIDestroyLayout(layout);
+	return (nodeCount == 1 + BL_BENCH_ROW_COUNT * (1 + BL_BENCH_LEAF_COUNT)) ? 0 : 1;
+}
\ No newline at end of file
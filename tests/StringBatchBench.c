@@ -0,0 +1,136 @@
+/*************************************************************
+* FILE: StringBatchBench.c
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Standalone benchmark for batched text. Draws a screen of
+*	10,000 visible characters (100 strings of 100) with and
+*	without BLIBeginBatch and BLIEndBatch, and prints the time
+*	per frame with the draw calls and quads from
+*	BLIGetBatchStats. Opens a window, build with every BLib
+*	source file and run
+* CONTENTS:
+*	- Includes
+*	- Defs
+*	- Helper functions
+*	- Main
+*
+*************************************************************/
+
+#include <stdio.h>   // I/O
+#include <string.h>  // For memset
+#include <time.h>    // For timing
+
+#include <Windows.h> // OpenGL dependancy
+#include <gl/GL.h>   // For glFinish
+
+#include "../BLib.h" // BLib
+
+#define BL_BENCH_WINDOW_W     1280 // window width
+#define BL_BENCH_WINDOW_H     800  // window height
+#define BL_BENCH_STRING_COUNT 100  // strings per frame
+#define BL_BENCH_STRING_LEN   100  // characters per string
+#define BL_BENCH_SCALE        8    // character scale (in pixels)
+#define BL_BENCH_FRAMES       100  // frames timed per case
+
+/*************************************************************
+* NAME: BLHelperDrawScreen
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const BLByte* line -> string drawn on every row
+*	int batched -> 1 to draw between BLIBeginBatch and
+*	BLIEndBatch
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	One frame, every string is on screen
+*************************************************************/
+static void BLHelperDrawScreen(const BLByte* line, int batched)
+{
+	if(batched)
+	{
+		BLIBeginBatch( );
+	}
+
+	for(BLUInt i = 0; i < BL_BENCH_STRING_COUNT; i++)
+	{
+		BLIRenderString(line, BL_BENCH_SCALE, (i + 1) * (BL_BENCH_SCALE - 1), BL_BENCH_SCALE, BL_GFONT_TYPE_WHITE);
+	}
+
+	if(batched)
+	{
+		BLIEndBatch( );
+	}
+}
+
+/*************************************************************
+* NAME: BLHelperTimeScreen
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	const char* name -> name of the case
+*	const BLByte* line -> string drawn on every row
+*	int batched -> 1 to draw between BLIBeginBatch and
+*	BLIEndBatch
+* RETURNS:
+*	void
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*	glFinish is part of each frame so the GPU's time counts
+*************************************************************/
+static void BLHelperTimeScreen(const char* name, const BLByte* line, int batched)
+{
+	//warm up
+	BLHelperDrawScreen(line, batched);
+	glFinish( );
+	BLIResetBatchStats( );
+
+	//time
+	const clock_t start = clock( );
+	for(BLUInt f = 0; f < BL_BENCH_FRAMES; f++)
+	{
+		BLHelperDrawScreen(line, batched);
+		glFinish( );
+	}
+	const double millis = (double)(clock( ) - start) * 1000.0 / CLOCKS_PER_SEC;
+
+	const BLIBatchStats stats = BLIGetBatchStats( );
+	printf("%-10s %8.3f ms/frame %6u draws/frame %6u quads/frame\n", name, millis / BL_BENCH_FRAMES,
+		stats.flushes / BL_BENCH_FRAMES, stats.quads / BL_BENCH_FRAMES);
+}
+
+/*************************************************************
+* NAME: main
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	int, 0 for success, 1 for failure
+* NOTE: N/A
+*************************************************************/
+int main( )
+{
+	const BLWindowHandle window = BLibInit(BL_BENCH_WINDOW_W, BL_BENCH_WINDOW_H);
+	if(window == BL_WINDOW_ERRHANDLE)
+	{
+		fprintf(stderr, "StringBatchBench: window err\n");
+		return 1;
+	}
+
+	//100 letters, no spaces, so every character is a quad
+	BLByte line[BL_BENCH_STRING_LEN + 1];
+	for(BLUInt i = 0; i < BL_BENCH_STRING_LEN; i++)
+	{
+		line[i] = (BLByte)('A' + (i % 26));
+	}
+	line[BL_BENCH_STRING_LEN] = 0;
+
+	printf("%u strings of %u characters\n", BL_BENCH_STRING_COUNT, BL_BENCH_STRING_LEN);
+	BLHelperTimeScreen("unbatched", line, 0);
+	BLHelperTimeScreen("batched", line, 1);
+
+	//end
+	BLDestroyWindow(window);
+	BLTerminateWCore( );
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+/*************************************************************
+* FILE: TextViewBench.c
+* DATE: 2026 - 10 - 19
+* DEVS: Bailey Jia-Tao Brown
+* DESC:
+*	Standalone benchmark for BLITextView. Appends 2 million
+*	lines, 1000 per frame, while scrolling with
+*	BLITextViewScrollBy and drawing with BLIRenderTextView,
+*	and prints the time per frame at several document sizes.
+*	The cost should stay the same as the document grows.
+*	Opens a window, build with every BLib source file and run
+* CONTENTS:
+*	- Includes
+*	- Defs
+*	- Helper functions
+*	- Main
+*
+*************************************************************/
+
+#include <stdio.h>   // I/O
+#include <time.h>    // For timing
+
+#include <Windows.h> // OpenGL dependancy
+#include <gl/GL.h>   // For glFinish
+
+#include "../BLib.h" // BLib
+
+#define BL_BENCH_WINDOW_W        1280    // window width
+#define BL_BENCH_WINDOW_H        800     // window height
+#define BL_BENCH_LINES_PER_FRAME 1000    // lines appended each frame
+#define BL_BENCH_LINE_TOTAL      2000000 // lines in the end
+#define BL_BENCH_SAMPLE_FRAMES   20      // frames timed before each report
+#define BL_BENCH_SCALE           8       // character scale (in pixels)
+
+/*************************************************************
+* NAME: BLHelperMillis
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	clock_t start -> clock( ) before the timed work
+* RETURNS:
+*	double, milliseconds since start
+* NOTE:
+*	FILE SPECIFIC FUNCTION
+*************************************************************/
+static double BLHelperMillis(clock_t start)
+{
+	return (double)(clock( ) - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+/*************************************************************
+* NAME: main
+* DATE: 2026 - 10 - 19
+* PARAMS:
+*	none
+* RETURNS:
+*	int, 0 for success, 1 for failure
+* NOTE:
+*	Reports at 20k, 200k, 1M and 2M lines, each over the
+*	BL_BENCH_SAMPLE_FRAMES frames before it
+*************************************************************/
+int main( )
+{
+	static const BLUInt reportAt[] = { 20000, 200000, 1000000, BL_BENCH_LINE_TOTAL };
+
+	const BLWindowHandle window = BLibInit(BL_BENCH_WINDOW_W, BL_BENCH_WINDOW_H);
+	BLITextView* view = BLICreateTextView( );
+	if(window == BL_WINDOW_ERRHANDLE || view == NULL)
+	{
+		fprintf(stderr, "TextViewBench: init err\n");
+		return 1;
+	}
+
+	const BLRecti bounds = BLCreateRecti(0, 0, BL_BENCH_WINDOW_W, BL_BENCH_WINDOW_H);
+	char   line[0x80];
+	BLUInt lineCount  = 0;
+	BLUInt report     = 0;
+	double appendTime = 0.0;
+	double drawTime   = 0.0;
+
+	printf("%10s %14s %14s %14s\n", "lines", "append ms", "scroll+draw ms", "frame ms");
+	while(lineCount < BL_BENCH_LINE_TOTAL)
+	{
+		//start timing this report's frames
+		const int sampled = (lineCount + (BL_BENCH_SAMPLE_FRAMES * BL_BENCH_LINES_PER_FRAME) >= reportAt[report]);
+
+		//append a frame's lines
+		clock_t start = clock( );
+		for(BLUInt i = 0; i < BL_BENCH_LINES_PER_FRAME; i++)
+		{
+			const int length = sprintf(line, "%07u: the quick brown fox jumps over the lazy dog\n", lineCount + i);
+			BLITextViewAppend(view, (const BLByte*)line, (BLUInt)length);
+		}
+		lineCount += BL_BENCH_LINES_PER_FRAME;
+		if(sampled)
+		{
+			appendTime += BLHelperMillis(start);
+		}
+
+		//scroll down, back up every other frame, and draw
+		start = clock( );
+		BLITextViewScrollBy(view, (lineCount % (2 * BL_BENCH_LINES_PER_FRAME) == 0) ? -(BLInt)(BL_BENCH_LINES_PER_FRAME / 2) :
+			(BLInt)BL_BENCH_LINES_PER_FRAME);
+		BLIRenderTextView(view, bounds, BL_BENCH_SCALE, BL_GFONT_TYPE_WHITE);
+		glFinish( );
+		if(sampled)
+		{
+			drawTime += BLHelperMillis(start);
+		}
+
+		//report
+		if(lineCount == reportAt[report])
+		{
+			printf("%10u %14.4f %14.4f %14.4f\n", lineCount, appendTime / BL_BENCH_SAMPLE_FRAMES,
+				drawTime / BL_BENCH_SAMPLE_FRAMES, (appendTime + drawTime) / BL_BENCH_SAMPLE_FRAMES);
+			appendTime = 0.0;
+			drawTime   = 0.0;
+			report++;
+		}
+	}
+
+	const BLUInt viewLines = BLITextViewGetLineCount(view);
+
+	//end
+	BLIDestroyTextView(view);
+	BLDestroyWindow(window);
+	BLTerminateWCore( );
+	return (viewLines >= BL_BENCH_LINE_TOTAL) ? 0 : 1;
+}
\ No newline at end of file